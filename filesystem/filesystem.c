@@ -60,6 +60,18 @@ int lfs_storage_sync(const struct lfs_config *cfg) {
     return !watch_storage_sync();
 }
 
+#ifndef FILESYSTEM_MAX_OPEN_FILES
+#define FILESYSTEM_MAX_OPEN_FILES 1
+#endif
+
+#define FILESYSTEM_CACHE_SIZE NVMCTRL_PAGE_SIZE
+#define FILESYSTEM_LOOKAHEAD_SIZE 16
+
+// littlefs mallocs any buffer we don't hand it, so everything it needs lives here instead.
+static uint8_t _filesystem_read_buffer[FILESYSTEM_CACHE_SIZE];
+static uint8_t _filesystem_prog_buffer[FILESYSTEM_CACHE_SIZE];
+static uint32_t _filesystem_lookahead_buffer[FILESYSTEM_LOOKAHEAD_SIZE / sizeof(uint32_t)];
+
 const struct lfs_config watch_lfs_cfg = {
     // block device operations
     .read  = lfs_storage_read,
@@ -72,15 +84,53 @@ const struct lfs_config watch_lfs_cfg = {
     .prog_size = NVMCTRL_PAGE_SIZE,
     .block_size = NVMCTRL_ROW_SIZE,
     .block_count = NVMCTRL_RWWEE_PAGES / 4,
-    .cache_size = NVMCTRL_PAGE_SIZE,
-    .lookahead_size = 16,
+    .cache_size = FILESYSTEM_CACHE_SIZE,
+    .lookahead_size = FILESYSTEM_LOOKAHEAD_SIZE,
     .block_cycles = 100,
+
+    // statically allocated buffers
+    .read_buffer = _filesystem_read_buffer,
+    .prog_buffer = _filesystem_prog_buffer,
+    .lookahead_buffer = _filesystem_lookahead_buffer,
 };
 
 lfs_t eeprom_filesystem;
-static lfs_file_t file;
 static struct lfs_info info;
 
+// One slot per simultaneously open file. Each carries its own cache, so opening a file never touches the heap.
+typedef struct {
+    lfs_file_t file;
+    struct lfs_file_config config;
+    uint8_t buffer[FILESYSTEM_CACHE_SIZE];
+    bool in_use;
+} filesystem_file_slot_t;
+
+static filesystem_file_slot_t _filesystem_file_slots[FILESYSTEM_MAX_OPEN_FILES];
+
+static lfs_file_t *_filesystem_open(const char *filename, int flags) {
+    for (uint8_t i = 0; i < FILESYSTEM_MAX_OPEN_FILES; i++) {
+        filesystem_file_slot_t *slot = &_filesystem_file_slots[i];
+        if (slot->in_use) continue;
+        memset(&slot->config, 0, sizeof(slot->config));
+        slot->config.buffer = slot->buffer;
+        if (lfs_file_opencfg(&eeprom_filesystem, &slot->file, filename, flags, &slot->config) < 0) return NULL;
+        slot->in_use = true;
+        return &slot->file;
+    }
+
+    // every slot is taken: fail here rather than let littlefs fall back to malloc.
+    printf("%s: no free file handles (FILESYSTEM_MAX_OPEN_FILES is %d)\r\n", filename, FILESYSTEM_MAX_OPEN_FILES);
+    return NULL;
+}
+
+static bool _filesystem_close(lfs_file_t *file) {
+    filesystem_file_slot_t *slot = (filesystem_file_slot_t *)file;
+    int err = lfs_file_close(&eeprom_filesystem, file);
+    // littlefs releases the file even if the final flush fails, so the slot is free either way.
+    slot->in_use = false;
+    return err == LFS_ERR_OK;
+}
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -148,7 +198,7 @@ bool filesystem_init(void) {
         printf("Ignore that error! Formatting filesystem...\r\n");
         err = lfs_format(&eeprom_filesystem, &watch_lfs_cfg);
         if (err < 0) return false;
-        err = lfs_mount(&eeprom_filesystem, &watch_lfs_cfg) == LFS_ERR_OK;
+        err = lfs_mount(&eeprom_filesystem, &watch_lfs_cfg);
         printf("Filesystem mounted with %ld bytes free.\r\n", filesystem_get_free_space());
     }
 
@@ -200,11 +250,11 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY);
-        if (err < 0) return false;
-        err = lfs_file_read(&eeprom_filesystem, &file, buf, min(length, file_size));
-        if (err < 0) return false;
-        return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+        lfs_file_t *file = _filesystem_open(filename, LFS_O_RDONLY);
+        if (file == NULL) return false;
+        int err = lfs_file_read(&eeprom_filesystem, file, buf, min(length, file_size));
+        bool closed = _filesystem_close(file);
+        return err >= 0 && closed;
     }
 
     return false;
@@ -214,12 +264,12 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
     memset(buf, 0, length + 1);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDONLY);
-        if (err < 0) return false;
-        err = lfs_file_seek(&eeprom_filesystem, &file, *offset, LFS_SEEK_SET);
-        if (err < 0) return false;
-        err = lfs_file_read(&eeprom_filesystem, &file, buf, min(length - 1, file_size - *offset));
-        if (err < 0) return false;
+        lfs_file_t *file = _filesystem_open(filename, LFS_O_RDONLY);
+        if (file == NULL) return false;
+        int err = lfs_file_seek(&eeprom_filesystem, file, *offset, LFS_SEEK_SET);
+        if (err >= 0) err = lfs_file_read(&eeprom_filesystem, file, buf, min(length - 1, file_size - *offset));
+        bool closed = _filesystem_close(file);
+        if (err < 0 || !closed) return false;
         for(int i = 0; i < length; i++) {
             (*offset)++;
             if (buf[i] == '\n') {
@@ -227,12 +277,27 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
                 break;
             }
         }
-        return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+        return true;
     }
 
     return false;
 }
 
+int32_t filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length) {
+    int32_t file_size = filesystem_get_file_size(filename);
+    if (file_size < 0 || offset < 0) return -1;
+    if (offset >= file_size) return 0;
+
+    lfs_file_t *file = _filesystem_open(filename, LFS_O_RDONLY);
+    if (file == NULL) return -1;
+    int err = lfs_file_seek(&eeprom_filesystem, file, offset, LFS_SEEK_SET);
+    if (err >= 0) err = lfs_file_read(&eeprom_filesystem, file, buf, min(length, file_size - offset));
+    bool closed = _filesystem_close(file);
+    if (err < 0 || !closed) return -1;
+
+    return err;
+}
+
 static void filesystem_cat(char *filename) {
     info.type = 0;
     lfs_stat(&eeprom_filesystem, filename, &info);
@@ -257,11 +322,11 @@ bool filesystem_write_file(char *filename, char *text, int32_t length) {
         return false;    
     }
 
-    int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
-    if (err < 0) return false;
-    err = lfs_file_write(&eeprom_filesystem, &file, text, length);
-    if (err < 0) return false;
-    return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+    lfs_file_t *file = _filesystem_open(filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+    if (file == NULL) return false;
+    int err = lfs_file_write(&eeprom_filesystem, file, text, length);
+    bool closed = _filesystem_close(file);
+    return err >= 0 && closed;
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
@@ -270,11 +335,11 @@ bool filesystem_append_file(char *filename, char *text, int32_t length) {
         return false;    
     }
 
-    int err = lfs_file_open(&eeprom_filesystem, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
-    if (err < 0) return false;
-    err = lfs_file_write(&eeprom_filesystem, &file, text, length);
-    if (err < 0) return false;
-    return lfs_file_close(&eeprom_filesystem, &file) == LFS_ERR_OK;
+    lfs_file_t *file = _filesystem_open(filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    if (file == NULL) return false;
+    int err = lfs_file_write(&eeprom_filesystem, file, text, length);
+    bool closed = _filesystem_close(file);
+    return err >= 0 && closed;
 }
 
 int filesystem_cmd_ls(int argc, char *argv[]) {
@@ -81,6 +81,15 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/** @brief Reads part of a file into a buffer
+  * @param filename the file you wish to read
+  * @param buf A buffer of at least length bytes
+  * @param offset Where in the file to start reading
+  * @param length The maximum number of bytes to read
+  * @return the number of bytes read, which is less than length at the end of the file; or -1 on error
+  */
+int32_t filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
@@ -0,0 +1,234 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "filesystem.h"
+#include "filesystem_log.h"
+
+// the largest entry: two five-byte varints.
+#define FILESYSTEM_LOG_MAX_ENTRY_SIZE 10
+
+static uint16_t _filesystem_log_checksum(const uint8_t *data, uint16_t length) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint8_t _filesystem_log_put_varint(uint8_t *buf, int32_t value) {
+    // zigzag: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+    uint32_t bits = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    uint8_t length = 0;
+    while (bits >= 0x80) {
+        buf[length++] = (bits & 0x7F) | 0x80;
+        bits >>= 7;
+    }
+    buf[length++] = bits;
+    return length;
+}
+
+/// @return the number of bytes read, or 0 if the varint runs past the end.
+static uint8_t _filesystem_log_get_varint(const uint8_t *buf, uint8_t available, int32_t *value) {
+    uint32_t bits = 0;
+    for (uint8_t i = 0; i < available && i < 5; i++) {
+        bits |= (uint32_t)(buf[i] & 0x7F) << (7 * i);
+        if (!(buf[i] & 0x80)) {
+            *value = (int32_t)(bits >> 1) ^ -(int32_t)(bits & 1);
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/// @return the length of the block's entries if a block with a good checksum starts at buf, or 0.
+static uint8_t _filesystem_log_check_block(const uint8_t *buf, int32_t available) {
+    uint8_t length = buf[0];
+    if (available < 3 || length == 0 || length > FILESYSTEM_LOG_BLOCK_SIZE || length + 3 > available) return 0;
+    uint16_t checksum = buf[length + 1] | (buf[length + 2] << 8);
+    return _filesystem_log_checksum(buf, length + 1) == checksum ? length : 0;
+}
+
+void filesystem_log_writer_init(filesystem_log_writer_t *writer, const char *filename, int32_t max_size) {
+    memset(writer, 0, sizeof(filesystem_log_writer_t));
+    strncpy(writer->filename, filename, FILESYSTEM_LOG_FILENAME_LENGTH - 1);
+    writer->max_size = max_size;
+}
+
+/// Drops blocks from the start of the file until there's room for needed more bytes.
+static bool _filesystem_log_make_room(filesystem_log_writer_t *writer, int32_t needed) {
+    int32_t size = filesystem_get_file_size(writer->filename);
+    if (size <= 0 || size + needed <= writer->max_size) return true;
+
+    uint8_t *buf = malloc(size);
+    if (buf == NULL) return false;
+    bool ok = filesystem_read_file(writer->filename, (char *)buf, size);
+    if (ok) {
+        // skip whole blocks until what's left fits; anything that isn't a good block goes too.
+        int32_t start = 0;
+        while (start < size) {
+            uint8_t length = _filesystem_log_check_block(buf + start, size - start);
+            if (length && size - start + needed <= writer->max_size) break;
+            start += length ? length + 3 : 1;
+        }
+        ok = filesystem_write_file(writer->filename, (char *)buf + start, size - start);
+    }
+    free(buf);
+
+    return ok;
+}
+
+bool filesystem_log_flush(filesystem_log_writer_t *writer) {
+    if (writer->length == 0) return true;
+
+    uint8_t block[FILESYSTEM_LOG_BLOCK_SIZE + 3];
+    block[0] = writer->length;
+    memcpy(block + 1, writer->buf, writer->length);
+    uint16_t checksum = _filesystem_log_checksum(block, writer->length + 1);
+    block[writer->length + 1] = checksum & 0xFF;
+    block[writer->length + 2] = checksum >> 8;
+
+    if (!_filesystem_log_make_room(writer, writer->length + 3)) return false;
+    if (!filesystem_append_file(writer->filename, (char *)block, writer->length + 3)) return false;
+
+    writer->length = 0;
+    writer->last_timestamp = 0;
+    writer->last_interval = 0;
+    writer->last_value = 0;
+
+    return true;
+}
+
+/// Encodes an entry relative to the writer's last one; returns its length.
+static uint8_t _filesystem_log_encode(filesystem_log_writer_t *writer, uint8_t *buf, uint32_t timestamp, int32_t value) {
+    uint32_t interval = timestamp - writer->last_timestamp;
+    uint8_t length = _filesystem_log_put_varint(buf, (int32_t)(interval - writer->last_interval));
+    length += _filesystem_log_put_varint(buf + length, (int32_t)((uint32_t)value - (uint32_t)writer->last_value));
+    return length;
+}
+
+bool filesystem_log_append(filesystem_log_writer_t *writer, uint32_t timestamp, int32_t value) {
+    uint8_t entry[FILESYSTEM_LOG_MAX_ENTRY_SIZE];
+    uint8_t length = _filesystem_log_encode(writer, entry, timestamp, value);
+
+    if (writer->length + length > FILESYSTEM_LOG_BLOCK_SIZE) {
+        // if the block couldn't be written, keep it and drop the new entry rather than lose a block's worth.
+        if (!filesystem_log_flush(writer)) return false;
+        // the new block starts from zero, so the entry has to be encoded again.
+        length = _filesystem_log_encode(writer, entry, timestamp, value);
+    }
+
+    memcpy(writer->buf + writer->length, entry, length);
+    writer->length += length;
+    writer->last_interval = timestamp - writer->last_timestamp;
+    writer->last_timestamp = timestamp;
+    writer->last_value = value;
+
+    return true;
+}
+
+void filesystem_log_reader_init(filesystem_log_reader_t *reader, const char *filename) {
+    memset(reader, 0, sizeof(filesystem_log_reader_t));
+    strncpy(reader->filename, filename, FILESYSTEM_LOG_FILENAME_LENGTH - 1);
+}
+
+/// Loads the next good block from the file; returns false at the end of the file.
+static bool _filesystem_log_next_block(filesystem_log_reader_t *reader) {
+    while (true) {
+        int32_t available = filesystem_read_file_at(reader->filename, (char *)reader->block, reader->offset, sizeof(reader->block));
+        if (available <= 0) return false;
+
+        uint8_t length = _filesystem_log_check_block(reader->block, available);
+        if (length) {
+            reader->offset += length + 3;
+            reader->length = length;
+            reader->pos = 0;
+            reader->timestamp = 0;
+            reader->interval = 0;
+            reader->value = 0;
+            return true;
+        }
+        // not a block we can trust; look for the next one a byte further on.
+        reader->offset++;
+        reader->damaged_bytes++;
+    }
+}
+
+bool filesystem_log_read(filesystem_log_reader_t *reader, uint32_t *timestamp, int32_t *value) {
+    int32_t delta_interval, delta_value;
+    uint8_t used = 0;
+
+    while (!used) {
+        while (reader->pos >= reader->length) {
+            if (!_filesystem_log_next_block(reader)) return false;
+        }
+
+        // entries start after the block's length byte.
+        const uint8_t *entry = reader->block + 1 + reader->pos;
+        uint8_t available = reader->length - reader->pos;
+        used = _filesystem_log_get_varint(entry, available, &delta_interval);
+        if (used) {
+            uint8_t value_used = _filesystem_log_get_varint(entry + used, available - used, &delta_value);
+            used = value_used ? used + value_used : 0;
+        }
+        // a good checksum over a truncated entry means a confused writer; skip the rest of the block.
+        if (!used) reader->pos = reader->length;
+    }
+
+    reader->pos += used;
+    reader->interval += (uint32_t)delta_interval;
+    reader->timestamp += reader->interval;
+    reader->value = (int32_t)((uint32_t)reader->value + (uint32_t)delta_value);
+    *timestamp = reader->timestamp;
+    *value = reader->value;
+
+    return true;
+}
+
+int filesystem_cmd_logcat(int argc, char *argv[]) {
+    (void) argc;
+    filesystem_log_reader_t reader;
+    uint32_t timestamp;
+    int32_t value;
+    uint32_t count = 0;
+
+    if (filesystem_get_file_size(argv[1]) < 0) {
+        printf("logcat: %s: No such file\r\n", argv[1]);
+        return 1;
+    }
+
+    filesystem_log_reader_init(&reader, argv[1]);
+    while (filesystem_log_read(&reader, &timestamp, &value)) {
+        printf("%lu %ld\r\n", (unsigned long)timestamp, (long)value);
+        count++;
+    }
+    printf("%lu entries", (unsigned long)count);
+    if (reader.damaged_bytes) printf(", %u damaged bytes skipped", reader.damaged_bytes);
+    printf("\r\n");
+
+    return 0;
+}
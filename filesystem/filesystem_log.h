@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Compact sensor logs
+ *
+ * A log is a file of timestamped integer readings, stored as the change from the reading before: how much the
+ * time since the previous entry differs from the interval before that, and the difference in value. Each is
+ * zigzag encoded (so small negative numbers stay small) and written as a varint, seven bits to a byte. A reading
+ * taken on schedule, a few tenths of a degree off the last, takes two bytes instead of the eight of a timestamp
+ * and a float.
+ *
+ * Entries are grouped into blocks of up to FILESYSTEM_LOG_BLOCK_SIZE bytes:
+ *
+ *     uint8   length of the entries that follow
+ *     ...     entries; the first is relative to a timestamp and value of zero, so every block stands alone
+ *     uint16  CRC-16/CCITT of the length and entries, little-endian
+ *
+ * The writer collects entries in RAM and appends a block to the file when it fills, or when the caller flushes
+ * it. Flushing more often loses less on a reset, at the cost of a few more bytes per block. The reader checks
+ * each block's checksum and skips damaged ones, so a torn write costs one block, not the rest of the log.
+ */
+
+#define FILESYSTEM_LOG_BLOCK_SIZE 48        ///< Largest block, not counting its length and checksum.
+#define FILESYSTEM_LOG_FILENAME_LENGTH 13   ///< Room for an 8.3 filename and its terminator.
+
+typedef struct {
+    char filename[FILESYSTEM_LOG_FILENAME_LENGTH];
+    int32_t max_size;               ///< Once the file would grow past this, its oldest blocks are dropped.
+    uint32_t last_timestamp;        ///< The entry that the next one in this block is relative to.
+    uint32_t last_interval;
+    int32_t last_value;
+    uint8_t length;                 ///< Bytes of entries waiting to be written.
+    uint8_t buf[FILESYSTEM_LOG_BLOCK_SIZE];
+} filesystem_log_writer_t;
+
+typedef struct {
+    char filename[FILESYSTEM_LOG_FILENAME_LENGTH];
+    int32_t offset;                 ///< Where in the file the next block starts.
+    uint32_t timestamp;
+    uint32_t interval;
+    int32_t value;
+    uint8_t length;                 ///< Length of the block being read, and how far into it we are.
+    uint8_t pos;
+    uint16_t damaged_bytes;         ///< Bytes skipped because they didn't belong to a block with a good checksum.
+    uint8_t block[FILESYSTEM_LOG_BLOCK_SIZE + 3];
+} filesystem_log_reader_t;
+
+/** @brief Sets up a writer for a log file, which need not exist yet.
+  * @param writer The writer; it keeps the entries that haven't been written yet, so it should live as long as the log.
+  * @param filename The log file.
+  * @param max_size The most the file may hold; older blocks are dropped to make room for new ones.
+  */
+void filesystem_log_writer_init(filesystem_log_writer_t *writer, const char *filename, int32_t max_size);
+
+/** @brief Adds an entry to the log, writing out a block if this one doesn't fit in it.
+  * @return false if a block had to be written and couldn't be. The block stays in the writer to try again, and
+  *         the new entry is dropped.
+  */
+bool filesystem_log_append(filesystem_log_writer_t *writer, uint32_t timestamp, int32_t value);
+
+/** @brief Writes out any entries waiting in the writer as a block.
+  * @return true if there was nothing to write, or the block was written.
+  */
+bool filesystem_log_flush(filesystem_log_writer_t *writer);
+
+/** @brief Sets up a reader at the start of a log file.
+  */
+void filesystem_log_reader_init(filesystem_log_reader_t *reader, const char *filename);
+
+/** @brief Reads the next entry from the log.
+  * @return false at the end of the log.
+  */
+bool filesystem_log_read(filesystem_log_reader_t *reader, uint32_t *timestamp, int32_t *value);
+
+int filesystem_cmd_logcat(int argc, char *argv[]);
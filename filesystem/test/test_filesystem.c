@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Runs the filesystem layer against littlefs built with LFS_NO_MALLOC, on a RAM copy of the RWW EEPROM.
+// With no allocator behind it, any open that still needed a heap buffer would fail with LFS_ERR_NOMEM.
+// Built and run by `make -C test`, when the littlefs submodule is checked out.
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+// built in, so the test can reach the file slot pool directly.
+#include "../filesystem.c"
+
+#define CYCLES 5000
+
+static uint8_t storage[NVMCTRL_RWWEE_PAGES * NVMCTRL_PAGE_SIZE];
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+    return true;
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    memcpy(storage + row * NVMCTRL_ROW_SIZE + offset, buffer, size);
+    return true;
+}
+
+bool watch_storage_erase(uint32_t row) {
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xFF, NVMCTRL_ROW_SIZE);
+    return true;
+}
+
+bool watch_storage_sync(void) {
+    return true;
+}
+
+static uint8_t slots_in_use(void) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < FILESYSTEM_MAX_OPEN_FILES; i++) if (_filesystem_file_slots[i].in_use) count++;
+    return count;
+}
+
+void setUp(void) {
+    memset(storage, 0xFF, sizeof(storage));
+    TEST_ASSERT_TRUE(filesystem_init());
+    TEST_ASSERT_TRUE(filesystem_write_file("cycle.txt", "0\n", 2));
+}
+
+void tearDown(void) {
+}
+
+// thousands of open/close cycles through every public entry point.
+static void test_open_close_cycles(void) {
+    char expected[32];
+    char buf[32];
+    unsigned int passed = 0;
+    for (unsigned int i = 0; i < CYCLES; i++) {
+        int length = snprintf(expected, sizeof(expected), "%u\n", i);
+        bool ok = filesystem_write_file("cycle.txt", expected, length);
+        ok = ok && filesystem_append_file("cycle.txt", "end\n", 4);
+        ok = ok && filesystem_read_file("cycle.txt", buf, length);
+        ok = ok && memcmp(buf, expected, length) == 0;
+        int32_t offset = 0;
+        ok = ok && filesystem_read_line("cycle.txt", buf, &offset, sizeof(buf) - 1);
+        ok = ok && offset == length && strncmp(buf, expected, length - 1) == 0;
+        ok = ok && filesystem_read_line("cycle.txt", buf, &offset, sizeof(buf) - 1);
+        ok = ok && strcmp(buf, "end") == 0;
+        ok = ok && slots_in_use() == 0;
+        if (!ok) break;
+        passed++;
+    }
+    printf("%u open/close cycles with %d static file slot(s)\n", passed * 5, FILESYSTEM_MAX_OPEN_FILES);
+    TEST_ASSERT_EQUAL_UINT(CYCLES, passed);
+}
+
+// a file that can't be opened doesn't hold on to its slot.
+static void test_failed_open_releases_slot(void) {
+    TEST_ASSERT_NULL(_filesystem_open("missing.txt", LFS_O_RDONLY));
+    TEST_ASSERT_EQUAL_UINT8(0, slots_in_use());
+}
+
+// once every slot is taken, the next open fails immediately instead of allocating.
+static void test_open_fails_when_slots_exhausted(void) {
+    char buf[4];
+    lfs_file_t *files[FILESYSTEM_MAX_OPEN_FILES];
+    for (uint8_t i = 0; i < FILESYSTEM_MAX_OPEN_FILES; i++) {
+        files[i] = _filesystem_open("cycle.txt", LFS_O_RDONLY);
+        TEST_ASSERT_NOT_NULL(files[i]);
+    }
+    TEST_ASSERT_NULL(_filesystem_open("cycle.txt", LFS_O_RDONLY));
+    TEST_ASSERT_FALSE(filesystem_read_file("cycle.txt", buf, 2));
+    TEST_ASSERT_TRUE(_filesystem_close(files[0]));
+    TEST_ASSERT_TRUE(filesystem_read_file("cycle.txt", buf, 2));
+    for (uint8_t i = 1; i < FILESYSTEM_MAX_OPEN_FILES; i++) TEST_ASSERT_TRUE(_filesystem_close(files[i]));
+    TEST_ASSERT_EQUAL_UINT8(0, slots_in_use());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_open_close_cycles);
+    RUN_TEST(test_failed_open_releases_slot);
+    RUN_TEST(test_open_fails_when_slots_exhausted);
+    return UNITY_END();
+}
@@ -0,0 +1,224 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Round-trips simulated sensor readings through the log codec, checks that damaged blocks are skipped and that
+// logs stay under their size limit, and compares bytes written per simulated week against appending the raw
+// eight-byte records (a watch_date_time_t and a float) that temperature_logging_face keeps.
+// Built and run by `make -C test`.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+#include "../filesystem_log.c"
+
+#define START_TIME 1767225600   // 2026-01-01 00:00:00 UTC
+#define WEEK (7 * 86400)
+#define RAW_RECORD_SIZE 8
+#define MAX_ENTRIES (WEEK / 300 + 1)
+
+static uint8_t file[16384];
+static int32_t file_size = -1;
+static uint32_t bytes_written;
+
+int32_t filesystem_get_file_size(char *filename) {
+    (void) filename;
+    return file_size;
+}
+
+bool filesystem_read_file(char *filename, char *buf, int32_t length) {
+    (void) filename;
+    if (file_size < 0) return false;
+    memcpy(buf, file, length < file_size ? length : file_size);
+    return true;
+}
+
+int32_t filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length) {
+    (void) filename;
+    if (file_size < 0) return -1;
+    if (offset >= file_size) return 0;
+    if (length > file_size - offset) length = file_size - offset;
+    memcpy(buf, file + offset, length);
+    return length;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    (void) filename;
+    memcpy(file, text, length);
+    file_size = length;
+    bytes_written += length;
+    return true;
+}
+
+bool filesystem_append_file(char *filename, char *text, int32_t length) {
+    (void) filename;
+    if (file_size < 0) file_size = 0;
+    if (file_size + length > (int32_t)sizeof(file)) return false;
+    memcpy(file + file_size, text, length);
+    file_size += length;
+    bytes_written += length;
+    return true;
+}
+
+static uint32_t timestamps[MAX_ENTRIES];
+static int32_t values[MAX_ENTRIES];
+
+// a daily swing of ten degrees around 20, in tenths of a degree, with a little sensor noise.
+static uint32_t simulate(uint32_t interval) {
+    uint32_t count = 0;
+    for (uint32_t t = START_TIME; t < START_TIME + WEEK; t += interval) {
+        timestamps[count] = t;
+        values[count] = 200 + 50 * sinf((t % 86400) * 2 * M_PI / 86400) + rand() % 5 - 2;
+        count++;
+    }
+    return count;
+}
+
+void setUp(void) {
+    srand(1);
+    file_size = -1;
+    bytes_written = 0;
+}
+
+void tearDown(void) {
+}
+
+/// Writes the readings through a writer, flushing every flush_every entries (0 to flush only when blocks fill).
+static void write_log(uint32_t count, uint8_t flush_every, int32_t max_size) {
+    filesystem_log_writer_t writer;
+    filesystem_log_writer_init(&writer, "test.log", max_size);
+    for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_TRUE(filesystem_log_append(&writer, timestamps[i], values[i]));
+        if (flush_every && (i + 1) % flush_every == 0) TEST_ASSERT_TRUE(filesystem_log_flush(&writer));
+    }
+    TEST_ASSERT_TRUE(filesystem_log_flush(&writer));
+}
+
+/// Reads the log back and checks it matches readings first..count-1.
+static void check_log(uint32_t first, uint32_t count) {
+    filesystem_log_reader_t reader;
+    uint32_t timestamp;
+    int32_t value;
+    uint32_t i = first;
+
+    filesystem_log_reader_init(&reader, "test.log");
+    while (filesystem_log_read(&reader, &timestamp, &value)) {
+        TEST_ASSERT_LESS_THAN_UINT32(count, i);
+        TEST_ASSERT_EQUAL_UINT32(timestamps[i], timestamp);
+        TEST_ASSERT_EQUAL_INT32(values[i], value);
+        i++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(count, i);
+    TEST_ASSERT_EQUAL_UINT32(0, reader.damaged_bytes);
+}
+
+/// Writes a week of readings and checks the log comes to no more than max_percent of the raw records.
+static void report(const char *name, uint32_t interval, uint8_t flush_every, uint32_t max_percent) {
+    uint32_t count = simulate(interval);
+    write_log(count, flush_every, sizeof(file));
+    check_log(0, count);
+
+    uint32_t raw = count * RAW_RECORD_SIZE;
+    printf("%-36s %6lu readings %6lu raw bytes %6lu log bytes (%.0f%%)\n", name, (unsigned long)count,
+           (unsigned long)raw, (unsigned long)bytes_written, bytes_written * 100.0 / raw);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(raw * max_percent, bytes_written * 100);
+}
+
+static void test_hourly_flushed_every_six(void) {
+    report("hourly, flushed every 6 readings", 3600, 6, 55);
+}
+
+static void test_hourly_flushed_when_full(void) {
+    report("hourly, flushed when a block fills", 3600, 0, 40);
+}
+
+static void test_five_minutes_flushed_every_twelve(void) {
+    report("every 5 minutes, flushed every 12", 300, 12, 40);
+}
+
+static void test_five_minutes_flushed_when_full(void) {
+    report("every 5 minutes, flushed when full", 300, 0, 40);
+}
+
+// extremes and clocks going backwards survive the trip.
+static void test_extremes_round_trip(void) {
+    uint32_t edge_timestamps[] = {0, UINT32_MAX, 5, 4, 1767225600, 1767225600};
+    int32_t edge_values[] = {INT32_MIN, INT32_MAX, 0, -1, 1, -100000};
+    memcpy(timestamps, edge_timestamps, sizeof(edge_timestamps));
+    memcpy(values, edge_values, sizeof(edge_values));
+    write_log(6, 0, sizeof(file));
+    check_log(0, 6);
+}
+
+// a damaged block costs only its own entries.
+static void test_damaged_block_is_skipped(void) {
+    uint32_t count = simulate(3600);
+    write_log(count, 6, sizeof(file));
+    file[30] ^= 0x10;   // somewhere in the second block
+    filesystem_log_reader_t reader;
+    uint32_t timestamp;
+    int32_t value;
+    uint32_t read = 0;
+    filesystem_log_reader_init(&reader, "test.log");
+    while (filesystem_log_read(&reader, &timestamp, &value)) {
+        uint32_t i = read < 6 ? read : read + 6;
+        TEST_ASSERT_EQUAL_UINT32(timestamps[i], timestamp);
+        TEST_ASSERT_EQUAL_INT32(values[i], value);
+        read++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(count - 6, read);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, reader.damaged_bytes);
+}
+
+// a size limit drops the oldest blocks, and what's left reads back as the newest readings.
+static void test_size_limit_keeps_newest(void) {
+    uint32_t count = simulate(3600);
+    write_log(count, 6, 200);
+    TEST_ASSERT_LESS_OR_EQUAL_INT32(200, file_size);
+    filesystem_log_reader_t reader;
+    uint32_t timestamp;
+    int32_t value;
+    filesystem_log_reader_init(&reader, "test.log");
+    TEST_ASSERT_TRUE(filesystem_log_read(&reader, &timestamp, &value));
+    uint32_t first = 0;
+    while (first < count && timestamps[first] != timestamp) first++;
+    TEST_ASSERT_GREATER_THAN_UINT32(0, first);
+    TEST_ASSERT_LESS_THAN_UINT32(count, first);
+    check_log(first, count);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hourly_flushed_every_six);
+    RUN_TEST(test_hourly_flushed_when_full);
+    RUN_TEST(test_five_minutes_flushed_every_twelve);
+    RUN_TEST(test_five_minutes_flushed_when_full);
+    RUN_TEST(test_extremes_round_trip);
+    RUN_TEST(test_damaged_block_is_skipped);
+    RUN_TEST(test_size_limit_keeps_newest);
+    return UNITY_END();
+}
@@ -26,12 +26,21 @@
 #include <string.h>
 
 #include "smallchesslib.h"
+#include "smallchess_search.h"
 
 #include "smallchess_face.h"
 #include "watch.h"
 
 #define PIECE_LIST_END_MARKER 0xff
 
+// while thinking, the search takes this many positions per tick, a small fraction of a tick at 16 MHz.
+#ifndef SMALLCHESS_SEARCH_TICK_FREQUENCY
+#define SMALLCHESS_SEARCH_TICK_FREQUENCY 8
+#endif
+#ifndef SMALLCHESS_SEARCH_NODES_PER_TICK
+#define SMALLCHESS_SEARCH_NODES_PER_TICK 48
+#endif
+
 int8_t cpu_done_beep[] = {BUZZER_NOTE_C5, 5, BUZZER_NOTE_C6, 5, BUZZER_NOTE_C7, 5, 0};
 
 static void smallchess_init_board(smallchess_face_state_t *state) {
@@ -75,26 +84,55 @@ static void _smallchess_calc_moveable_pieces(smallchess_face_state_t *state) {
     state->moveable_pieces_idx = 0;
 }
 
-static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
-    char ai_from_str[3] = {0};
-    char ai_to_str[3] = {0};
-    uint8_t rep_from, rep_to;
-    char ai_prom;
+static void _smallchess_stop_ai_move(smallchess_face_state_t *state) {
+    free(state->search);
+    state->search = NULL;
+    movement_request_tick_frequency(1);
+}
 
-    watch_clear_display();
-    watch_start_character_blink('C', 100);
-    SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
+/* runs one slice of the search, at full speed; returns true once it's finished */
+static bool _smallchess_think(smallchess_face_state_t *state) {
+    bool done;
 
 #ifndef __EMSCRIPTEN__
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
 #endif
-    SCL_getAIMove(state->game, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
+    done = smallchess_search_step((smallchess_search_t *)state->search, SMALLCHESS_SEARCH_NODES_PER_TICK);
 #ifndef __EMSCRIPTEN__
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
 #endif
 
+    return done;
+}
+
+static void _smallchess_start_ai_move(smallchess_face_state_t *state) {
+    uint8_t rep_from, rep_to;
+
+    SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
+    state->search = malloc(sizeof(smallchess_search_t));
+    smallchess_search_start((smallchess_search_t *)state->search, ((SCL_Game *)state->game)->board, rep_from, rep_to);
+    state->state = SMALLCHESS_THINKING;
+
+    /* the search continues on each tick; take the first slice now so there's always a move to play */
+    movement_request_tick_frequency(SMALLCHESS_SEARCH_TICK_FREQUENCY);
+    _smallchess_think(state);
+}
+
+/* plays the best move found so far, whether or not the search has finished */
+static void _smallchess_finish_ai_move(smallchess_face_state_t *state) {
+    char ai_from_str[3] = {0};
+    char ai_to_str[3] = {0};
+    char ai_prom;
+    bool have_move = smallchess_search_get_move((smallchess_search_t *)state->search, &state->ai_from_square, &state->ai_to_square, &ai_prom);
+
+    _smallchess_stop_ai_move(state);
+    if (!have_move) {
+        /* no legal moves; shouldn't happen, since the game would have ended */
+        state->state = SMALLCHESS_SELECT_PIECE;
+        return;
+    }
+
     SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, ai_prom);
-    watch_stop_blink();
 
     watch_buzzer_play_sequence(cpu_done_beep, NULL);
 
@@ -105,6 +143,22 @@ static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
 
     /* now cache the list of legal pieces we can move */
     _smallchess_calc_moveable_pieces(state);
+    state->state = SMALLCHESS_SHOW_CPU_MOVE;
+}
+
+/* abandons the search and takes back the move the CPU was answering */
+static void _smallchess_cancel_ai_move(smallchess_face_state_t *state) {
+    _smallchess_stop_ai_move(state);
+
+    if (((SCL_Game *)state->game)->ply == 0) {
+        /* the CPU was opening a new game as white; there's nothing to take back */
+        state->state = SMALLCHESS_MENU_NEW_BLACK;
+        return;
+    }
+
+    SCL_gameUndoMove((SCL_Game *)state->game);
+    _smallchess_calc_moveable_pieces(state);
+    state->state = SMALLCHESS_SELECT_PIECE;
 }
 
 static char _smallchess_make_lowercase(char c) {
@@ -200,6 +254,9 @@ static void _smallchess_face_update_lcd(smallchess_face_state_t *state) {
                     start_coord,
                     end_coord);
             break;
+        case SMALLCHESS_THINKING:
+            snprintf(buf, sizeof(buf), "C %2d Srch%d", ply + 1, ((smallchess_search_t *)state->search)->completed_depth);
+            break;
         default:
             break;
     }
@@ -231,8 +288,7 @@ static void _smallchess_select_main_menu_subitem(smallchess_face_state_t *state)
         case SMALLCHESS_MENU_NEW_BLACK:
             SCL_gameInit((SCL_Game *)state->game, 0);
             /* force a move since black is playing */
-            _smallchess_make_ai_move(state);
-            state->state = SMALLCHESS_SHOW_CPU_MOVE;
+            _smallchess_start_ai_move(state);
             break;
         case SMALLCHESS_MENU_SHOW_LAST_MOVE:
             /* fetch the move */
@@ -355,8 +411,7 @@ static void _smallchess_handle_select_dest_button_event(smallchess_face_state_t
 
             /* if the player didn't win or draw here, calculate a move */
             if (((SCL_Game *)state->game)->state == SCL_GAME_STATE_PLAYING) {
-                _smallchess_make_ai_move(state);
-                state->state = SMALLCHESS_SHOW_CPU_MOVE;
+                _smallchess_start_ai_move(state);
             } else {
                 /* player ended the game through mate or draw; jump to select piece screen to show state */
                 state->state = SMALLCHESS_SELECT_PIECE;
@@ -381,6 +436,19 @@ static void _smallchess_handle_show_cpu_move_button_event(smallchess_face_state_
     }
 }
 
+static void _smallchess_handle_thinking_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            _smallchess_finish_ai_move(state);
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            _smallchess_cancel_ai_move(state);
+            break;
+        default:
+            break;
+    }
+}
+
 static void _smallchess_handle_show_last_move_button_event(smallchess_face_state_t *state, movement_event_t event) {
     switch (event.event_type) {
         case EVENT_ALARM_BUTTON_UP:
@@ -403,6 +471,8 @@ static void _smallchess_handle_playing_button_event(smallchess_face_state_t *sta
         _smallchess_handle_show_cpu_move_button_event(state, event);
     } else if (state->state == SMALLCHESS_SHOW_LAST_MOVE) {
         _smallchess_handle_show_last_move_button_event(state, event);
+    } else if (state->state == SMALLCHESS_THINKING) {
+        _smallchess_handle_thinking_button_event(state, event);
     }
 }
 
@@ -481,6 +551,12 @@ bool smallchess_face_loop(movement_event_t event, void *context) {
             _smallchess_face_update_lcd(state);
             break;
         case EVENT_TICK:
+            if (state->state == SMALLCHESS_THINKING) {
+                if (_smallchess_think(state)) {
+                    _smallchess_finish_ai_move(state);
+                }
+                _smallchess_face_update_lcd(state);
+            }
             break;
         case EVENT_TIMEOUT:
             break;
@@ -495,6 +571,11 @@ bool smallchess_face_loop(movement_event_t event, void *context) {
 }
 
 void smallchess_face_resign(void *context) {
-    (void) context;
+    smallchess_face_state_t *state = (smallchess_face_state_t *)context;
+
+    /* leaving mid-search; take the move back so it's the player's turn on return */
+    if (state->state == SMALLCHESS_THINKING) {
+        _smallchess_cancel_ai_move(state);
+    }
     watch_set_led_off();
 }
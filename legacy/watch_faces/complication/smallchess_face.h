@@ -40,6 +40,12 @@
  * - Alarm button: navigate forwards through the current menu
  * - Light button (long press): navigate up to the parent menu
  * - Alarm button (long press): select the current item or submenu
+ *
+ * While the watch is thinking about its move, the display shows "C", the move number, "Srch" and the deepest
+ * search finished so far. The search looks at a few dozen positions at a time on a fast tick and lets the watch
+ * sleep in between, so the buttons keep working:
+ * - Alarm button: stop thinking and play the best move found so far
+ * - Light button: stop thinking and take back your move
  */
 
 enum smallchess_state {
@@ -57,6 +63,7 @@ enum smallchess_state {
     SMALLCHESS_SHOW_CPU_MOVE,
     SMALLCHESS_SELECT_PIECE,
     SMALLCHESS_SELECT_DEST,
+    SMALLCHESS_THINKING,
 };
 
 #define NUM_ELEMENTS(a) (sizeof(a) / sizeof(a[0]))
@@ -72,6 +79,7 @@ typedef struct {
     uint8_t moveable_dests_idx;
     char last_move_str[7];
     uint8_t ai_from_square, ai_to_square;
+    void *search; // only allocated while the CPU is thinking
 } smallchess_face_state_t;
 
 void smallchess_face_setup(uint8_t watch_face_index, void ** context_ptr);
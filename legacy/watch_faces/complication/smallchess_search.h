@@ -0,0 +1,378 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SMALLCHESS_SEARCH_H_
+#define SMALLCHESS_SEARCH_H_
+
+/*
+ * Resumable chess search for smallchess_face
+ *
+ * SCL_getAIMove searches recursively and doesn't return until it's done, which on the watch means seconds with
+ * the CPU flat out and no ticks or buttons. This is the same kind of search (negamax with alpha-beta pruning over
+ * smallchesslib's move generator and static evaluation), but the recursion lives in an explicit stack, so it can
+ * stop after any number of nodes and pick up where it left off on the next tick.
+ *
+ * It deepens iteratively, one ply at a time up to SMALLCHESS_SEARCH_MAX_DEPTH, and keeps the best move of the
+ * last depth it finished, so it can be told to stop at any point. Moves are tried best-first: the move a small
+ * transposition table remembers for the position, then captures of the most valuable piece by the least valuable
+ * one, then everything else.
+ *
+ * Like smallchesslib, this is an implementation header: include it from one source file, after smallchesslib.h.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// iterative deepening stops after this depth...
+#ifndef SMALLCHESS_SEARCH_MAX_DEPTH
+#define SMALLCHESS_SEARCH_MAX_DEPTH 4
+#endif
+
+// ...or once it has searched this many positions, whichever comes first.
+#ifndef SMALLCHESS_SEARCH_MAX_NODES
+#define SMALLCHESS_SEARCH_MAX_NODES 8000
+#endif
+
+// room for the moves of every position on the current line; a position that doesn't fit is evaluated statically.
+#ifndef SMALLCHESS_SEARCH_MAX_MOVES
+#define SMALLCHESS_SEARCH_MAX_MOVES 256
+#endif
+
+// transposition table entries; must be a power of two.
+#ifndef SMALLCHESS_SEARCH_TT_SIZE
+#define SMALLCHESS_SEARCH_TT_SIZE 128
+#endif
+
+#define SMALLCHESS_SEARCH_NEW_NODE 0xFFFF
+#define SMALLCHESS_SEARCH_MATE_BOUND (SCL_EVALUATION_MAX_SCORE - 100)
+
+typedef enum {
+    SMALLCHESS_BOUND_EXACT = 0,
+    SMALLCHESS_BOUND_LOWER,
+    SMALLCHESS_BOUND_UPPER,
+} smallchess_bound_t;
+
+typedef struct {
+    uint8_t from;
+    uint8_t to;
+    uint8_t order;  // higher is tried first
+} smallchess_move_t;
+
+typedef struct {
+    uint16_t key;
+    int16_t score;
+    uint8_t depth;
+    uint8_t bound;
+    uint8_t from;
+    uint8_t to;
+} smallchess_tt_entry_t;
+
+typedef struct {
+    SCL_MoveUndo undo;      // undoes the move this position last made
+    uint32_t hash;
+    uint16_t first_move;    // this position's moves in the move stack
+    uint16_t num_moves;
+    uint16_t next_move;     // SMALLCHESS_SEARCH_NEW_NODE until the moves are generated
+    int16_t alpha;
+    int16_t beta;
+    int16_t alpha_at_entry;
+    int16_t best;
+    uint8_t best_from;
+    uint8_t best_to;
+    uint8_t depth;          // plies left to search below this position
+} smallchess_frame_t;
+
+typedef struct {
+    SCL_Board board;        // a copy; the search plays moves on it and takes them back
+    smallchess_frame_t stack[SMALLCHESS_SEARCH_MAX_DEPTH + 1];
+    smallchess_move_t moves[SMALLCHESS_SEARCH_MAX_MOVES];
+    smallchess_tt_entry_t tt[SMALLCHESS_SEARCH_TT_SIZE];
+    uint32_t nodes;
+    uint8_t ply;
+    uint8_t depth;          // depth of the iteration in progress
+    uint8_t completed_depth;
+    uint8_t best_from;      // best move of the deepest finished iteration
+    uint8_t best_to;
+    int16_t best_score;
+    uint8_t avoid_from;     // a move that would repeat the position, not to be played at the root
+    uint8_t avoid_to;
+    bool done;
+} smallchess_search_t;
+
+static uint32_t _smallchess_search_hash(SCL_Board board) {
+    // FNV-1a over the squares and the en passant/castling byte, plus the side to move.
+    uint32_t hash = 2166136261u;
+    for (uint8_t i = 0; i <= SCL_BOARD_ENPASSANT_CASTLE_BYTE; i++) hash = (hash ^ (uint8_t)board[i]) * 16777619u;
+    return (hash ^ SCL_boardWhitesTurn(board)) * 16777619u;
+}
+
+static int16_t _smallchess_search_evaluate(smallchess_search_t *search) {
+    int16_t score = SCL_boardEvaluateStatic(search->board);
+    if (!SCL_boardWhitesTurn(search->board)) score = -score;
+    // prefer the quickest mate, and the slowest to be mated.
+    if (score <= -SCL_EVALUATION_MAX_SCORE) return -(SCL_EVALUATION_MAX_SCORE - search->ply);
+    if (score >= SCL_EVALUATION_MAX_SCORE) return SCL_EVALUATION_MAX_SCORE - search->ply;
+    return score;
+}
+
+/// Fills the move stack with the legal moves of the current position, from first; returns how many there were, or
+/// SMALLCHESS_SEARCH_NEW_NODE if they didn't all fit.
+static uint16_t _smallchess_search_generate(smallchess_search_t *search, uint16_t first, uint8_t hash_from, uint8_t hash_to) {
+    uint16_t count = 0;
+    uint8_t white = SCL_boardWhitesTurn(search->board);
+
+    for (uint8_t square = 0; square < SCL_BOARD_SQUARES; square++) {
+        char piece = search->board[square];
+        if (piece == '.' || SCL_pieceIsWhite(piece) != white) continue;
+
+        SCL_SquareSet moves;
+        SCL_squareSetClear(moves);
+        SCL_boardGetMoves(search->board, square, moves);
+
+        SCL_SQUARE_SET_ITERATE_BEGIN(moves)
+            if (first + count >= SMALLCHESS_SEARCH_MAX_MOVES) return SMALLCHESS_SEARCH_NEW_NODE;
+            smallchess_move_t *move = &search->moves[first + count];
+            char victim = search->board[iteratedSquare];
+            move->from = square;
+            move->to = iteratedSquare;
+            if (square == hash_from && iteratedSquare == hash_to) {
+                move->order = 255;
+            } else if (victim != '.') {
+                // most valuable victim, least valuable attacker.
+                move->order = 128 + SCL_pieceValuePositive(victim) / 64 - SCL_pieceValuePositive(piece) / 256;
+            } else if ((piece == 'P' && iteratedSquare >= 56) || (piece == 'p' && iteratedSquare < 8)) {
+                move->order = 120;
+            } else {
+                move->order = 0;
+            }
+            count++;
+        SCL_SQUARE_SET_ITERATE_END
+    }
+
+    return count;
+}
+
+static void _smallchess_search_enter(smallchess_search_t *search, uint8_t depth, int16_t alpha, int16_t beta) {
+    smallchess_frame_t *frame = &search->stack[search->ply];
+    frame->depth = depth;
+    frame->alpha = alpha;
+    frame->alpha_at_entry = alpha;
+    frame->beta = beta;
+    frame->best = -SCL_EVALUATION_MAX_SCORE - 1;
+    frame->best_from = frame->best_to = 0;
+    frame->num_moves = 0;
+    frame->next_move = SMALLCHESS_SEARCH_NEW_NODE;
+    frame->first_move = search->ply ? search->stack[search->ply - 1].first_move + search->stack[search->ply - 1].num_moves : 0;
+}
+
+static void _smallchess_search_store(smallchess_search_t *search, smallchess_frame_t *frame) {
+    smallchess_tt_entry_t *entry = &search->tt[frame->hash & (SMALLCHESS_SEARCH_TT_SIZE - 1)];
+    int16_t score = frame->best;
+    // mate scores are stored relative to this position, not the root.
+    if (score > SMALLCHESS_SEARCH_MATE_BOUND) score += search->ply;
+    else if (score < -SMALLCHESS_SEARCH_MATE_BOUND) score -= search->ply;
+    entry->key = frame->hash >> 16;
+    entry->score = score;
+    entry->depth = frame->depth;
+    entry->from = frame->best_from;
+    entry->to = frame->best_to;
+    if (frame->best >= frame->beta) entry->bound = SMALLCHESS_BOUND_LOWER;
+    else if (frame->best <= frame->alpha_at_entry) entry->bound = SMALLCHESS_BOUND_UPPER;
+    else entry->bound = SMALLCHESS_BOUND_EXACT;
+}
+
+static void _smallchess_search_begin_iteration(smallchess_search_t *search) {
+    search->ply = 0;
+    _smallchess_search_enter(search, search->depth, -SCL_EVALUATION_MAX_SCORE - 1, SCL_EVALUATION_MAX_SCORE + 1);
+}
+
+/// Hands a finished position's score (from the point of view of the side to move there) back to its parent.
+static void _smallchess_search_return(smallchess_search_t *search, int16_t score) {
+    if (search->ply == 0) {
+        smallchess_frame_t *root = &search->stack[0];
+        if (root->num_moves) {
+            search->best_from = root->best_from;
+            search->best_to = root->best_to;
+            search->best_score = root->best;
+            search->completed_depth = search->depth;
+        }
+        // no point looking deeper with no moves, or once a mate is certain.
+        if (root->num_moves == 0 || search->depth >= SMALLCHESS_SEARCH_MAX_DEPTH ||
+            root->best > SMALLCHESS_SEARCH_MATE_BOUND || root->best < -SMALLCHESS_SEARCH_MATE_BOUND) {
+            search->done = true;
+        } else {
+            search->depth++;
+            _smallchess_search_begin_iteration(search);
+        }
+        return;
+    }
+
+    search->ply--;
+    smallchess_frame_t *frame = &search->stack[search->ply];
+    SCL_boardUndoMove(search->board, frame->undo);
+
+    int16_t value = -score;
+    if (value > frame->best) {
+        smallchess_move_t *move = &search->moves[frame->first_move + frame->next_move - 1];
+        frame->best = value;
+        frame->best_from = move->from;
+        frame->best_to = move->to;
+    }
+    if (value > frame->alpha) frame->alpha = value;
+    // the opponent won't allow this line; skip the remaining moves.
+    if (frame->alpha >= frame->beta) frame->next_move = frame->num_moves;
+}
+
+/// Does one unit of work: visits a new position, or plays the next move of the current one, or finishes it.
+static void _smallchess_search_advance(smallchess_search_t *search) {
+    smallchess_frame_t *frame = &search->stack[search->ply];
+
+    if (frame->next_move == SMALLCHESS_SEARCH_NEW_NODE) {
+        search->nodes++;
+        if (frame->depth == 0) {
+            _smallchess_search_return(search, _smallchess_search_evaluate(search));
+            return;
+        }
+
+        frame->hash = _smallchess_search_hash(search->board);
+        smallchess_tt_entry_t *entry = &search->tt[frame->hash & (SMALLCHESS_SEARCH_TT_SIZE - 1)];
+        uint8_t hash_from = 0xFF, hash_to = 0xFF;
+        if (entry->key == (frame->hash >> 16)) {
+            hash_from = entry->from;
+            hash_to = entry->to;
+            if (search->ply > 0 && entry->depth >= frame->depth) {
+                int16_t score = entry->score;
+                if (score > SMALLCHESS_SEARCH_MATE_BOUND) score -= search->ply;
+                else if (score < -SMALLCHESS_SEARCH_MATE_BOUND) score += search->ply;
+                if (entry->bound == SMALLCHESS_BOUND_EXACT ||
+                    (entry->bound == SMALLCHESS_BOUND_LOWER && score >= frame->beta) ||
+                    (entry->bound == SMALLCHESS_BOUND_UPPER && score <= frame->alpha)) {
+                    _smallchess_search_return(search, score);
+                    return;
+                }
+            }
+        }
+
+        uint16_t count = _smallchess_search_generate(search, frame->first_move, hash_from, hash_to);
+        if (count == SMALLCHESS_SEARCH_NEW_NODE) {
+            // out of room for moves; settle for the static evaluation.
+            _smallchess_search_return(search, _smallchess_search_evaluate(search));
+            return;
+        }
+        if (count == 0) {
+            frame->num_moves = 0;
+            bool in_check = SCL_boardCheck(search->board, SCL_boardWhitesTurn(search->board));
+            _smallchess_search_return(search, in_check ? -(SCL_EVALUATION_MAX_SCORE - search->ply) : 0);
+            return;
+        }
+        frame->num_moves = count;
+        frame->next_move = 0;
+        return;
+    }
+
+    if (frame->next_move >= frame->num_moves) {
+        if (frame->best < -SCL_EVALUATION_MAX_SCORE) {
+            // only possible at the root, when the one move left is the repetition we were told to avoid.
+            frame->best = -SCL_EVALUATION_MAX_SCORE;
+        } else {
+            _smallchess_search_store(search, frame);
+        }
+        _smallchess_search_return(search, frame->best);
+        return;
+    }
+
+    // pick the most promising move left, and swap it into place.
+    smallchess_move_t *moves = &search->moves[frame->first_move];
+    uint16_t pick = frame->next_move;
+    for (uint16_t i = pick + 1; i < frame->num_moves; i++) {
+        if (moves[i].order > moves[pick].order) pick = i;
+    }
+    smallchess_move_t move = moves[pick];
+    moves[pick] = moves[frame->next_move];
+    moves[frame->next_move] = move;
+    frame->next_move++;
+
+    if (search->ply == 0 && move.from == search->avoid_from && move.to == search->avoid_to && frame->num_moves > 1) return;
+
+    frame->undo = SCL_boardMakeMove(search->board, move.from, move.to, 'q');
+    search->ply++;
+    _smallchess_search_enter(search, frame->depth - 1, -frame->beta, -frame->alpha);
+}
+
+/// Sets up a search for the side to move on board. avoid_from and avoid_to name a move not to play (as returned by
+/// SCL_gameGetRepetiotionMove), or pass the same square twice for none.
+static void smallchess_search_start(smallchess_search_t *search, SCL_Board board, uint8_t avoid_from, uint8_t avoid_to) {
+    SCL_boardCopy(board, search->board);
+    memset(search->tt, 0, sizeof(search->tt));
+    search->nodes = 0;
+    search->depth = 1;
+    search->completed_depth = 0;
+    search->best_from = search->best_to = 0;
+    search->best_score = 0;
+    search->avoid_from = avoid_from;
+    search->avoid_to = avoid_to;
+    search->done = false;
+    _smallchess_search_begin_iteration(search);
+}
+
+/// Searches at most node_budget more positions.
+/// @return true once the search is finished, either because it reached SMALLCHESS_SEARCH_MAX_DEPTH or
+///         SMALLCHESS_SEARCH_MAX_NODES, or because there was nothing to search.
+static bool smallchess_search_step(smallchess_search_t *search, uint16_t node_budget) {
+    uint32_t stop_at = search->nodes + node_budget;
+    while (!search->done && search->nodes < stop_at) {
+        if (search->nodes >= SMALLCHESS_SEARCH_MAX_NODES) {
+            search->done = true;
+            break;
+        }
+        _smallchess_search_advance(search);
+    }
+
+    return search->done;
+}
+
+/// Returns the best move found so far; the search can be stopped early to play it. Returns false if the side to
+/// move has no moves, or the search hasn't taken its first step yet.
+static bool smallchess_search_get_move(smallchess_search_t *search, uint8_t *from, uint8_t *to, char *promotion) {
+    smallchess_frame_t *root = &search->stack[0];
+    *promotion = 'q';
+    if (search->completed_depth) {
+        *from = search->best_from;
+        *to = search->best_to;
+        return true;
+    }
+    if (root->next_move == SMALLCHESS_SEARCH_NEW_NODE || root->num_moves == 0) return false;
+    // stopped during the first iteration: take the best move the root has seen so far, or its most promising one.
+    if (root->best >= -SCL_EVALUATION_MAX_SCORE) {
+        *from = root->best_from;
+        *to = root->best_to;
+    } else {
+        *from = search->moves[root->first_move].from;
+        *to = search->moves[root->first_move].to;
+    }
+    return true;
+}
+
+#endif // SMALLCHESS_SEARCH_H_
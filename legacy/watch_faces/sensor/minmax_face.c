@@ -25,55 +25,25 @@
 #include <stdlib.h>
 #include <string.h>
 #include "minmax_face.h"
-#include "thermistor_driver.h"
+#include "temperature_archive.h"
 #include "watch.h"
 
 
-static float _get_displayed_temperature_c(minmax_state_t *state){
-    float min_temp = 1000;
-    float max_temp = -1000;
-    for(int i = 0; i < LOGGING_DATA_POINTS; i++){
-      if(state->hourly_maxs[i] > max_temp){
-	  max_temp = state->hourly_maxs[i];
-	}
-      if(state->hourly_mins[i] < min_temp){
-	  min_temp = state->hourly_mins[i];
-	}
-    }
-    if(state->show_min) return min_temp;
-    return max_temp;
-}
-
-
-static void _minmax_face_log_data(minmax_state_t *logger_state) {
-    thermistor_driver_enable();
-    size_t pos = (size_t) watch_rtc_get_date_time().unit.hour;
-    float temp_c = thermistor_driver_get_temperature();
-    // If no data yet, initialise with current temperature
-    if(!logger_state->have_logged){
-      logger_state->have_logged = true;
-      for(int i=0; i<LOGGING_DATA_POINTS; i++){
-	logger_state->hourly_mins[i] = temp_c;
-	logger_state->hourly_maxs[i] = temp_c;
-      }
-    }
-    // On new hour, update lists to current temperature
-    else if(watch_rtc_get_date_time().unit.minute < 2){
-      logger_state->hourly_mins[pos] = temp_c;
-      logger_state->hourly_maxs[pos] = temp_c;
-    }
-    // Log hourly highs and lows
-    else if(logger_state->hourly_mins[pos] > temp_c){
-      logger_state->hourly_mins[pos] = temp_c;
-    }
-    else if(logger_state->hourly_maxs[pos] < temp_c){
-      logger_state->hourly_maxs[pos] = temp_c;
-    }
-    thermistor_driver_disable();
+static bool _get_displayed_temperature_c(minmax_state_t *state, float *temperature_c){
+    float min_temp, max_temp;
+    if (!temperature_archive_get_range(TEMPERATURE_ARCHIVE_HOURS, &min_temp, &max_temp)) return false;
+    *temperature_c = state->show_min ? min_temp : max_temp;
+    return true;
 }
 
-static void _minmax_face_update_display(float temperature_c, bool in_fahrenheit) {
+static void _minmax_face_update_display(minmax_state_t *state, bool in_fahrenheit) {
     char buf[14];
+    float temperature_c;
+    if (!_get_displayed_temperature_c(state, &temperature_c)) {
+        // nothing logged yet
+        watch_display_string("  --  ", 4);
+        return;
+    }
     if (in_fahrenheit) {
         sprintf(buf, "%4.0f#F", temperature_c * 1.8 + 32.0);
     } else {
@@ -100,18 +70,15 @@ void minmax_face_activate(void *context) {
 
 bool minmax_face_loop(movement_event_t event, void *context) {
     minmax_state_t *state = (minmax_state_t *)context;
-    float temp_c;
 
     switch (event.event_type) {
 	case EVENT_ACTIVATE:
-	    temp_c = _get_displayed_temperature_c(state);
-	    _minmax_face_update_display(temp_c, movement_use_imperial_units());
+	    _minmax_face_update_display(state, movement_use_imperial_units());
             break;
 
 	case EVENT_LIGHT_LONG_PRESS:
         movement_set_use_imperial_units(!movement_use_imperial_units());
-	    temp_c = _get_displayed_temperature_c(state);
-	    _minmax_face_update_display(temp_c, movement_use_imperial_units());
+	    _minmax_face_update_display(state, movement_use_imperial_units());
             break;
 
 	case EVENT_ALARM_BUTTON_UP:
@@ -121,16 +88,12 @@ bool minmax_face_loop(movement_event_t event, void *context) {
 	    } else {
 		watch_display_string("MX", 0);
 	    }
-	    temp_c = _get_displayed_temperature_c(state);
-	    _minmax_face_update_display(temp_c, movement_use_imperial_units());
+	    _minmax_face_update_display(state, movement_use_imperial_units());
             break;
 
 	case EVENT_TIMEOUT:
             movement_move_to_face(0);
             break;
-	case EVENT_BACKGROUND_TASK:
-            _minmax_face_log_data(state);
-            break;
         default:
             return movement_default_loop_handler(event);
     }
@@ -142,14 +105,3 @@ void minmax_face_resign(void *context) {
     (void) context;
 }
 
-
-movement_watch_face_advisory_t minmax_face_advise(void *context) {
-    (void) context;
-
-    // this will get called at the top of each minute; always request bg task
-    movement_watch_face_advisory_t retval = {
-        .wants_background_task = 1,
-    };
-
-    return retval;
-}
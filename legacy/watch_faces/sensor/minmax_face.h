@@ -28,15 +28,12 @@
 #include "movement.h"
 #include "watch.h"
 
-#define LOGGING_DATA_POINTS (24)
-
 /*
  * Log for the min. and max. temperature over the last 24h.
  *
- * Temperature is logged once a minute, every minute. Results are
- * stored, noting the highest and lowest temperatures observed within
- * any given hour. The watch face then displays the minimum or maximum
- * temperature recorded over the last 24h.
+ * Movement's temperature archive notes the highest and lowest
+ * temperatures observed within each hour. The watch face displays the
+ * minimum or maximum temperature recorded over the last 24h.
  *
  * A long press of the light button changes units between Celsius and
  * Fahrenheit. Pressing the alarm button switches between displaying the
@@ -46,23 +43,19 @@
 
 typedef struct {
   bool show_min;
-  bool have_logged;
-  float hourly_mins[LOGGING_DATA_POINTS];
-  float hourly_maxs[LOGGING_DATA_POINTS];
 } minmax_state_t;
 
 void minmax_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void minmax_face_activate(void *context);
 bool minmax_face_loop(movement_event_t event, void *context);
 void minmax_face_resign(void *context);
-movement_watch_face_advisory_t minmax_face_advise(void *context);
 
 #define minmax_face ((const watch_face_t){ \
     minmax_face_setup, \
     minmax_face_activate, \
     minmax_face_loop, \
     minmax_face_resign, \
-    minmax_face_advise, \
+    NULL, \
 })
 
 #endif // MINMAX_FACE_H_
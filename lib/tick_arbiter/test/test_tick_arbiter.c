@@ -0,0 +1,217 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Runs mixed tick workloads against a simulated RTC, and counts how often the watch wakes compared with one
+// periodic interrupt per rate and a tick never slower than 1 Hz. A wake is any 128th of a second in which the
+// periodic interrupt or the alarm fires, since the RTC handles both in the same interrupt.
+// Built and run by `make -C test`.
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+#include "../tick_arbiter.c"
+
+#define CLIENT_FACE 0
+#define CLIENT_FAST 1
+#define DURATION (600 * TICK_ARBITER_TICKS_PER_SECOND)
+
+typedef struct {
+    const char *name;
+    uint32_t face_period;       // in 128ths of a second
+    uint32_t fast_every;        // the fast client runs for fast_length 128ths at the start of every fast_every
+    uint32_t fast_length;
+} workload_t;
+
+typedef struct {
+    uint32_t wakes;
+    uint32_t ticks[TICK_ARBITER_MAX_CLIENTS];
+    bool misplaced;             // a slow tick landed on a second its period doesn't divide
+} result_t;
+
+static void reset_arbiter(void) {
+    memset(_tick_arbiter_periods, 0, sizeof(_tick_arbiter_periods));
+    _tick_arbiter_frequency = 0;
+    _tick_arbiter_phase = 0;
+    _tick_arbiter_last_second = UINT16_MAX;
+}
+
+void setUp(void) {
+    reset_arbiter();
+}
+
+void tearDown(void) {
+}
+
+static bool fast_wanted(const workload_t *w, uint32_t t) {
+    return w->fast_every && t % w->fast_every < w->fast_length;
+}
+
+/// Counts wakes with the arbiter deciding what the RTC does, the way Movement drives it.
+static result_t run_arbiter(const workload_t *w) {
+    result_t result = {0};
+    int alarm_second = 0;
+    reset_arbiter();
+    tick_arbiter_set_period(CLIENT_FACE, w->face_period);
+
+    for (uint32_t t = 0; t < DURATION; t++) {
+        uint16_t second_of_hour = (t / TICK_ARBITER_TICKS_PER_SECOND) % 3600;
+        uint8_t second = second_of_hour % 60;
+
+        // buttons and the LED turn the fast client on and off from their own interrupts.
+        if (tick_arbiter_set_period(CLIENT_FAST, fast_wanted(w, t) ? 1 : 0)) {
+            alarm_second = tick_arbiter_next_alarm_second(second);
+        }
+
+        uint8_t frequency = tick_arbiter_get_frequency();
+        bool periodic = frequency && t % (TICK_ARBITER_TICKS_PER_SECOND / frequency) == 0;
+        bool alarm = t % TICK_ARBITER_TICKS_PER_SECOND == 0 && second == alarm_second;
+        if (!periodic && !alarm) continue;
+
+        result.wakes++;
+        uint8_t due = 0;
+        if (periodic) due |= tick_arbiter_periodic(second_of_hour);
+        if (alarm) {
+            due |= tick_arbiter_alarm(second_of_hour);
+            alarm_second = tick_arbiter_next_alarm_second(second);
+        }
+        for (uint8_t i = 0; i < TICK_ARBITER_MAX_CLIENTS; i++) {
+            if (!(due & (1 << i))) continue;
+            result.ticks[i]++;
+            uint16_t period = tick_arbiter_get_period(i);
+            if (period > TICK_ARBITER_TICKS_PER_SECOND && second_of_hour % (period / TICK_ARBITER_TICKS_PER_SECOND)) result.misplaced = true;
+        }
+    }
+
+    return result;
+}
+
+/// Counts wakes with a separate periodic interrupt for the face and the fast tick, and the minute alarm.
+static uint32_t run_separate_interrupts(const workload_t *w) {
+    uint32_t wakes = 0;
+    uint32_t face_interval = w->face_period < TICK_ARBITER_TICKS_PER_SECOND ? w->face_period : TICK_ARBITER_TICKS_PER_SECOND;
+
+    for (uint32_t t = 0; t < DURATION; t++) {
+        bool face = t % face_interval == 0;
+        bool fast = fast_wanted(w, t);
+        bool alarm = t % (60 * TICK_ARBITER_TICKS_PER_SECOND) == 0;
+        if (face || fast || alarm) wakes++;
+    }
+
+    return wakes;
+}
+
+static void test_workloads(void) {
+    const workload_t workloads[] = {
+        {"1 Hz face", 128, 0, 0},
+        {"face every 60 s", 60 * 128, 0, 0},
+        {"face every 10 s", 10 * 128, 0, 0},
+        {"face every 7 s (runs every 6)", 7 * 128, 0, 0},
+        {"face every 10 s, 2 s press each min", 10 * 128, 60 * 128, 2 * 128},
+        {"4 Hz face, 3 s LED dwell each min", 32, 60 * 128, 3 * 128},
+        {"16 Hz face", 8, 0, 0},
+    };
+
+    printf("%-38s %10s %10s %8s\n", "workload (10 minutes)", "separate", "arbiter", "saved");
+    for (uint8_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+        const workload_t *w = &workloads[i];
+        result_t result = run_arbiter(w);
+        uint32_t separate = run_separate_interrupts(w);
+        printf("%-38s %10u %10u %7.1f%%\n", w->name, separate, result.wakes, (separate - result.wakes) * 100.0 / separate);
+
+        // never worse, and every client gets exactly the ticks it asked for.
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(separate, result.wakes, w->name);
+        TEST_ASSERT_FALSE_MESSAGE(result.misplaced, w->name);
+        uint16_t face_period = tick_arbiter_get_period(CLIENT_FACE);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(DURATION / face_period, result.ticks[CLIENT_FACE], w->name);
+        uint32_t fast_ticks = w->fast_every ? (DURATION / w->fast_every) * w->fast_length : 0;
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(fast_ticks, result.ticks[CLIENT_FAST], w->name);
+        if (face_period > TICK_ARBITER_TICKS_PER_SECOND && !w->fast_every) {
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(DURATION / face_period, result.wakes, w->name);
+        }
+    }
+}
+
+static void test_periods_round_to_what_the_rtc_can_do(void) {
+    tick_arbiter_set_period(CLIENT_FACE, 3);
+    TEST_ASSERT_EQUAL_UINT16(2, tick_arbiter_get_period(CLIENT_FACE));
+    TEST_ASSERT_EQUAL_UINT8(64, tick_arbiter_get_frequency());
+    tick_arbiter_set_period(CLIENT_FACE, 45 * 128);
+    TEST_ASSERT_EQUAL_UINT16(30 * 128, tick_arbiter_get_period(CLIENT_FACE));
+    TEST_ASSERT_EQUAL_UINT8(0, tick_arbiter_get_frequency());
+    tick_arbiter_set_period(CLIENT_FACE, 3600 * 128);
+    TEST_ASSERT_EQUAL_UINT16(60 * 128, tick_arbiter_get_period(CLIENT_FACE));
+    TEST_ASSERT_EQUAL(0, tick_arbiter_next_alarm_second(0));
+    TEST_ASSERT_FALSE(tick_arbiter_set_period(CLIENT_FACE, 60 * 128));
+}
+
+// the alarm goes to whichever slow client is due first, wrapping to the top of the minute.
+static void test_alarm_goes_to_first_due(void) {
+    tick_arbiter_set_period(CLIENT_FACE, 15 * 128);
+    tick_arbiter_set_period(CLIENT_FAST, 20 * 128);
+    TEST_ASSERT_EQUAL(15, tick_arbiter_next_alarm_second(0));
+    TEST_ASSERT_EQUAL(20, tick_arbiter_next_alarm_second(15));
+    TEST_ASSERT_EQUAL(0, tick_arbiter_next_alarm_second(45));
+    TEST_ASSERT_EQUAL_HEX8(1 << CLIENT_FAST, tick_arbiter_alarm(40));
+    TEST_ASSERT_EQUAL_HEX8(0, tick_arbiter_alarm(40));
+    TEST_ASSERT_EQUAL_HEX8((1 << CLIENT_FACE) | (1 << CLIENT_FAST), tick_arbiter_alarm(60));
+}
+
+// a fast client takes over the alarm's job until it stops.
+static void test_fast_client_takes_over_alarm(void) {
+    tick_arbiter_set_period(CLIENT_FACE, 15 * 128);
+    tick_arbiter_set_period(CLIENT_FAST, 1);
+    TEST_ASSERT_EQUAL_UINT8(128, tick_arbiter_get_frequency());
+    TEST_ASSERT_EQUAL(0, tick_arbiter_next_alarm_second(10));
+    TEST_ASSERT_EQUAL_HEX8(0, tick_arbiter_alarm(75));
+    tick_arbiter_set_period(CLIENT_FAST, 0);
+    TEST_ASSERT_EQUAL_UINT8(0, tick_arbiter_get_frequency());
+    TEST_ASSERT_EQUAL(15, tick_arbiter_next_alarm_second(10));
+}
+
+// a slow client is due on the RTC's own seconds, not counted from its request: a 60 s client asking at any
+// second gets its next tick at the top of the minute, from the alarm or from the fast client's interrupt.
+static void test_slow_ticks_land_on_the_minute(void) {
+    for (uint8_t second = 0; second < 60; second++) {
+        reset_arbiter();
+        tick_arbiter_set_period(CLIENT_FACE, 60 * 128);
+        TEST_ASSERT_EQUAL(0, tick_arbiter_next_alarm_second(second));
+        tick_arbiter_set_period(CLIENT_FAST, 1);
+        for (uint16_t second_of_hour = 60 + second; second_of_hour <= 120; second_of_hour++) {
+            uint8_t expected = second_of_hour % 60 ? 0 : (1 << CLIENT_FACE);
+            TEST_ASSERT_EQUAL_HEX8(expected, tick_arbiter_periodic(second_of_hour) & (1 << CLIENT_FACE));
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_workloads);
+    RUN_TEST(test_periods_round_to_what_the_rtc_can_do);
+    RUN_TEST(test_alarm_goes_to_first_due);
+    RUN_TEST(test_fast_client_takes_over_alarm);
+    RUN_TEST(test_slow_ticks_land_on_the_minute);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "tick_arbiter.h"
+
+// slow periods, in seconds: the divisors of 60.
+static const uint8_t _tick_arbiter_slow_periods[] = {1, 2, 3, 4, 5, 6, 10, 12, 15, 20, 30, 60};
+
+static uint16_t _tick_arbiter_periods[TICK_ARBITER_MAX_CLIENTS];
+static uint8_t _tick_arbiter_frequency;
+// where the periodic interrupt is within the second, in 128ths, counted from when the schedule last changed.
+static uint8_t _tick_arbiter_phase;
+static uint16_t _tick_arbiter_last_second = UINT16_MAX;
+
+static uint16_t _tick_arbiter_round_period(uint32_t period) {
+    if (period == 0) return 0;
+    if (period < TICK_ARBITER_TICKS_PER_SECOND) return 1 << (31 - __builtin_clz(period));
+
+    uint32_t seconds = period / TICK_ARBITER_TICKS_PER_SECOND;
+    uint8_t i = sizeof(_tick_arbiter_slow_periods) - 1;
+    while (_tick_arbiter_slow_periods[i] > seconds) i--;
+
+    return _tick_arbiter_slow_periods[i] * TICK_ARBITER_TICKS_PER_SECOND;
+}
+
+bool tick_arbiter_set_period(uint8_t client, uint32_t period) {
+    if (client >= TICK_ARBITER_MAX_CLIENTS) return false;
+    uint16_t rounded = _tick_arbiter_round_period(period);
+    if (_tick_arbiter_periods[client] == rounded) return false;
+    _tick_arbiter_periods[client] = rounded;
+
+    uint16_t fastest = 0;
+    for (uint8_t i = 0; i < TICK_ARBITER_MAX_CLIENTS; i++) {
+        if (_tick_arbiter_periods[i] && (fastest == 0 || _tick_arbiter_periods[i] < fastest)) fastest = _tick_arbiter_periods[i];
+    }
+    _tick_arbiter_frequency = (fastest && fastest <= TICK_ARBITER_TICKS_PER_SECOND) ? TICK_ARBITER_TICKS_PER_SECOND / fastest : 0;
+    _tick_arbiter_phase = 0;
+
+    // the caller reprograms the alarm whenever anything changes, since a new slow period can move its next second.
+    return true;
+}
+
+uint16_t tick_arbiter_get_period(uint8_t client) {
+    if (client >= TICK_ARBITER_MAX_CLIENTS) return 0;
+    return _tick_arbiter_periods[client];
+}
+
+uint8_t tick_arbiter_get_frequency(void) {
+    return _tick_arbiter_frequency;
+}
+
+uint8_t tick_arbiter_next_alarm_second(uint8_t second) {
+    if (_tick_arbiter_frequency) return 0;
+
+    uint8_t next = 60;
+    for (uint8_t i = 0; i < TICK_ARBITER_MAX_CLIENTS; i++) {
+        if (_tick_arbiter_periods[i] == 0) continue;
+        uint8_t seconds = _tick_arbiter_periods[i] / TICK_ARBITER_TICKS_PER_SECOND;
+        uint8_t due = (second / seconds + 1) * seconds;
+        if (due < next) next = due;
+    }
+
+    return next % 60;
+}
+
+/// @return the slow clients due at this second, if it's one we haven't seen yet.
+static uint8_t _tick_arbiter_slow_clients_due(uint16_t second_of_hour) {
+    if (second_of_hour == _tick_arbiter_last_second) return 0;
+    _tick_arbiter_last_second = second_of_hour;
+
+    uint8_t due = 0;
+    for (uint8_t i = 0; i < TICK_ARBITER_MAX_CLIENTS; i++) {
+        if (_tick_arbiter_periods[i] < TICK_ARBITER_TICKS_PER_SECOND) continue;
+        if (second_of_hour % (_tick_arbiter_periods[i] / TICK_ARBITER_TICKS_PER_SECOND) == 0) due |= 1 << i;
+    }
+
+    return due;
+}
+
+uint8_t tick_arbiter_periodic(uint16_t second_of_hour) {
+    if (_tick_arbiter_frequency == 0) return 0;
+
+    _tick_arbiter_phase = (_tick_arbiter_phase + TICK_ARBITER_TICKS_PER_SECOND / _tick_arbiter_frequency) % TICK_ARBITER_TICKS_PER_SECOND;
+    uint8_t due = _tick_arbiter_slow_clients_due(second_of_hour);
+    for (uint8_t i = 0; i < TICK_ARBITER_MAX_CLIENTS; i++) {
+        uint16_t period = _tick_arbiter_periods[i];
+        if (period && period < TICK_ARBITER_TICKS_PER_SECOND && _tick_arbiter_phase % period == 0) due |= 1 << i;
+    }
+
+    return due;
+}
+
+uint8_t tick_arbiter_alarm(uint16_t second_of_hour) {
+    if (_tick_arbiter_frequency) return 0;
+
+    return _tick_arbiter_slow_clients_due(second_of_hour);
+}
@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Tick arbitration
+ *
+ * Each client asks for ticks at its own period, in 128ths of a second. Periods under a second are powers of two
+ * (1 to 64, i.e. 128 Hz to 2 Hz); 128 is once a second; longer periods are whole seconds that divide a minute
+ * (2, 3, 4, 5, 6, 10, 12, 15, 20, 30 or 60), so that a slow client ticks on the same seconds every minute and the
+ * top of the minute is always one of them. Other periods are rounded down to the nearest of these.
+ *
+ * Movement runs the RTC's periodic interrupt at the rate of the fastest client, as long as that client needs a
+ * tick at least once a second, and calls tick_arbiter_periodic from it to find out which clients are due. When
+ * every client is slower than that, the periodic interrupt is switched off and the RTC alarm is set for the next
+ * second a client is due, from tick_arbiter_next_alarm_second; tick_arbiter_alarm then says who is due.
+ *
+ * None of this masks interrupts; Movement does that around any call that could race with one.
+ */
+
+#define TICK_ARBITER_MAX_CLIENTS 4
+#define TICK_ARBITER_TICKS_PER_SECOND 128
+
+/** @brief Sets a client's period, or stops its ticks.
+  * @param client The client, from 0 to TICK_ARBITER_MAX_CLIENTS - 1.
+  * @param period The time between ticks in 128ths of a second, or 0 for no ticks. Rounded down to a period
+  *               the arbiter supports; see above.
+  * @return true if the interrupts Movement needs to program have changed.
+  */
+bool tick_arbiter_set_period(uint8_t client, uint32_t period);
+
+/// @return the client's period in 128ths of a second, as rounded by tick_arbiter_set_period, or 0 if it has none.
+uint16_t tick_arbiter_get_period(uint8_t client);
+
+/// @return the rate in Hz to run the RTC's periodic interrupt at, or 0 if no client needs a tick every second.
+uint8_t tick_arbiter_get_frequency(void);
+
+/** @brief Returns the second at which to set the RTC alarm.
+  * @param second The current second, 0-59.
+  * @return the next second after this one at which a client slower than once a second is due, if the periodic
+  *         interrupt is off; otherwise 0, for the top of the minute.
+  */
+uint8_t tick_arbiter_next_alarm_second(uint8_t second);
+
+/** @brief Call from the periodic interrupt.
+  * @param second_of_hour The RTC's minute * 60 + second.
+  * @return a bitmask of the clients due a tick.
+  */
+uint8_t tick_arbiter_periodic(uint16_t second_of_hour);
+
+/** @brief Call from the alarm interrupt.
+  * @param second_of_hour The RTC's minute * 60 + second.
+  * @return a bitmask of the clients due a tick, which is always 0 while the periodic interrupt is running.
+  */
+uint8_t tick_arbiter_alarm(uint16_t second_of_hour);
@@ -44,6 +44,8 @@
 #include "evsys.h"
 #include "delay.h"
 #include "thermistor_driver.h"
+#include "temperature_archive.h"
+#include "tick_arbiter.h"
 
 #include "movement_config.h"
 
@@ -51,13 +53,56 @@
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
-void _wake_up_simulator(void);
 #else
 #include "watch_usb_cdc.h"
+#include "sam.h"
 #endif
 
-volatile movement_state_t movement_state;
+#ifdef MOVEMENT_POWER_LINT
+// only calls made from watch faces get tagged with their call site; Movement's own calls go straight through.
+#undef movement_request_tick_frequency
+#undef movement_request_tick_period
+#undef movement_schedule_background_task
+#undef movement_schedule_background_task_for_face
+#undef movement_set_accelerometer_background_rate
+#undef movement_enable_tap_detection_if_available
+#undef movement_force_led_on
+#undef watch_set_led_color
+#undef watch_set_led_color_rgb
+#undef watch_set_led_red
+#undef watch_set_led_green
+#undef watch_set_led_yellow
+#undef watch_enable_buzzer
+#undef watch_set_buzzer_on
+#undef watch_buzzer_play_sequence
+#undef watch_buzzer_play_tune
+#undef watch_enable_i2c
+#undef watch_enable_spi
+#undef watch_enable_adc
+
+typedef struct {
+    const char *file;
+    int line;
+} movement_lint_call_site_t;
+
+static bool _movement_lint_running;
+static movement_lint_call_site_t _movement_lint_sites[MOVEMENT_LINT_NUM_SITES];
+// the simulator has no accelerometer, so the lint tracks what faces asked for rather than what the sensor is doing.
+static lis2dw_data_rate_t _movement_lint_accelerometer_rate;
+static bool _movement_lint_tap_detection;
+#endif
+
+volatile movement_isr_state_t movement_isr_state;
+movement_state_t movement_state;
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
+// context paging: the number of bytes to save for faces that opted in, a checksum of what's on flash,
+// whether we skipped a face's setup on wake because its context was paged out, and whether the face had an
+// alarm set when it was paged out, so that we needn't read it back to ask.
+static uint16_t _movement_context_swap_size[MOVEMENT_NUM_FACES];
+static uint32_t _movement_context_swap_checksum[MOVEMENT_NUM_FACES];
+static bool _movement_context_swap_saved[MOVEMENT_NUM_FACES];
+static bool _movement_context_needs_setup[MOVEMENT_NUM_FACES];
+static bool _movement_context_has_active_alarm[MOVEMENT_NUM_FACES];
 watch_date_time_t scheduled_tasks[MOVEMENT_NUM_FACES];
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 600, 3600, 7200, 21600, 43200, 86400, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
@@ -66,12 +111,60 @@ movement_event_t event;
 int8_t _movement_dst_offset_cache[NUM_ZONE_NAMES] = {0};
 #define TIMEZONE_DOES_NOT_OBSERVE (-127)
 
+// Below this voltage, the power governor dims the LED, caps its dwell time and softens the buzzer.
+#ifndef MOVEMENT_POWER_REDUCED_VOLTAGE
+#define MOVEMENT_POWER_REDUCED_VOLTAGE 2600
+#endif
+
+// Below this voltage, the power governor disables the LED and plays the buzzer at the soft volume.
+#ifndef MOVEMENT_POWER_CRITICAL_VOLTAGE
+#define MOVEMENT_POWER_CRITICAL_VOLTAGE 2400
+#endif
+
+// Older movement_config.h files predate deep standby; leave it off for them.
+#ifndef MOVEMENT_DEFAULT_STANDBY_INTERVAL
+#define MOVEMENT_DEFAULT_STANDBY_INTERVAL 0
+#endif
+
+// Perceived brightness is roughly duty cycle to the power of 1/2.2, so these are the duty cycles (out of 255) that make
+// the 16 color levels look evenly spaced. A linear mapping spends most of its range on levels that barely look brighter.
+static const uint8_t _movement_led_gamma[16] = {0, 1, 3, 7, 14, 23, 34, 48, 64, 83, 105, 129, 156, 186, 219, 255};
+
+// Per-board default for the PWM level at which each LED channel looks fully bright. Override in movement_config.h.
+#ifndef MOVEMENT_DEFAULT_LED_CALIBRATION_RED
+#define MOVEMENT_DEFAULT_LED_CALIBRATION_RED 255
+#endif
+#ifndef MOVEMENT_DEFAULT_LED_CALIBRATION_GREEN
+#define MOVEMENT_DEFAULT_LED_CALIBRATION_GREEN 255
+#endif
+#ifndef MOVEMENT_DEFAULT_LED_CALIBRATION_BLUE
+#define MOVEMENT_DEFAULT_LED_CALIBRATION_BLUE 255
+#endif
+
+// How often, in minutes, Movement reads the temperature sensor for the temperature archive.
+#ifndef MOVEMENT_TEMPERATURE_ARCHIVE_INTERVAL
+#define MOVEMENT_TEMPERATURE_ARCHIVE_INTERVAL 5
+#endif
+
+// Milliseconds a face may keep the watch awake in a minute with no button pressed: a twentieth of the time, which a
+// face ticking at 8 Hz stays well under.
+#ifndef MOVEMENT_WAKE_BUDGET
+#define MOVEMENT_WAKE_BUDGET 3000
+#endif
+
+// What Movement does when a face goes over the wake budget.
+#ifndef MOVEMENT_WAKE_BUDGET_ACTION
+#define MOVEMENT_WAKE_BUDGET_ACTION MOVEMENT_WAKE_BUDGET_WARN
+#endif
+
+// A fresh cell recovers a little after a load, so we need to see this much headroom before relaxing the limits.
+#define MOVEMENT_POWER_HYSTERESIS 50
+
 void cb_mode_btn_interrupt(void);
 void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
 void cb_alarm_fired(void);
-void cb_fast_tick(void);
 void cb_tick(void);
 
 void cb_accelerometer_event(void);
@@ -128,40 +221,339 @@ static bool _movement_update_dst_offset_cache(void) {
     return dst_changed;
 }
 
+// the main loop reads and clears values that interrupts also write, so those handoffs happen with interrupts masked.
+/// Returns whether an interrupt set the flag, and clears it, so that one setting it again isn't lost.
+static bool _movement_take_flag(volatile bool *flag) {
+    uint32_t state = watch_critical_enter();
+    bool value = *flag;
+    *flag = false;
+    watch_critical_exit(state);
+    return value;
+}
+
+/// If the low energy countdown has run out, marks it as handled and returns true. A button press resetting it first wins.
+static bool _movement_take_expired_le_mode_countdown(void) {
+    uint32_t state = watch_critical_enter();
+    bool expired = movement_isr_state.le_mode_ticks == 0;
+    if (expired) movement_isr_state.le_mode_ticks = -1;
+    watch_critical_exit(state);
+    return expired;
+}
+
+/// The same for the countdown that sends the face a timeout.
+static bool _movement_take_expired_timeout_countdown(void) {
+    uint32_t state = watch_critical_enter();
+    bool expired = movement_isr_state.timeout_ticks == 0;
+    if (expired) movement_isr_state.timeout_ticks = -1;
+    watch_critical_exit(state);
+    return expired;
+}
+
 static inline void _movement_reset_inactivity_countdown(void) {
-    movement_state.le_mode_ticks = movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval];
-    movement_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
+    movement_isr_state.le_mode_ticks = movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval];
+    movement_isr_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
+}
+
+static uint32_t _movement_trace_now(void) {
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    uint32_t start = watch_trace_get_start_time();
+    // a clock set back to before the trace started counts as its start.
+    return now > start ? (now - start) * WATCH_TRACE_TICKS_PER_SECOND : 0;
+}
+
+// the RTC only counts whole seconds. while the fast tick runs it times inputs to the 128th, which is what a long press needs.
+static uint32_t _movement_trace_fast_tick_epoch = 0;
+
+static void _movement_trace(watch_trace_event_t event, uint8_t data) {
+    if (!watch_trace_is_recording()) return;
+    uint32_t timestamp;
+    if (movement_isr_state.fast_tick_enabled) timestamp = _movement_trace_fast_tick_epoch + movement_isr_state.fast_ticks;
+    else timestamp = _movement_trace_now();
+    watch_trace_record(timestamp, event, data);
+}
+
+// the alarm second the tick schedule last asked for; 0 is the top of the minute, where the housekeeping alarm goes.
+static uint8_t _movement_tick_alarm_second = 0;
+
+/// Points the alarm at the next second a slow tick client is due, or back at the top of the minute.
+static void _movement_set_tick_alarm(uint8_t second) {
+    // deep standby keeps its own hourly alarm.
+    if (movement_state.in_standby) return;
+    uint8_t alarm_second = tick_arbiter_next_alarm_second(second);
+    if (alarm_second == _movement_tick_alarm_second) return;
+
+    watch_date_time_t alarm_time;
+    alarm_time.reg = 0;
+    alarm_time.unit.second = alarm_second;
+    watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+    _movement_tick_alarm_second = alarm_second;
+}
+
+/// Changes a tick client's period, and reprograms the RTC if the schedule that serves them all has changed.
+static void _movement_set_tick_period(movement_tick_client_t client, uint32_t period) {
+    uint32_t state = watch_critical_enter();
+    if (tick_arbiter_set_period(client, period)) {
+        uint8_t frequency = tick_arbiter_get_frequency();
+        watch_rtc_disable_all_periodic_callbacks();
+        if (frequency) watch_rtc_register_periodic_callback(cb_tick, frequency);
+        _movement_set_tick_alarm(watch_rtc_get_date_time().unit.second);
+    }
+    watch_critical_exit(state);
 }
 
 static inline void _movement_enable_fast_tick_if_needed(void) {
-    if (!movement_state.fast_tick_enabled) {
-        movement_state.fast_ticks = 0;
-        watch_rtc_register_periodic_callback(cb_fast_tick, 128);
-        movement_state.fast_tick_enabled = true;
+    uint32_t state = watch_critical_enter();
+    if (!movement_isr_state.fast_tick_enabled) {
+        movement_isr_state.fast_ticks = 0;
+        if (watch_trace_is_recording()) _movement_trace_fast_tick_epoch = _movement_trace_now();
+        _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FAST, 1);
+        movement_isr_state.fast_tick_enabled = true;
     }
+    watch_critical_exit(state);
 }
 
 static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
-        movement_state.fast_tick_enabled = false;
-        watch_rtc_disable_periodic_callback(128);
+    // a button going down between the check and the disable would lose its long press, so do both at once.
+    uint32_t state = watch_critical_enter();
+    if ((movement_isr_state.light_ticks == -1) &&
+        (movement_isr_state.alarm_ticks == -1) &&
+        ((movement_isr_state.light_down_timestamp + movement_isr_state.mode_down_timestamp + movement_isr_state.alarm_down_timestamp) == 0)) {
+        movement_isr_state.fast_tick_enabled = false;
+        _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FAST, 0);
+    }
+    watch_critical_exit(state);
+}
+
+// the wake budget's rolling minute, kept as six ten second slices so that old wakes age out without a timestamp each.
+#define MOVEMENT_WAKE_BUDGET_SLICES 6
+#define MOVEMENT_WAKE_BUDGET_SLICE_SECONDS 10
+
+typedef struct {
+    uint32_t slices[MOVEMENT_WAKE_BUDGET_SLICES];   // microseconds awake
+    uint16_t newest_slice;              // second of the hour / 10 of the slice now counting
+    bool over;                          // already acted on for this window
+    bool downgraded;                    // the face's tick and sleep veto are overridden until the next press
+    bool face_kept_awake;               // the face's last loop said it couldn't sleep
+} movement_wake_budget_t;
+
+static movement_wake_budget_t _movement_wake_budget;
+static movement_wake_stats_t _movement_wake_stats[MOVEMENT_NUM_FACES];
+
+static uint32_t _movement_wake_budget_used(void) {
+    uint32_t used_us = 0;
+    for (uint8_t i = 0; i < MOVEMENT_WAKE_BUDGET_SLICES; i++) used_us += _movement_wake_budget.slices[i];
+    return used_us / 1000;
+}
+
+/// Marks a face that is over its budget with the LAP indicator, so the wearer can see it without the shell.
+static void _movement_wake_budget_set_over(bool over) {
+    if (MOVEMENT_WAKE_BUDGET_ACTION != MOVEMENT_WAKE_BUDGET_OFF) {
+        if (over) watch_set_indicator(WATCH_INDICATOR_LAP);
+        else if (_movement_wake_budget.over) watch_clear_indicator(WATCH_INDICATOR_LAP);
+    }
+    _movement_wake_budget.over = over;
+}
+
+/// Starts the window over, when the wearer presses a button or a new face comes on screen.
+static void _movement_wake_budget_reset(void) {
+    memset(_movement_wake_budget.slices, 0, sizeof(_movement_wake_budget.slices));
+    _movement_wake_budget_set_over(false);
+    _movement_wake_budget.downgraded = false;
+}
+
+static void _movement_wake_budget_exceeded(uint8_t face_idx, uint32_t used) {
+    _movement_wake_stats[face_idx].over_budget++;
+    printf("face %u: awake %lu ms in a minute, over the wake budget of %u ms\r\n", face_idx, (unsigned long)used, MOVEMENT_WAKE_BUDGET);
+
+    switch (MOVEMENT_WAKE_BUDGET_ACTION) {
+        case MOVEMENT_WAKE_BUDGET_SLEEP:
+            movement_request_sleep();
+            // if low energy mode is forbidden, the downgrade is the best we can do.
+            // fall through
+        case MOVEMENT_WAKE_BUDGET_DOWNGRADE:
+            _movement_wake_budget.downgraded = true;
+            // leave faces that already tick slower than 1 Hz alone.
+            if (tick_arbiter_get_period(MOVEMENT_TICK_CLIENT_FACE) < TICK_ARBITER_TICKS_PER_SECOND) {
+                movement_request_tick_frequency(1);
+            }
+            break;
+        default:
+            break;
     }
 }
 
+/// Charges the time a main loop pass took to the face on screen, and acts if that puts it over the budget. Only
+/// passes the face is responsible for count: ones that brought it an event, or that ran because it wouldn't let the
+/// watch sleep. The rest are Movement's, like the passes USB keeps running for the shell.
+static void _movement_wake_budget_count(uint32_t awake_us, bool face_event) {
+    uint8_t face_idx = movement_state.current_face_idx;
+    movement_wake_stats_t *stats = &_movement_wake_stats[face_idx];
+
+    stats->wakes++;
+    stats->awake_us += awake_us;
+
+    // the fast tick serves buttons, the LED and the alarm, which are not the face's doing either.
+    if (stats->exempt || movement_isr_state.fast_tick_enabled) return;
+    if (!face_event && !_movement_wake_budget.face_kept_awake) return;
+
+    uint16_t slice = movement_isr_state.last_second_of_hour / MOVEMENT_WAKE_BUDGET_SLICE_SECONDS;
+    uint16_t age = (slice + 3600 / MOVEMENT_WAKE_BUDGET_SLICE_SECONDS - _movement_wake_budget.newest_slice) %
+                   (3600 / MOVEMENT_WAKE_BUDGET_SLICE_SECONDS);
+    if (age >= MOVEMENT_WAKE_BUDGET_SLICES) {
+        memset(_movement_wake_budget.slices, 0, sizeof(_movement_wake_budget.slices));
+    } else {
+        for (uint16_t i = 1; i <= age; i++) {
+            _movement_wake_budget.slices[(_movement_wake_budget.newest_slice + i) % MOVEMENT_WAKE_BUDGET_SLICES] = 0;
+        }
+    }
+    _movement_wake_budget.newest_slice = slice;
+    _movement_wake_budget.slices[slice % MOVEMENT_WAKE_BUDGET_SLICES] += awake_us;
+
+    uint32_t used = _movement_wake_budget_used();
+    if (used <= MOVEMENT_WAKE_BUDGET) {
+        _movement_wake_budget_set_over(false);
+    } else {
+        bool first = !_movement_wake_budget.over;
+        // set again on every pass, since faces clear the display as they draw.
+        _movement_wake_budget_set_over(true);
+        if (first && MOVEMENT_WAKE_BUDGET_ACTION != MOVEMENT_WAKE_BUDGET_OFF) _movement_wake_budget_exceeded(face_idx, used);
+    }
+}
+
+static movement_power_level_t _movement_power_level_for_voltage(uint16_t millivolts, movement_power_level_t current_level) {
+    if (millivolts < MOVEMENT_POWER_CRITICAL_VOLTAGE) return MOVEMENT_POWER_LEVEL_CRITICAL;
+    if (current_level == MOVEMENT_POWER_LEVEL_CRITICAL && millivolts < MOVEMENT_POWER_CRITICAL_VOLTAGE + MOVEMENT_POWER_HYSTERESIS) return MOVEMENT_POWER_LEVEL_CRITICAL;
+    if (millivolts < MOVEMENT_POWER_REDUCED_VOLTAGE) return MOVEMENT_POWER_LEVEL_REDUCED;
+    if (current_level != MOVEMENT_POWER_LEVEL_NORMAL && millivolts < MOVEMENT_POWER_REDUCED_VOLTAGE + MOVEMENT_POWER_HYSTERESIS) return MOVEMENT_POWER_LEVEL_REDUCED;
+
+    return MOVEMENT_POWER_LEVEL_NORMAL;
+}
+
+static void _movement_apply_power_limits(void) {
+    switch (movement_state.power_level) {
+        case MOVEMENT_POWER_LEVEL_NORMAL:
+            watch_set_led_max_level(255);
+            watch_set_buzzer_max_duty_cycle(50);
+            break;
+        case MOVEMENT_POWER_LEVEL_REDUCED:
+            watch_set_led_max_level(128);
+            watch_set_buzzer_max_duty_cycle(12);
+            break;
+        case MOVEMENT_POWER_LEVEL_CRITICAL:
+            watch_set_led_max_level(0);
+            watch_set_buzzer_max_duty_cycle(5);
+            break;
+    }
+}
+
+static void _movement_sample_battery_voltage(void) {
+    movement_update_battery_voltage(watch_get_vcc_voltage());
+}
+
+static void _movement_sample_temperature(watch_date_time_t date_time) {
+    if (!movement_state.has_thermistor && !movement_state.has_lis2dw) return;
+    temperature_archive_add_sample(watch_utility_date_time_to_unix_time(date_time, 0), movement_get_temperature());
+}
+
+static void _movement_context_filename(uint8_t watch_face_index, char *filename) {
+    sprintf(filename, "face%02d.ctx", watch_face_index);
+}
+
+static uint32_t _movement_context_checksum(const uint8_t *data, uint16_t size) {
+    // FNV-1a; we only need to notice that the context changed, not protect it.
+    uint32_t hash = 2166136261u;
+    for (uint16_t i = 0; i < size; i++) hash = (hash ^ data[i]) * 16777619u;
+    return hash;
+}
+
+static void _movement_page_out_context(uint8_t watch_face_index) {
+    uint16_t size = _movement_context_swap_size[watch_face_index];
+    void *context = watch_face_contexts[watch_face_index];
+    if (size == 0 || context == NULL) return;
+
+    uint8_t previous_owner = watch_memory_set_owner(watch_face_index);
+    uint32_t checksum = _movement_context_checksum(context, size);
+    if (!_movement_context_swap_saved[watch_face_index] || checksum != _movement_context_swap_checksum[watch_face_index]) {
+        char filename[12];
+        _movement_context_filename(watch_face_index, filename);
+        // if we can't save it, it simply stays resident.
+        if (!filesystem_write_file(filename, context, size)) {
+            watch_memory_set_owner(previous_owner);
+            return;
+        }
+        _movement_context_swap_checksum[watch_face_index] = checksum;
+        _movement_context_swap_saved[watch_face_index] = true;
+    }
+
+    // the context can't change on flash, so neither can the answer.
+    if (watch_faces[watch_face_index].advise != NULL) {
+        _movement_context_has_active_alarm[watch_face_index] = watch_faces[watch_face_index].advise(context).has_active_alarm;
+    }
+
+    free(context);
+    watch_face_contexts[watch_face_index] = NULL;
+    watch_memory_set_owner(previous_owner);
+}
+
+static bool _movement_context_is_paged_out(uint8_t watch_face_index) {
+    return _movement_context_swap_size[watch_face_index] != 0 && watch_face_contexts[watch_face_index] == NULL;
+}
+
+/// @return true if the context was paged out and has been read back in.
+static bool _movement_page_in_context(uint8_t watch_face_index) {
+    if (!_movement_context_is_paged_out(watch_face_index)) return false;
+
+    uint16_t size = _movement_context_swap_size[watch_face_index];
+    uint8_t previous_owner = watch_memory_set_owner(watch_face_index);
+    char filename[12];
+    _movement_context_filename(watch_face_index, filename);
+    void *context = malloc(size);
+    if (context != NULL && filesystem_read_file(filename, context, size)) {
+        watch_face_contexts[watch_face_index] = context;
+    } else {
+        // the saved copy is gone; setup will allocate a fresh context and opt in again.
+        free(context);
+        _movement_context_swap_size[watch_face_index] = 0;
+        _movement_context_swap_saved[watch_face_index] = false;
+        _movement_context_needs_setup[watch_face_index] = true;
+    }
+
+    if (_movement_context_needs_setup[watch_face_index]) {
+        _movement_context_needs_setup[watch_face_index] = false;
+        watch_faces[watch_face_index].setup(watch_face_index, &watch_face_contexts[watch_face_index]);
+    }
+    watch_memory_set_owner(previous_owner);
+
+    return true;
+}
+
+void movement_set_context_swappable(uint8_t watch_face_index, uint16_t size) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES || _movement_context_swap_size[watch_face_index] == size) return;
+    _movement_context_swap_size[watch_face_index] = size;
+    _movement_context_swap_saved[watch_face_index] = false;
+}
+
 static void _movement_handle_top_of_minute(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
 
     // update the DST offset cache every 30 minutes, since someplace in the world could change.
+    // the battery drains slowly, so the power governor can run on the same schedule.
     if (date_time.unit.minute % 30 == 0) {
         _movement_update_dst_offset_cache();
+        _movement_sample_battery_voltage();
+    }
+
+    // sample the temperature before asking the faces, so that any that look at the archive see the new reading.
+    if (date_time.unit.minute % MOVEMENT_TEMPERATURE_ARCHIVE_INTERVAL == 0) {
+        _movement_sample_temperature(date_time);
     }
 
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        // For each face that offers an advisory...
-        if (watch_faces[i].advise != NULL) {
+        // For each face that offers an advisory, and isn't paged out (those get background tasks only when they
+        // schedule them, rather than a flash read every minute)...
+        if (watch_faces[i].advise != NULL && !_movement_context_is_paged_out(i)) {
             // ...we ask for one.
+            uint8_t previous_owner = watch_memory_set_owner(i);
             movement_watch_face_advisory_t advisory = watch_faces[i].advise(watch_face_contexts[i]);
 
             // If it wants a background task...
@@ -172,9 +564,9 @@ static void _movement_handle_top_of_minute(void) {
             }
 
             // TODO: handle other advisory types
+            watch_memory_set_owner(previous_owner);
         }
     }
-    movement_state.woke_from_alarm_handler = false;
 }
 
 static void _movement_handle_scheduled_tasks(void) {
@@ -186,7 +578,11 @@ static void _movement_handle_scheduled_tasks(void) {
             if (scheduled_tasks[i].reg <= date_time.reg) {
                 scheduled_tasks[i].reg = 0;
                 movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+                uint8_t previous_owner = watch_memory_set_owner(i);
+                bool paged_in = _movement_page_in_context(i);
                 watch_faces[i].loop(background_event, watch_face_contexts[i]);
+                if (paged_in) _movement_page_out_context(i);
+                watch_memory_set_owner(previous_owner);
                 // check if loop scheduled a new task
                 if (scheduled_tasks[i].reg) {
                     num_active_tasks++;
@@ -212,23 +608,65 @@ void movement_request_tick_frequency(uint8_t freq) {
     // If we are asked for an invalid frequency, default back to 1 Hz.
     if (freq == 0 || __builtin_popcount(freq) != 1) freq = 1;
 
-    // disable all callbacks except the 128 Hz one
-    watch_rtc_disable_matching_periodic_callbacks(0xFE);
+    // a face over its wake budget gets 1 Hz until the wearer presses a button.
+    if (_movement_wake_budget.downgraded) freq = 1;
+
+    movement_isr_state.subsecond = 0;
+    _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FACE, TICK_ARBITER_TICKS_PER_SECOND / freq);
+}
+
+void movement_set_wake_budget_exempt(bool exempt) {
+    _movement_wake_stats[movement_state.current_face_idx].exempt = exempt;
+}
+
+bool movement_get_wake_stats(uint8_t watch_face_index, movement_wake_stats_t *stats) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return false;
+    *stats = _movement_wake_stats[watch_face_index];
+    return true;
+}
 
-    movement_state.subsecond = 0;
-    movement_state.tick_frequency = freq;
-    watch_rtc_register_periodic_callback(cb_tick, freq);
+uint32_t movement_get_wake_budget_used(void) {
+    return _movement_wake_budget_used();
+}
+
+uint32_t movement_get_wake_budget(void) {
+    return MOVEMENT_WAKE_BUDGET;
+}
+
+void movement_request_tick_period(uint8_t seconds) {
+    if (seconds == 0) seconds = 1;
+
+    movement_isr_state.subsecond = 0;
+    _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FACE, seconds * TICK_ARBITER_TICKS_PER_SECOND);
+}
+
+static uint8_t _movement_led_level_to_pwm(uint8_t level, uint8_t calibration) {
+    if (level == 0) return 0;
+    uint8_t pwm = ((uint16_t)_movement_led_gamma[level & 0xF] * calibration + 127) / 255;
+    // never round a lit channel down to off.
+    return pwm ? pwm : 1;
+}
+
+void movement_get_led_pwm_levels(movement_color_t color, uint8_t *red, uint8_t *green, uint8_t *blue) {
+    *red = _movement_led_level_to_pwm(color.red, movement_state.led_calibration.bit.red);
+    *green = _movement_led_level_to_pwm(color.green, movement_state.led_calibration.bit.green);
+    *blue = _movement_led_level_to_pwm(color.blue, movement_state.led_calibration.bit.blue);
 }
 
 void movement_illuminate_led(void) {
+    // on a nearly depleted cell, the LED's current draw could brown us out.
+    if (movement_state.power_level == MOVEMENT_POWER_LEVEL_CRITICAL) return;
+
     if (movement_state.settings.bit.led_duration != 0b111) {
-        watch_set_led_color_rgb(movement_state.settings.bit.led_red_color | movement_state.settings.bit.led_red_color << 4,
-                                movement_state.settings.bit.led_green_color | movement_state.settings.bit.led_green_color << 4,
-                                movement_state.settings.bit.led_blue_color | movement_state.settings.bit.led_blue_color << 4);
+        uint8_t red, green, blue;
+        movement_get_led_pwm_levels(movement_backlight_color(), &red, &green, &blue);
+        watch_set_led_color_rgb(red, green, blue);
         if (movement_state.settings.bit.led_duration == 0) {
-            movement_state.light_ticks = 1;
+            movement_isr_state.light_ticks = 1;
         } else {
-            movement_state.light_ticks = (movement_state.settings.bit.led_duration * 2 - 1) * 128;
+            movement_isr_state.light_ticks = (movement_state.settings.bit.led_duration * 2 - 1) * 128;
+            // on a weak battery, cap the dwell at one second.
+            if (movement_state.power_level != MOVEMENT_POWER_LEVEL_NORMAL && movement_isr_state.light_ticks > 128) movement_isr_state.light_ticks = 128;
         }
         _movement_enable_fast_tick_if_needed();
     }
@@ -237,12 +675,12 @@ void movement_illuminate_led(void) {
 void movement_force_led_on(uint8_t red, uint8_t green, uint8_t blue) {
     // this is hacky, we need a way for watch faces to set an arbitrary color and prevent Movement from turning it right back off.
     watch_set_led_color_rgb(red, green, blue);
-    movement_state.light_ticks = 32767;
+    movement_isr_state.light_ticks = 32767;
 }
 
 void movement_force_led_off(void) {
     watch_set_led_off();
-    movement_state.light_ticks = -1;
+    movement_isr_state.light_ticks = -1;
     _movement_disable_fast_tick_if_possible();
 }
 
@@ -322,7 +760,7 @@ void movement_request_sleep(void) {
     /// set it to 0, have the watch face loop return false, and then we'll fall asleep immediately.
     /// But could this lead to a race condition where the callback decrements to -1 before the loop?
     /// This is the safest way but consider more testing here.
-    movement_state.le_mode_ticks = 1;
+    movement_isr_state.le_mode_ticks = 1;
 }
 
 void movement_request_wake() {
@@ -331,7 +769,7 @@ void movement_request_wake() {
 }
 
 static void end_buzzing() {
-    movement_state.is_buzzing = false;
+    movement_isr_state.is_buzzing = false;
 }
 
 static void end_buzzing_and_disable_buzzer(void) {
@@ -341,20 +779,20 @@ static void end_buzzing_and_disable_buzzer(void) {
 
 void movement_play_signal(void) {
     void *maybe_disable_buzzer = end_buzzing_and_disable_buzzer;
-    if (watch_is_buzzer_or_led_enabled()) {
+    if (watch_is_buzzer_enabled()) {
         maybe_disable_buzzer = end_buzzing;
     } else {
         watch_enable_buzzer();
     }
-    movement_state.is_buzzing = true;
-    watch_buzzer_play_sequence(signal_tune, maybe_disable_buzzer);
-    if (movement_state.le_mode_ticks == -1) {
+    movement_isr_state.is_buzzing = true;
+    watch_buzzer_play_tune(signal_tune, maybe_disable_buzzer);
+    if (movement_isr_state.le_mode_ticks == -1) {
         // the watch is asleep. wake it up for "1" round through the main loop.
         // the sleep_mode_app_loop will notice the is_buzzing and note that it
         // only woke up to beep and then it will spinlock until the callback
         // turns off the is_buzzing flag.
         movement_state.needs_wake = true;
-        movement_state.le_mode_ticks = 1;
+        movement_isr_state.le_mode_ticks = 1;
     }
 }
 
@@ -365,10 +803,12 @@ void movement_play_alarm(void) {
 void movement_play_alarm_beeps(uint8_t rounds, watch_buzzer_note_t alarm_note) {
     if (rounds == 0) rounds = 1;
     if (rounds > 20) rounds = 20;
+    // an alarm is the biggest load we put on the battery, so make sure the governor's limits are current.
+    _movement_sample_battery_voltage();
     movement_request_wake();
     movement_state.alarm_note = alarm_note;
     // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given.
-    movement_state.alarm_ticks = 128 * rounds - 75;
+    movement_isr_state.alarm_ticks = 128 * rounds - 75;
     _movement_enable_fast_tick_if_needed();
 }
 
@@ -474,6 +914,18 @@ void movement_set_low_energy_timeout(uint8_t value) {
     movement_state.settings.bit.le_interval = value;
 }
 
+uint16_t movement_get_standby_interval(void) {
+    return movement_state.standby_interval;
+}
+
+void movement_set_standby_interval(uint16_t minutes) {
+    movement_state.standby_interval = minutes;
+}
+
+bool movement_is_in_standby(void) {
+    return movement_state.in_standby;
+}
+
 movement_color_t movement_backlight_color(void) {
     return (movement_color_t) {
         .red = movement_state.settings.bit.led_red_color,
@@ -488,6 +940,15 @@ void movement_set_backlight_color(movement_color_t color) {
     movement_state.settings.bit.led_blue_color = color.blue;
 }
 
+movement_led_calibration_t movement_get_led_calibration(void) {
+    return movement_state.led_calibration;
+}
+
+void movement_set_led_calibration(movement_led_calibration_t calibration) {
+    calibration.bit.version = 0;
+    movement_state.led_calibration.reg = calibration.reg;
+}
+
 uint8_t movement_get_backlight_dwell(void) {
     return movement_state.settings.bit.led_duration;
 }
@@ -502,6 +963,39 @@ void movement_store_settings(void) {
     if (movement_state.settings.reg != old_settings.reg) {
         filesystem_write_file("settings.u32", (char *)&movement_state.settings, sizeof(movement_settings_t));
     }
+
+    movement_led_calibration_t old_calibration = {0};
+    filesystem_read_file("ledcal.u32", (char *)&old_calibration, sizeof(movement_led_calibration_t));
+    if (movement_state.led_calibration.reg != old_calibration.reg) {
+        filesystem_write_file("ledcal.u32", (char *)&movement_state.led_calibration, sizeof(movement_led_calibration_t));
+    }
+
+    // with no file, the default is in effect, and there's nothing to write until it changes.
+    uint16_t old_standby_interval;
+    if (!filesystem_read_file("standby.u16", (char *)&old_standby_interval, sizeof(old_standby_interval))) {
+        old_standby_interval = MOVEMENT_DEFAULT_STANDBY_INTERVAL;
+    }
+    if (movement_state.standby_interval != old_standby_interval) {
+        filesystem_write_file("standby.u16", (char *)&movement_state.standby_interval, sizeof(movement_state.standby_interval));
+    }
+}
+
+movement_settings_t movement_get_settings(void) {
+    return movement_state.settings;
+}
+
+void movement_set_settings(movement_settings_t settings) {
+    movement_state.settings = settings;
+    // the inactivity intervals may have changed.
+    _movement_reset_inactivity_countdown();
+}
+
+uint8_t movement_get_num_faces(void) {
+    return MOVEMENT_NUM_FACES;
+}
+
+uint8_t movement_get_current_face(void) {
+    return movement_state.current_face_idx;
 }
 
 bool movement_alarm_enabled(void) {
@@ -513,7 +1007,16 @@ void movement_set_alarm_enabled(bool value) {
 }
 
 bool movement_enable_tap_detection_if_available(void) {
+#ifdef MOVEMENT_POWER_LINT
+    _movement_lint_tap_detection = true;
+#endif
     if (movement_state.has_lis2dw) {
+        // cb_accelerometer_event reads the interrupt source, so keep the bus up until tap detection is disabled.
+        if (!movement_state.tap_detection_enabled) {
+            movement_state.tap_detection_enabled = true;
+            watch_enable_i2c();
+        }
+        lis2dw_begin_configuration();
         // configure tap duration threshold and enable Z axis
         lis2dw_configure_tap_threshold(0, 0, 12, LIS2DW_REG_TAP_THS_Z_Z_AXIS_ENABLE);
         lis2dw_configure_tap_duration(10, 2, 2);
@@ -522,6 +1025,7 @@ bool movement_enable_tap_detection_if_available(void) {
         lis2dw_set_low_noise_mode(true);
         lis2dw_set_data_rate(LIS2DW_DATA_RATE_HP_400_HZ);
         lis2dw_set_mode(LIS2DW_MODE_HIGH_PERFORMANCE);
+        lis2dw_commit_configuration();
 
         // Settling time (1 sample duration, i.e. 1/400Hz)
         delay_ms(3);
@@ -536,13 +1040,25 @@ bool movement_enable_tap_detection_if_available(void) {
 }
 
 bool movement_disable_tap_detection_if_available(void) {
+#ifdef MOVEMENT_POWER_LINT
+    _movement_lint_tap_detection = false;
+#endif
     if (movement_state.has_lis2dw) {
+        // faces call this from resign whether or not they turned it on; with it off, the bus is down and
+        // the accelerometer is already in its background configuration.
+        if (!movement_state.tap_detection_enabled) return true;
+
+        lis2dw_begin_configuration();
         // Ramp data rate back down to the usual lowest rate to save power.
         lis2dw_set_low_noise_mode(false);
         lis2dw_set_data_rate(movement_state.accelerometer_background_rate);
         lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);
         // ...disable Z axis (not sure if this is needed, does this save power?)...
         lis2dw_configure_tap_threshold(0, 0, 0, 0);
+        lis2dw_commit_configuration();
+
+        movement_state.tap_detection_enabled = false;
+        watch_disable_i2c();
 
         return true;
     }
@@ -556,9 +1072,14 @@ lis2dw_data_rate_t movement_get_accelerometer_background_rate(void) {
 }
 
 bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate) {
+#ifdef MOVEMENT_POWER_LINT
+    _movement_lint_accelerometer_rate = new_rate;
+#endif
     if (movement_state.has_lis2dw) {
         if (movement_state.accelerometer_background_rate != new_rate) {
+            watch_enable_i2c();
             lis2dw_set_data_rate(new_rate);
+            watch_disable_i2c();
             movement_state.accelerometer_background_rate = new_rate;
 
             return true;
@@ -576,7 +1097,9 @@ uint8_t movement_get_accelerometer_motion_threshold(void) {
 bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold) {
     if (movement_state.has_lis2dw) {
         if (movement_state.accelerometer_motion_threshold != new_threshold) {
+            watch_enable_i2c();
             lis2dw_configure_wakeup_threshold(new_threshold);
+            watch_disable_i2c();
             movement_state.accelerometer_motion_threshold = new_threshold;
 
             return true;
@@ -586,6 +1109,28 @@ bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold) {
     return false;
 }
 
+void movement_update_battery_voltage(uint16_t millivolts) {
+    movement_power_level_t new_level = _movement_power_level_for_voltage(millivolts, movement_state.power_level);
+
+    movement_state.battery_millivolts = millivolts;
+    // the regulator and brown-out detector follow the battery too.
+    watch_update_supply(millivolts);
+    if (new_level != movement_state.power_level) {
+        movement_state.power_level = new_level;
+        _movement_apply_power_limits();
+        // the new LED limit only applies to the next color; if the LED shouldn't be on at all, turn it off now.
+        if (new_level == MOVEMENT_POWER_LEVEL_CRITICAL && movement_isr_state.light_ticks > 0) movement_isr_state.light_ticks = 0;
+    }
+}
+
+uint16_t movement_get_battery_voltage(void) {
+    return movement_state.battery_millivolts;
+}
+
+movement_power_level_t movement_get_power_level(void) {
+    return movement_state.power_level;
+}
+
 float movement_get_temperature(void) {
     float temperature_c = (float)0xFFFFFFFF;
 
@@ -594,7 +1139,9 @@ float movement_get_temperature(void) {
         temperature_c = thermistor_driver_get_temperature();
         thermistor_driver_disable();
     } else if (movement_state.has_lis2dw) {
+            watch_enable_i2c();
             int16_t val = lis2dw_get_temperature();
+            watch_disable_i2c();
             val = val >> 4;
             temperature_c = 25 + (float)val / 16.0;
     }
@@ -620,6 +1167,10 @@ void app_init(void) {
     memset((void *)&movement_state, 0, sizeof(movement_state));
 
     movement_state.has_thermistor = thermistor_driver_init();
+    temperature_archive_init();
+
+    // take an initial battery reading, so that the power governor's limits apply from the start.
+    _movement_sample_battery_voltage();
 
     bool settings_file_exists = filesystem_file_exists("settings.u32");
     movement_settings_t maybe_settings;
@@ -667,6 +1218,26 @@ void app_init(void) {
         movement_store_settings();
     }
 
+    // every bit of movement_settings_t is spoken for, so the standby interval is stored in a file of its own beside it.
+    uint16_t maybe_standby_interval;
+    if (filesystem_read_file("standby.u16", (char *) &maybe_standby_interval, sizeof(maybe_standby_interval))) {
+        movement_state.standby_interval = maybe_standby_interval;
+    } else {
+        movement_state.standby_interval = MOVEMENT_DEFAULT_STANDBY_INTERVAL;
+    }
+
+    movement_led_calibration_t maybe_calibration = {0};
+    if (filesystem_file_exists("ledcal.u32")) {
+        filesystem_read_file("ledcal.u32", (char *) &maybe_calibration, sizeof(movement_led_calibration_t));
+    }
+    if (maybe_calibration.reg != 0 && maybe_calibration.bit.version == 0) {
+        movement_state.led_calibration.reg = maybe_calibration.reg;
+    } else {
+        movement_state.led_calibration.bit.red = MOVEMENT_DEFAULT_LED_CALIBRATION_RED;
+        movement_state.led_calibration.bit.green = MOVEMENT_DEFAULT_LED_CALIBRATION_GREEN;
+        movement_state.led_calibration.bit.blue = MOVEMENT_DEFAULT_LED_CALIBRATION_BLUE;
+    }
+
     watch_date_time_t date_time = watch_rtc_get_date_time();
     if (date_time.reg == 0) {
         date_time = watch_get_init_date_time();
@@ -680,8 +1251,8 @@ void app_init(void) {
 
     if (movement_state.accelerometer_motion_threshold == 0) movement_state.accelerometer_motion_threshold = 32;
 
-    movement_state.light_ticks = -1;
-    movement_state.alarm_ticks = -1;
+    movement_isr_state.light_ticks = -1;
+    movement_isr_state.alarm_ticks = -1;
     movement_state.next_available_backup_register = 2;
     _movement_reset_inactivity_countdown();
 }
@@ -723,10 +1294,11 @@ void app_setup(void) {
         watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
     }
 
-    // LCD autodetect uses the buttons as a a failsafe, so we should run it before we enable the button interrupts
-    watch_enable_display();
+    // LCD autodetect uses the buttons as a a failsafe, so we should run it before we enable the button interrupts.
+    // in deep standby the display stays off until we wake for real.
+    if (!movement_state.in_standby) watch_enable_display();
 
-    if (movement_state.le_mode_ticks != -1) {
+    if (movement_isr_state.le_mode_ticks != -1) {
         watch_disable_extwake_interrupt(HAL_GPIO_BTN_ALARM_pin());
 
         watch_enable_external_interrupts();
@@ -735,22 +1307,19 @@ void app_setup(void) {
         watch_register_interrupt_callback(HAL_GPIO_BTN_ALARM_pin(), cb_alarm_btn_interrupt, INTERRUPT_TRIGGER_BOTH);
 
 #ifdef I2C_SERCOM
+        // the I2C bus is only powered while we talk to the accelerometer; tap detection holds it on separately.
         static bool lis2dw_checked = false;
+        watch_enable_i2c();
         if (!lis2dw_checked) {
-            watch_enable_i2c();
-            if (lis2dw_begin()) {
-                movement_state.has_lis2dw = true;
-            } else {
-                movement_state.has_lis2dw = false;
-                watch_disable_i2c();
-            }
+            movement_state.has_lis2dw = lis2dw_begin();
             lis2dw_checked = true;
         } else if (movement_state.has_lis2dw) {
-            watch_enable_i2c();
             lis2dw_begin();
         }
 
         if (movement_state.has_lis2dw) {
+            // everything up to lis2dw_commit_configuration goes out in a couple of burst writes.
+            lis2dw_begin_configuration();
             lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);         // select low power (not high performance) mode
             lis2dw_set_low_power_mode(LIS2DW_LP_MODE_1);    // lowest power mode, 12-bit
             lis2dw_set_low_noise_mode(false);               // low noise mode raises power consumption slightly; we don't need it
@@ -790,7 +1359,9 @@ void app_setup(void) {
             // If a watch face wants to check in on the A4 interrupt pin for motion status, it can call
             // movement_set_accelerometer_background_rate with another rate like LIS2DW_DATA_RATE_LOWEST or LIS2DW_DATA_RATE_25_HZ.
             lis2dw_set_data_rate(movement_state.accelerometer_background_rate);
+            lis2dw_commit_configuration();
         }
+        watch_disable_i2c();
 #endif
 
         watch_enable_buzzer();
@@ -799,8 +1370,17 @@ void app_setup(void) {
         movement_request_tick_frequency(1);
 
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+            // a paged-out context comes back with its setup call when the face is next needed.
+            if (_movement_context_is_paged_out(i)) {
+                _movement_context_needs_setup[i] = true;
+                continue;
+            }
+            watch_memory_set_owner(i);
             watch_faces[i].setup(i, &watch_face_contexts[i]);
+            // page swappable faces out one at a time, so that only one large context is ever allocated at boot.
+            if (i != movement_state.current_face_idx) _movement_page_out_context(i);
         }
+        watch_memory_set_owner(WATCH_MEMORY_OWNER_SYSTEM);
 
         watch_faces[movement_state.current_face_idx].activate(watch_face_contexts[movement_state.current_face_idx]);
         event.subsecond = 0;
@@ -810,21 +1390,241 @@ void app_setup(void) {
 
 #ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
 
+static bool _movement_has_active_alarm(void) {
+    if (movement_state.alarm_enabled) return true;
+
+    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        if (watch_faces[i].advise == NULL) continue;
+        if (_movement_context_is_paged_out(i)) {
+            if (_movement_context_has_active_alarm[i]) return true;
+        } else if (watch_faces[i].advise(watch_face_contexts[i]).has_active_alarm) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void _movement_enter_standby(void) {
+    movement_state.in_standby = true;
+
+    // switching the SLCD off stops its charge pump and frame clock; app_setup turns it back on when we wake.
+    watch_disable_display();
+
+    // an alarm has to go off on the minute, so only drop to hourly housekeeping if nobody has one set.
+    if (!_movement_has_active_alarm()) {
+        watch_date_time_t alarm_time;
+        alarm_time.reg = 0;
+        watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_MMSS);
+    }
+
+#ifdef I2C_SERCOM
+    if (movement_state.has_lis2dw) {
+        // keep the accelerometer sampling so that picking the watch up wakes it; INT2 falls when motion is detected.
+        watch_enable_i2c();
+        lis2dw_set_data_rate(LIS2DW_DATA_RATE_LOWEST);
+        watch_disable_i2c();
+        watch_register_extwake_callback(HAL_GPIO_A4_pin(), cb_accelerometer_wake, false);
+    }
+#endif
+}
+
+static void _movement_exit_standby(void) {
+    movement_state.in_standby = false;
+
+    watch_date_time_t alarm_time;
+    alarm_time.reg = 0;
+    watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+    // whatever second a slow tick last wanted, the alarm is back at the top of the minute now.
+    _movement_tick_alarm_second = 0;
+
+#ifdef I2C_SERCOM
+    // app_setup puts the accelerometer back to its background data rate.
+    if (movement_state.has_lis2dw) watch_disable_extwake_interrupt(HAL_GPIO_A4_pin());
+#endif
+}
+
 static void _sleep_mode_app_loop(void) {
+    uint16_t minutes_asleep = 0;
+
     movement_state.needs_wake = false;
     // as long as le_mode_ticks is -1 (i.e. we are in low energy mode), we wake up here, update the screen, and go right back to sleep.
-    while (movement_state.le_mode_ticks == -1) {
+    while (movement_isr_state.le_mode_ticks == -1) {
         // we also have to handle top-of-the-minute tasks here in the mini-runloop
-        if (movement_state.woke_from_alarm_handler) _movement_handle_top_of_minute();
+        if (_movement_take_flag(&movement_isr_state.woke_from_alarm_handler)) {
+            _movement_handle_top_of_minute();
+            if (minutes_asleep < UINT16_MAX) minutes_asleep++;
+        }
 
-        event.event_type = EVENT_LOW_ENERGY_UPDATE;
-        watch_faces[movement_state.current_face_idx].loop(event, watch_face_contexts[movement_state.current_face_idx]);
+        // with the display off there is nothing to update; we only woke for housekeeping.
+        if (!movement_state.in_standby) {
+            event.event_type = EVENT_LOW_ENERGY_UPDATE;
+            watch_faces[movement_state.current_face_idx].loop(event, watch_face_contexts[movement_state.current_face_idx]);
+
+            if (movement_state.standby_interval && minutes_asleep >= movement_state.standby_interval) _movement_enter_standby();
+        }
 
         // if we need to wake immediately, do it!
-        if (movement_state.needs_wake) return;
+        if (movement_state.needs_wake) break;
         // otherwise enter sleep mode, and when the extwake handler is called, it will reset le_mode_ticks and force us out at the next loop.
         else watch_enter_sleep_mode();
     }
+
+    if (movement_state.in_standby) _movement_exit_standby();
+}
+
+#endif
+
+#ifdef MOVEMENT_POWER_LINT
+
+// how many ticks the lint delivers after activating a face, and again after the button presses.
+#ifndef MOVEMENT_POWER_LINT_TICKS
+#define MOVEMENT_POWER_LINT_TICKS 4
+#endif
+
+void _movement_lint_note(movement_lint_site_t site, const char *file, int line) {
+    if (!_movement_lint_running) return;
+    _movement_lint_sites[site].file = file;
+    _movement_lint_sites[site].line = line;
+}
+
+static bool _movement_lint_deliver(uint8_t watch_face_index, movement_event_type_t event_type) {
+    movement_event_t lint_event;
+    lint_event.event_type = event_type;
+    lint_event.subsecond = 0;
+    bool can_sleep = watch_faces[watch_face_index].loop(lint_event, watch_face_contexts[watch_face_index]);
+    // the lint decides which face is on screen, so requests to move on are dropped.
+    movement_state.watch_face_changed = false;
+
+    return can_sleep;
+}
+
+static void _movement_lint_print_site(movement_lint_site_t site) {
+    if (_movement_lint_sites[site].file) printf(" (last call at %s:%d)", _movement_lint_sites[site].file, _movement_lint_sites[site].line);
+    printf("\r\n");
+}
+
+/// @return true if the face put everything back the way it found it.
+static bool _movement_lint_face(uint8_t watch_face_index) {
+    static const movement_event_type_t buttons[] = {
+        EVENT_LIGHT_BUTTON_DOWN, EVENT_LIGHT_BUTTON_UP,
+        EVENT_ALARM_BUTTON_DOWN, EVENT_ALARM_BUTTON_UP,
+        EVENT_ALARM_LONG_PRESS, EVENT_ALARM_LONG_UP,
+    };
+    bool clean = true;
+
+    // the baseline is what a face finds when Movement switches to it.
+    movement_request_tick_frequency(1);
+    uint8_t peripheral_users[WATCH_NUM_PERIPHERALS];
+    for (uint8_t p = 0; p < WATCH_NUM_PERIPHERALS; p++) peripheral_users[p] = watch_peripheral_get_users(p);
+    watch_date_time_t tasks[MOVEMENT_NUM_FACES];
+    memcpy(tasks, scheduled_tasks, sizeof(tasks));
+    lis2dw_data_rate_t accelerometer_rate = _movement_lint_accelerometer_rate;
+    bool tap_detection = _movement_lint_tap_detection;
+    memset(_movement_lint_sites, 0, sizeof(_movement_lint_sites));
+
+    watch_memory_set_owner(watch_face_index);
+    _movement_page_in_context(watch_face_index);
+    watch_clear_display();
+    watch_faces[watch_face_index].activate(watch_face_contexts[watch_face_index]);
+    _movement_lint_deliver(watch_face_index, EVENT_ACTIVATE);
+    for (uint8_t i = 0; i < MOVEMENT_POWER_LINT_TICKS; i++) _movement_lint_deliver(watch_face_index, EVENT_TICK);
+    for (uint8_t i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++) _movement_lint_deliver(watch_face_index, buttons[i]);
+    for (uint8_t i = 0; i < MOVEMENT_POWER_LINT_TICKS; i++) _movement_lint_deliver(watch_face_index, EVENT_TICK);
+    bool can_sleep = _movement_lint_deliver(watch_face_index, EVENT_LOW_ENERGY_UPDATE);
+    watch_faces[watch_face_index].resign(watch_face_contexts[watch_face_index]);
+    _movement_page_out_context(watch_face_index);
+    watch_memory_set_owner(WATCH_MEMORY_OWNER_SYSTEM);
+
+    if (!can_sleep) {
+        printf("face %d: won't let the watch sleep in low energy mode\r\n", watch_face_index);
+        clean = false;
+    }
+    // a tick slower than once a second only saves power, so only a faster one is flagged.
+    if (tick_arbiter_get_period(MOVEMENT_TICK_CLIENT_FACE) < TICK_ARBITER_TICKS_PER_SECOND) {
+        printf("face %d: left the tick at %d Hz", watch_face_index, TICK_ARBITER_TICKS_PER_SECOND / tick_arbiter_get_period(MOVEMENT_TICK_CLIENT_FACE));
+        _movement_lint_print_site(MOVEMENT_LINT_TICK_FREQUENCY);
+        clean = false;
+    }
+    if (movement_isr_state.light_ticks == 32767) {
+        printf("face %d: left the LED forced on", watch_face_index);
+        _movement_lint_print_site(MOVEMENT_LINT_LED);
+        clean = false;
+    }
+    if (_movement_lint_accelerometer_rate != accelerometer_rate) {
+        printf("face %d: left the accelerometer at data rate %d", watch_face_index, _movement_lint_accelerometer_rate);
+        _movement_lint_print_site(MOVEMENT_LINT_ACCELEROMETER);
+        clean = false;
+    }
+    if (_movement_lint_tap_detection != tap_detection) {
+        printf("face %d: left tap detection %s", watch_face_index, _movement_lint_tap_detection ? "on" : "off");
+        _movement_lint_print_site(MOVEMENT_LINT_ACCELEROMETER);
+        clean = false;
+    }
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        if (scheduled_tasks[i].reg != tasks[i].reg && scheduled_tasks[i].reg) {
+            watch_date_time_t task = scheduled_tasks[i];
+            printf("face %d: left a background task for face %d at 20%02d-%02d-%02d %02d:%02d:%02d", watch_face_index, i,
+                   task.unit.year + WATCH_RTC_REFERENCE_YEAR - 2000, task.unit.month, task.unit.day,
+                   task.unit.hour, task.unit.minute, task.unit.second);
+            _movement_lint_print_site(MOVEMENT_LINT_BACKGROUND_TASK);
+            clean = false;
+        }
+    }
+
+    // a dwell from the LIGHT button is fine; only what's still held once the LED is off counts.
+    movement_force_led_off();
+    for (uint8_t p = 0; p < WATCH_NUM_PERIPHERALS; p++) {
+        // Movement's own signal and alarm tunes hold the TCC until they finish.
+        if (p == WATCH_PERIPHERAL_TCC && movement_isr_state.is_buzzing) continue;
+        uint8_t users = watch_peripheral_get_users(p);
+        if (users > peripheral_users[p]) {
+            printf("face %d: left %s enabled (%d users, was %d)", watch_face_index, watch_peripheral_get_name(p), users, peripheral_users[p]);
+            if (p == WATCH_PERIPHERAL_TCC) _movement_lint_print_site(_movement_lint_sites[MOVEMENT_LINT_BUZZER].file ? MOVEMENT_LINT_BUZZER : MOVEMENT_LINT_LED);
+            else _movement_lint_print_site(MOVEMENT_LINT_PERIPHERAL);
+            clean = false;
+        }
+    }
+
+    // put things back, so that one face's leftovers aren't blamed on the next.
+    memcpy(scheduled_tasks, tasks, sizeof(tasks));
+    movement_state.has_scheduled_background_task = false;
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) if (tasks[i].reg) movement_state.has_scheduled_background_task = true;
+    _movement_lint_accelerometer_rate = accelerometer_rate;
+    _movement_lint_tap_detection = tap_detection;
+
+    return clean;
+}
+
+uint8_t movement_power_lint(void) {
+    uint8_t flagged = 0;
+    uint8_t current_face_idx = movement_state.current_face_idx;
+
+    watch_memory_set_owner(current_face_idx);
+    watch_faces[current_face_idx].resign(watch_face_contexts[current_face_idx]);
+    _movement_page_out_context(current_face_idx);
+
+    _movement_lint_running = true;
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        movement_state.current_face_idx = i;
+        if (!_movement_lint_face(i)) flagged++;
+    }
+    _movement_lint_running = false;
+
+    // bring back the face that was on screen, as if we had just switched to it.
+    movement_state.current_face_idx = current_face_idx;
+    watch_memory_set_owner(current_face_idx);
+    watch_clear_display();
+    movement_request_tick_frequency(1);
+    _movement_page_in_context(current_face_idx);
+    watch_faces[current_face_idx].activate(watch_face_contexts[current_face_idx]);
+    watch_memory_set_owner(WATCH_MEMORY_OWNER_SYSTEM);
+    event.subsecond = 0;
+    event.event_type = EVENT_ACTIVATE;
+
+    printf("%d of %d faces flagged\r\n", flagged, (int)MOVEMENT_NUM_FACES);
+
+    return flagged;
 }
 
 #endif
@@ -832,44 +1632,57 @@ static void _sleep_mode_app_loop(void) {
 bool app_loop(void) {
     const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
     bool woke_up_for_buzzer = false;
+    // an event waiting for the face means this pass is on the face's account.
+    bool face_event = event.event_type != EVENT_NONE;
+
+    watch_trace_wake_begin();
 
     if (movement_state.watch_face_changed) {
         if (movement_state.settings.bit.button_should_sound) {
             // low note for nonzero case, high note for return to watch_face 0
             watch_buzzer_play_note_with_volume(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50, movement_state.settings.bit.button_volume);
         }
+        watch_memory_set_owner(movement_state.current_face_idx);
         wf->resign(watch_face_contexts[movement_state.current_face_idx]);
+        _movement_page_out_context(movement_state.current_face_idx);
         movement_state.current_face_idx = movement_state.next_face_idx;
+        watch_memory_set_owner(movement_state.current_face_idx);
         // we have just updated the face idx, so we must recache the watch face pointer.
         wf = &watch_faces[movement_state.current_face_idx];
+        _movement_wake_budget_reset();
         watch_clear_display();
         movement_request_tick_frequency(1);
+        _movement_page_in_context(movement_state.current_face_idx);
         wf->activate(watch_face_contexts[movement_state.current_face_idx]);
         event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
         movement_state.watch_face_changed = false;
     }
 
+    // anything allocated from here on is on behalf of the face on screen, until we get to the shell.
+    watch_memory_set_owner(movement_state.current_face_idx);
+
     // if the LED should be off, turn it off
-    if (movement_state.light_ticks == 0) {
+    if (movement_isr_state.light_ticks == 0) {
         // unless the user is holding down the LIGHT button, in which case, give them more time.
         if (HAL_GPIO_BTN_LIGHT_read()) {
-            movement_state.light_ticks = 1;
+            movement_isr_state.light_ticks = 1;
         } else {
             movement_force_led_off();
         }
     }
 
     // handle top-of-minute tasks, if the alarm handler told us we need to
-    if (movement_state.woke_from_alarm_handler) _movement_handle_top_of_minute();
+    if (_movement_take_flag(&movement_isr_state.woke_from_alarm_handler)) _movement_handle_top_of_minute();
 
     // if we have a scheduled background task, handle that here:
     if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
 
 #ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
     // if we have timed out of our low energy mode countdown, enter low energy mode.
-    if (movement_state.le_mode_ticks == 0) {
-        movement_state.le_mode_ticks = -1;
+    if (_movement_take_expired_le_mode_countdown()) {
+        // the face only gets low energy updates from here; app_setup gives it its 1 Hz tick back when we wake.
+        _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FACE, 0);
         watch_register_extwake_callback(HAL_GPIO_BTN_ALARM_pin(), cb_alarm_btn_extwake, true);
         event.event_type = EVENT_NONE;
         event.subsecond = 0;
@@ -877,9 +1690,12 @@ bool app_loop(void) {
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
         _sleep_mode_app_loop();
+        // the time spent in low energy mode is not the face's to pay for.
+        face_event = false;
+        _movement_wake_budget.face_kept_awake = false;
         // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
         // ourselves, but first, we check to see if we woke up for the buzzer:
-        if (movement_state.is_buzzing) {
+        if (movement_isr_state.is_buzzing) {
             woke_up_for_buzzer = true;
         }
         event.event_type = EVENT_ACTIVATE;
@@ -893,12 +1709,13 @@ bool app_loop(void) {
     bool can_sleep = true;
 
     if (event.event_type) {
-        event.subsecond = movement_state.subsecond;
+        event.subsecond = movement_isr_state.subsecond;
+        if (event.event_type >= EVENT_LIGHT_BUTTON_DOWN && event.event_type <= EVENT_ALARM_LONG_UP) _movement_wake_budget_reset();
         // the first trip through the loop overrides the can_sleep state
         can_sleep = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]);
 
         // Keep light on if user is still interacting with the watch.
-        if (movement_state.light_ticks > 0) {
+        if (movement_isr_state.light_ticks > 0) {
             switch (event.event_type) {
                 case EVENT_LIGHT_BUTTON_DOWN:
                 case EVENT_MODE_BUTTON_DOWN:
@@ -911,10 +1728,9 @@ bool app_loop(void) {
     }
 
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
-    if (movement_state.timeout_ticks == 0 && movement_state.current_face_idx != 0) {
-        movement_state.timeout_ticks = -1;
+    if (movement_state.current_face_idx != 0 && _movement_take_expired_timeout_countdown()) {
         event.event_type = EVENT_TIMEOUT;
-        event.subsecond = movement_state.subsecond;
+        event.subsecond = movement_isr_state.subsecond;
         // if we run through the loop again to time out, we need to reconsider whether or not we can sleep.
         // if the first trip said true, but this trip said false, we need the false to override, thus
         // we will be using boolean AND:
@@ -926,13 +1742,16 @@ bool app_loop(void) {
         can_sleep = can_sleep && can_sleep2;
         event.event_type = EVENT_NONE;
     }
+    bool face_can_sleep = can_sleep;
 
     // Now that we've handled all display update tasks, handle the alarm.
-    if (movement_state.alarm_ticks >= 0) {
-        uint8_t buzzer_phase = (movement_state.alarm_ticks + 80) % 128;
+    // the fast tick counts this down, so read it once.
+    int16_t alarm_ticks = movement_isr_state.alarm_ticks;
+    if (alarm_ticks >= 0) {
+        uint8_t buzzer_phase = (alarm_ticks + 80) % 128;
         if(buzzer_phase == 127) {
             // failsafe: buzzer could have been disabled in the meantime
-            if (!watch_is_buzzer_or_led_enabled()) watch_enable_buzzer();
+            watch_enable_buzzer();
             // play 4 beeps plus pause
             for(uint8_t i = 0; i < 4; i++) {
                 // TODO: This method of playing the buzzer blocks the UI while it's beeping.
@@ -941,12 +1760,14 @@ bool app_loop(void) {
                 if (i != 3) watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
             }
         }
-        if (movement_state.alarm_ticks == 0) {
-            movement_state.alarm_ticks = -1;
+        if (alarm_ticks == 0) {
+            movement_isr_state.alarm_ticks = -1;
             _movement_disable_fast_tick_if_possible();
         }
     }
 
+    watch_memory_set_owner(WATCH_MEMORY_OWNER_SYSTEM);
+
 #if __EMSCRIPTEN__
     shell_task();
 #else
@@ -958,16 +1779,20 @@ bool app_loop(void) {
 
     event.subsecond = 0;
 
+    // a face that went over its wake budget doesn't get to keep the watch awake.
+    if (_movement_wake_budget.downgraded) can_sleep = true;
+
     // if the watch face changed, we can't sleep because we need to update the display.
     if (movement_state.watch_face_changed) can_sleep = false;
 
     // if we woke up for the buzzer, stay awake until it's finished.
     if (woke_up_for_buzzer) {
-        while(watch_is_buzzer_or_led_enabled());
+        // the LEDs hold the TCC too, so wait on the signal itself rather than on the peripheral.
+        while(movement_isr_state.is_buzzing);
     }
 
     // if the LED is on, we need to stay awake to keep the TCC running.
-    if (movement_state.light_ticks != -1) can_sleep = false;
+    if (movement_isr_state.light_ticks != -1) can_sleep = false;
 
     // if we are plugged into USB, we can't sleep because we need to keep the serial shell running.
     if (usb_is_enabled()) {
@@ -975,24 +1800,27 @@ bool app_loop(void) {
         can_sleep = false;
     }
 
+    _movement_wake_budget_count(watch_trace_wake_end(), face_event);
+    _movement_wake_budget.face_kept_awake = !face_can_sleep;
+
     return can_sleep;
 }
 
 static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, volatile uint16_t *down_timestamp) {
     // force alarm off if the user pressed a button.
-    if (movement_state.alarm_ticks) movement_state.alarm_ticks = 0;
+    if (movement_isr_state.alarm_ticks) movement_isr_state.alarm_ticks = 0;
 
     if (pin_level) {
         // handle rising edge
         _movement_enable_fast_tick_if_needed();
-        *down_timestamp = movement_state.fast_ticks + 1;
+        *down_timestamp = movement_isr_state.fast_ticks + 1;
         return button_down_event_type;
     } else {
         // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
         // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
-        if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
+        if (movement_isr_state.light_ticks == 1) movement_isr_state.light_ticks = 0;
         // now that that's out of the way, handle falling edge
-        uint16_t diff = movement_state.fast_ticks - *down_timestamp;
+        uint16_t diff = movement_isr_state.fast_ticks - *down_timestamp;
         *down_timestamp = 0;
         _movement_disable_fast_tick_if_possible();
         // any press over a half second is considered a long press. Fire the long-up event
@@ -1004,75 +1832,100 @@ static movement_event_type_t _figure_out_button_event(bool pin_level, movement_e
 void cb_light_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_LIGHT_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_isr_state.light_down_timestamp);
+    _movement_trace(WATCH_TRACE_LIGHT_BUTTON, pin_level);
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_MODE_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp);
+    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_isr_state.mode_down_timestamp);
+    _movement_trace(WATCH_TRACE_MODE_BUTTON, pin_level);
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_ALARM_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp);
+    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_isr_state.alarm_down_timestamp);
+    _movement_trace(WATCH_TRACE_ALARM_BUTTON, pin_level);
 }
 
 void cb_alarm_btn_extwake(void) {
     // wake up!
     _movement_reset_inactivity_countdown();
+    _movement_trace(WATCH_TRACE_ALARM_BUTTON_WAKE, 0);
 }
 
-void cb_alarm_fired(void) {
-#if __EMSCRIPTEN__
-    _wake_up_simulator();
-#endif
-
-    movement_state.woke_from_alarm_handler = true;
-}
-
-void cb_fast_tick(void) {
-    movement_state.fast_ticks++;
-    if (movement_state.light_ticks > 0) movement_state.light_ticks--;
-    if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
+static void _movement_fast_tick(void) {
+    movement_isr_state.fast_ticks++;
+    if (movement_isr_state.light_ticks > 0) movement_isr_state.light_ticks--;
+    if (movement_isr_state.alarm_ticks > 0) movement_isr_state.alarm_ticks--;
     // check timestamps and auto-fire the long-press events
     // Notice: is it possible that two or more buttons have an identical timestamp? In this case
     // only one of these buttons would receive the long press event. Don't bother for now...
-    if (movement_state.light_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
+    if (movement_isr_state.light_down_timestamp > 0)
+        if (movement_isr_state.fast_ticks - movement_isr_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
             event.event_type = EVENT_LIGHT_LONG_PRESS;
-    if (movement_state.mode_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
+    if (movement_isr_state.mode_down_timestamp > 0)
+        if (movement_isr_state.fast_ticks - movement_isr_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
             event.event_type = EVENT_MODE_LONG_PRESS;
-    if (movement_state.alarm_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
+    if (movement_isr_state.alarm_down_timestamp > 0)
+        if (movement_isr_state.fast_ticks - movement_isr_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
             event.event_type = EVENT_ALARM_LONG_PRESS;
     // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
     // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
-    if (movement_state.fast_ticks >= 128 * 20) {
-        watch_rtc_disable_periodic_callback(128);
-        movement_state.fast_tick_enabled = false;
+    if (movement_isr_state.fast_ticks >= 128 * 20) {
+        _movement_set_tick_period(MOVEMENT_TICK_CLIENT_FAST, 0);
+        movement_isr_state.fast_tick_enabled = false;
     }
 }
 
-void cb_tick(void) {
+static void _movement_face_tick(watch_date_time_t date_time) {
     event.event_type = EVENT_TICK;
-    watch_date_time_t date_time = watch_rtc_get_date_time();
-    if (date_time.unit.second != movement_state.last_second) {
+    uint16_t second_of_hour = date_time.unit.minute * 60 + date_time.unit.second;
+    if (second_of_hour != movement_isr_state.last_second_of_hour) {
+        // a slow tick stands for several seconds. count them all, but no more than one period's worth, so that the
+        // first tick after low energy mode doesn't count the time we spent asleep.
+        uint16_t elapsed = (second_of_hour + 3600 - movement_isr_state.last_second_of_hour) % 3600;
+        uint16_t period = tick_arbiter_get_period(MOVEMENT_TICK_CLIENT_FACE) / TICK_ARBITER_TICKS_PER_SECOND;
+        if (period == 0) period = 1;
+        if (elapsed > period) elapsed = period;
+
         // TODO: can we consolidate these two ticks?
-        if (movement_state.le_mode_ticks > 0) movement_state.le_mode_ticks--;
-        if (movement_state.timeout_ticks > 0) movement_state.timeout_ticks--;
+        if (movement_isr_state.le_mode_ticks > 0) movement_isr_state.le_mode_ticks = movement_isr_state.le_mode_ticks > elapsed ? movement_isr_state.le_mode_ticks - elapsed : 0;
+        if (movement_isr_state.timeout_ticks > 0) movement_isr_state.timeout_ticks = movement_isr_state.timeout_ticks > elapsed ? movement_isr_state.timeout_ticks - elapsed : 0;
 
-        movement_state.last_second = date_time.unit.second;
-        movement_state.subsecond = 0;
+        movement_isr_state.last_second_of_hour = second_of_hour;
+        movement_isr_state.subsecond = 0;
     } else {
-        movement_state.subsecond++;
+        movement_isr_state.subsecond++;
+    }
+    _movement_trace(WATCH_TRACE_TICK, 0);
+}
+
+void cb_tick(void) {
+    // one periodic interrupt, at the fastest client's rate, serves every client that ticks at least once a second.
+    watch_date_time_t date_time = watch_rtc_get_date_time();
+    uint8_t due = tick_arbiter_periodic(date_time.unit.minute * 60 + date_time.unit.second);
+    // the face first, so that a long press from the fast tick wins over its tick, as it did with one interrupt each.
+    if (due & (1 << MOVEMENT_TICK_CLIENT_FACE)) _movement_face_tick(date_time);
+    if (due & (1 << MOVEMENT_TICK_CLIENT_FAST)) _movement_fast_tick();
+}
+
+void cb_alarm_fired(void) {
+    watch_date_time_t date_time = watch_rtc_get_date_time();
+    // the alarm also wakes us for ticks slower than once a second, but only the top of the minute means housekeeping.
+    if (date_time.unit.second == 0) movement_isr_state.woke_from_alarm_handler = true;
+    if (tick_arbiter_alarm(date_time.unit.minute * 60 + date_time.unit.second) & (1 << MOVEMENT_TICK_CLIENT_FACE)) {
+        _movement_face_tick(date_time);
     }
+    _movement_set_tick_alarm(date_time.unit.second);
+    _movement_trace(WATCH_TRACE_ALARM_FIRED, 0);
 }
 
 void cb_accelerometer_event(void) {
     uint8_t int_src = lis2dw_get_interrupt_source();
+    _movement_trace(WATCH_TRACE_ACCELEROMETER_EVENT, int_src);
 
     if (int_src & LIS2DW_REG_ALL_INT_SRC_DOUBLE_TAP) {
         event.event_type = EVENT_DOUBLE_TAP;
@@ -1088,4 +1941,5 @@ void cb_accelerometer_wake(void) {
     event.event_type = EVENT_ACCELEROMETER_WAKE;
     // also: wake up!
     _movement_reset_inactivity_countdown();
+    _movement_trace(WATCH_TRACE_ACCELEROMETER_WAKE, 0);
 }
@@ -63,6 +63,19 @@ typedef struct {
     uint8_t blue : 4;
 } movement_color_t;
 
+// movement_led_calibration_t stores, for each LED channel, the PWM level (0-255) that gives full brightness on this
+// particular board. Color levels are gamma corrected and then scaled into this range, so a channel that is brighter
+// than the others (or than it needs to be) can be turned down to save current. It is stored in ledcal.u32.
+typedef union {
+    struct {
+        uint8_t red;
+        uint8_t green;
+        uint8_t blue;
+        uint8_t version;
+    } bit;
+    uint32_t reg;
+} movement_led_calibration_t;
+
 // movement_settings_t contains global settings that cover watch behavior, including preferences around clock and unit
 // display, time zones, buzzer behavior, LED color and low energy mode timeouts.
 typedef union {
@@ -139,6 +152,14 @@ typedef struct {
     uint8_t subsecond;
 } movement_event_t;
 
+// The power governor limits the LED and buzzer as the battery drains, since their current spikes can brown out a
+// depleted coin cell.
+typedef enum {
+    MOVEMENT_POWER_LEVEL_NORMAL = 0,    // No limits.
+    MOVEMENT_POWER_LEVEL_REDUCED,       // LED dimmed and its dwell time capped; buzzer played at reduced duty.
+    MOVEMENT_POWER_LEVEL_CRITICAL,      // LED disabled; buzzer played at the soft volume.
+} movement_power_level_t;
+
 extern const int16_t movement_timezone_offsets[];
 
 /** @brief Perform setup for your watch face.
@@ -242,13 +263,11 @@ typedef struct {
     watch_face_advise advise;
 } watch_face_t;
 
+// Movement's state that interrupt handlers write: the tick, fast tick, button, alarm and buzzer callbacks.
+// Only this block is volatile. The main loop hands off with these through helpers in movement.c that mask
+// interrupts when they need more than a single read or write.
 typedef struct {
-    movement_settings_t settings;
-
-    // transient properties
-    int16_t current_face_idx;
-    int16_t next_face_idx;
-    bool watch_face_changed;
+    // fast tick: counts 128ths of a second while a button is down, the LED is lit or an alarm sounds.
     bool fast_tick_enabled;
     int16_t fast_ticks;
 
@@ -258,17 +277,14 @@ typedef struct {
     // alarm stuff
     int16_t alarm_ticks;
     bool is_buzzing;
-    watch_buzzer_note_t alarm_note;
 
     // button tracking for long press
     uint16_t light_down_timestamp;
     uint16_t mode_down_timestamp;
     uint16_t alarm_down_timestamp;
 
-    // background task handling
+    // set by the top-of-minute alarm, taken by the main loop
     bool woke_from_alarm_handler;
-    bool has_scheduled_background_task;
-    bool needs_wake;
 
     // low energy mode countdown
     int32_t le_mode_ticks;
@@ -276,10 +292,31 @@ typedef struct {
     // app resignation countdown (TODO: consolidate with LE countdown?)
     int16_t timeout_ticks;
 
-    // stuff for subsecond tracking
-    uint8_t tick_frequency;
-    uint8_t last_second;
+    // stuff for subsecond tracking: the minute * 60 + second of the face's last tick
+    uint16_t last_second_of_hour;
     uint8_t subsecond;
+} movement_isr_state_t;
+
+// Movement's state that only the main loop touches.
+typedef struct {
+    movement_settings_t settings;
+    movement_led_calibration_t led_calibration;
+
+    // transient properties
+    int16_t current_face_idx;
+    int16_t next_face_idx;
+    bool watch_face_changed;
+
+    // alarm stuff
+    watch_buzzer_note_t alarm_note;
+
+    // background task handling
+    bool has_scheduled_background_task;
+    bool needs_wake;
+
+    // deep standby: minutes in low energy mode before the display is switched off (0 to disable)
+    uint16_t standby_interval;
+    bool in_standby;
 
     // backup register stuff
     uint8_t next_available_backup_register;
@@ -296,6 +333,12 @@ typedef struct {
     lis2dw_data_rate_t accelerometer_background_rate;
     // threshold for considering the wearer is in motion
     uint8_t accelerometer_motion_threshold;
+    // tap interrupts read the accelerometer, so the I2C bus stays powered while this is set
+    bool tap_detection_enabled;
+
+    // power governor: the last battery voltage we measured, and the limits we derived from it
+    uint16_t battery_millivolts;
+    movement_power_level_t power_level;
 } movement_state_t;
 
 void movement_move_to_face(uint8_t watch_face_index);
@@ -307,8 +350,58 @@ void movement_illuminate_led(void);
 void movement_force_led_on(uint8_t red, uint8_t green, uint8_t blue);
 void movement_force_led_off(void);
 
+// Movement's tick clients. Each asks for its own tick period, and Movement wakes on the schedule that serves them all.
+typedef enum {
+    MOVEMENT_TICK_CLIENT_FACE = 0,  ///< The face on screen, set with movement_request_tick_frequency or _period.
+    MOVEMENT_TICK_CLIENT_FAST,      ///< Long press timing, the LED dwell and alarm playback, at 128 Hz while any needs it.
+    MOVEMENT_NUM_TICK_CLIENTS
+} movement_tick_client_t;
+
+/** @brief Asks for EVENT_TICK at a rate of 1 to 64 Hz. Movement sets 1 Hz whenever the face changes.
+  * @param freq The rate in Hz, a power of two; anything else sets 1 Hz.
+  */
 void movement_request_tick_frequency(uint8_t freq);
 
+/** @brief Asks for EVENT_TICK less often than once a second, for faces that only change every so often.
+  * @details With no fast tick running, the watch then wakes only for the ticks, on the RTC alarm, instead of every
+  *          second. Ticks land on the seconds of the minute that the period divides, so the top of the minute
+  *          always gets one.
+  * @param seconds The time between ticks, rounded down to 1, 2, 3, 4, 5, 6, 10, 12, 15, 20, 30 or 60 seconds.
+  *                Call movement_request_tick_frequency(1) to go back to the usual tick.
+  */
+void movement_request_tick_period(uint8_t seconds);
+
+// The wake budget catches faces that keep the watch awake with nobody looking: a fast tick, or a loop that never
+// lets the watch sleep. The time the main loop spends on the face's events, or awake because the face said it couldn't
+// sleep, counts against the face on screen, and a button press or a new face starts the count over. Past
+// MOVEMENT_WAKE_BUDGET milliseconds awake in a minute, Movement takes MOVEMENT_WAKE_BUDGET_ACTION; both can be set in
+// movement_config.h.
+typedef enum {
+    MOVEMENT_WAKE_BUDGET_OFF = 0,       // Count wakes, but do nothing about them.
+    MOVEMENT_WAKE_BUDGET_WARN,          // Show LAP while the face is over, log it to the shell and charge it to the face.
+    MOVEMENT_WAKE_BUDGET_DOWNGRADE,     // Also drop the face to a 1 Hz tick, and let the watch sleep between ticks.
+    MOVEMENT_WAKE_BUDGET_SLEEP,         // Also enter low energy mode.
+} movement_wake_budget_action_t;
+
+typedef struct {
+    uint32_t wakes;                     ///< Passes through the main loop with this face on screen.
+    uint32_t awake_us;                  ///< Time those passes took, in microseconds; to 1/1024 s on the watch.
+    uint16_t over_budget;               ///< Times the face went over the wake budget.
+    bool exempt;                        ///< Set with movement_set_wake_budget_exempt.
+} movement_wake_stats_t;
+
+/** @brief Exempts the face on screen from the wake budget while it has good reason to stay awake, like a running
+  *        stopwatch. The face keeps the exemption, on screen or off, until it clears it.
+  */
+void movement_set_wake_budget_exempt(bool exempt);
+
+// fills in the wake figures for a face since boot; returns false if there is no such face.
+bool movement_get_wake_stats(uint8_t watch_face_index, movement_wake_stats_t *stats);
+
+// milliseconds awake counted against the budget in the last minute, and the budget itself.
+uint32_t movement_get_wake_budget_used(void);
+uint32_t movement_get_wake_budget(void);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
 void movement_schedule_background_task(watch_date_time_t date_time);
@@ -324,6 +417,16 @@ void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 void movement_request_sleep(void);
 void movement_request_wake(void);
 
+// Lets Movement page a face's context out to the filesystem while the face is off screen, so that only the
+// visible face's state takes up heap. Call it from your setup function, every time, after allocating the
+// context; size is the number of bytes to save (usually sizeof your state struct). The context must not hold
+// pointers, since it comes back at a different address.
+// While paged out, your advise function isn't called at the top of the minute; Movement remembers whether it
+// reported an alarm as the face went off screen. To do work in the background, schedule it with
+// movement_schedule_background_task: the context is read back for the task, and only written back if it changed.
+// Paging suits large, foreground-only state like games.
+void movement_set_context_swappable(uint8_t watch_face_index, uint16_t size);
+
 void movement_play_signal(void);
 void movement_play_alarm(void);
 void movement_play_alarm_beeps(uint8_t rounds, watch_buzzer_note_t alarm_note);
@@ -360,14 +463,36 @@ void movement_set_fast_tick_timeout(uint8_t value);
 uint8_t movement_get_low_energy_timeout(void);
 void movement_set_low_energy_timeout(uint8_t value);
 
+// deep standby blanks the display and stops the per-minute wake after this many minutes of low energy mode.
+// faces get no EVENT_LOW_ENERGY_UPDATE while the display is off; their advisories are checked once an hour instead
+// of once a minute, unless the alarm indicator is on or a face reports has_active_alarm.
+// like the other settings, a new interval is kept across resets once movement_store_settings is called.
+uint16_t movement_get_standby_interval(void);
+void movement_set_standby_interval(uint16_t minutes);
+bool movement_is_in_standby(void);
+
 movement_color_t movement_backlight_color(void);
 void movement_set_backlight_color(movement_color_t color);
 
+// converts a 0-15 color into the PWM levels for watch_set_led_color_rgb, applying gamma correction and calibration.
+// each level maps to the smallest duty cycle that looks that bright, which is much less than a linear mapping.
+void movement_get_led_pwm_levels(movement_color_t color, uint8_t *red, uint8_t *green, uint8_t *blue);
+
+movement_led_calibration_t movement_get_led_calibration(void);
+void movement_set_led_calibration(movement_led_calibration_t calibration);
+
 uint8_t movement_get_backlight_dwell(void);
 void movement_set_backlight_dwell(uint8_t value);
 
 void movement_store_settings(void);
 
+// the whole settings register, for tools that back it up or restore it. call movement_store_settings to keep it.
+movement_settings_t movement_get_settings(void);
+void movement_set_settings(movement_settings_t settings);
+
+uint8_t movement_get_num_faces(void);
+uint8_t movement_get_current_face(void);
+
 /// TODO: For #SecondMovement: Should we have a counter that watch faces increment when they enable an alarm, and decrement when they disable it?
 /// Or should there be a watch face function where watch faces can tell us if they have an alarm enabled?
 /// Worth considering a better way to handle this.
@@ -386,7 +511,55 @@ bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate);
 uint8_t movement_get_accelerometer_motion_threshold(void);
 bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold);
 
+// The power governor samples the battery every 30 minutes and passes the reading here. Its trend assumes evenly
+// spaced samples, so faces that read the battery for themselves should only display what they read.
+void movement_update_battery_voltage(uint16_t millivolts);
+uint16_t movement_get_battery_voltage(void);
+movement_power_level_t movement_get_power_level(void);
+
 // If the board has a temperature sensor, this function will give you the temperature in degrees celsius.
 // If the board has multiple temperature sensors, it will use the most accurate one available.
 // If the board has no temperature sensors, it will return 0xFFFFFFFF.
 float movement_get_temperature(void);
+
+#ifdef MOVEMENT_POWER_LINT
+// Power lint builds (make POWER_LINT=1) tag every call a face makes that can leave something expensive running
+// with the file and line it came from, so that movement_power_lint can point at the offending call site.
+typedef enum {
+    MOVEMENT_LINT_TICK_FREQUENCY = 0,
+    MOVEMENT_LINT_BACKGROUND_TASK,
+    MOVEMENT_LINT_ACCELEROMETER,
+    MOVEMENT_LINT_LED,
+    MOVEMENT_LINT_BUZZER,
+    MOVEMENT_LINT_PERIPHERAL,
+    MOVEMENT_LINT_NUM_SITES
+} movement_lint_site_t;
+
+void _movement_lint_note(movement_lint_site_t site, const char *file, int line);
+
+// Cycles every watch face through activate, ticks, button presses, low energy and resign, and prints each face
+// that left the tick rate, a peripheral, the LED, the accelerometer or a background task in a worse state than it
+// found it, or that refused to sleep in low energy mode. Meant for the simulator: it really does press the faces'
+// buttons. Returns the number of faces flagged.
+uint8_t movement_power_lint(void);
+
+#define movement_request_tick_frequency(...) (_movement_lint_note(MOVEMENT_LINT_TICK_FREQUENCY, __FILE__, __LINE__), movement_request_tick_frequency(__VA_ARGS__))
+#define movement_request_tick_period(...) (_movement_lint_note(MOVEMENT_LINT_TICK_FREQUENCY, __FILE__, __LINE__), movement_request_tick_period(__VA_ARGS__))
+#define movement_schedule_background_task(...) (_movement_lint_note(MOVEMENT_LINT_BACKGROUND_TASK, __FILE__, __LINE__), movement_schedule_background_task(__VA_ARGS__))
+#define movement_schedule_background_task_for_face(...) (_movement_lint_note(MOVEMENT_LINT_BACKGROUND_TASK, __FILE__, __LINE__), movement_schedule_background_task_for_face(__VA_ARGS__))
+#define movement_set_accelerometer_background_rate(...) (_movement_lint_note(MOVEMENT_LINT_ACCELEROMETER, __FILE__, __LINE__), movement_set_accelerometer_background_rate(__VA_ARGS__))
+#define movement_enable_tap_detection_if_available(...) (_movement_lint_note(MOVEMENT_LINT_ACCELEROMETER, __FILE__, __LINE__), movement_enable_tap_detection_if_available(__VA_ARGS__))
+#define movement_force_led_on(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), movement_force_led_on(__VA_ARGS__))
+#define watch_set_led_color(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), watch_set_led_color(__VA_ARGS__))
+#define watch_set_led_color_rgb(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), watch_set_led_color_rgb(__VA_ARGS__))
+#define watch_set_led_red(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), watch_set_led_red(__VA_ARGS__))
+#define watch_set_led_green(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), watch_set_led_green(__VA_ARGS__))
+#define watch_set_led_yellow(...) (_movement_lint_note(MOVEMENT_LINT_LED, __FILE__, __LINE__), watch_set_led_yellow(__VA_ARGS__))
+#define watch_enable_buzzer(...) (_movement_lint_note(MOVEMENT_LINT_BUZZER, __FILE__, __LINE__), watch_enable_buzzer(__VA_ARGS__))
+#define watch_set_buzzer_on(...) (_movement_lint_note(MOVEMENT_LINT_BUZZER, __FILE__, __LINE__), watch_set_buzzer_on(__VA_ARGS__))
+#define watch_buzzer_play_sequence(...) (_movement_lint_note(MOVEMENT_LINT_BUZZER, __FILE__, __LINE__), watch_buzzer_play_sequence(__VA_ARGS__))
+#define watch_buzzer_play_tune(...) (_movement_lint_note(MOVEMENT_LINT_BUZZER, __FILE__, __LINE__), watch_buzzer_play_tune(__VA_ARGS__))
+#define watch_enable_i2c(...) (_movement_lint_note(MOVEMENT_LINT_PERIPHERAL, __FILE__, __LINE__), watch_enable_i2c(__VA_ARGS__))
+#define watch_enable_spi(...) (_movement_lint_note(MOVEMENT_LINT_PERIPHERAL, __FILE__, __LINE__), watch_enable_spi(__VA_ARGS__))
+#define watch_enable_adc(...) (_movement_lint_note(MOVEMENT_LINT_PERIPHERAL, __FILE__, __LINE__), watch_enable_adc(__VA_ARGS__))
+#endif
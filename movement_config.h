@@ -96,6 +96,13 @@ const watch_face_t watch_faces[] = {
  */
 #define MOVEMENT_DEFAULT_LOW_ENERGY_INTERVAL 2
 
+/* Set the time, in minutes after entering low energy mode, before the watch
+ * enters deep standby: the display is switched off entirely and the watch
+ * only wakes for the ALARM button (or motion, if an accelerometer is fitted).
+ * 0 disables deep standby.
+ */
+#define MOVEMENT_DEFAULT_STANDBY_INTERVAL 0
+
 /* Set the led duration
  * Valid values are:
  * 0: No LED
@@ -24,233 +24,225 @@
 
 #pragma once
 
+// Signal tunes are stored in the compact tune format described in watch_tcc.h: each note is followed by its
+// duration in 1/64 second units, and BUZZER_TUNE_REPEAT_START / BUZZER_TUNE_REPEAT_END can be used to loop a
+// section instead of spelling it out. utils/buzzer_tune_compiler can generate these arrays from a text notation.
+
 #ifdef SIGNAL_TUNE_DEFAULT
-int8_t signal_tune[] = {
-    BUZZER_NOTE_C8, 5,
-    BUZZER_NOTE_REST, 6,
-    BUZZER_NOTE_C8, 5,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 6,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_DEFAULT
 
 #ifdef SIGNAL_TUNE_ZELDA_SECRET
-int8_t signal_tune[] = {
-    BUZZER_NOTE_G5, 8,
-    BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-    BUZZER_NOTE_D5SHARP_E5FLAT, 8,
-    BUZZER_NOTE_A4, 8,
-    BUZZER_NOTE_G4SHARP_A4FLAT, 8,
-    BUZZER_NOTE_E5, 8,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 8,
-    BUZZER_NOTE_C6, 20,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5SHARP_G5FLAT), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D5SHARP_E5FLAT), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A4), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G4SHARP_A4FLAT), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E5), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5SHARP_A5FLAT), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C6), 21,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_ZELDA_SECRET
 
 #ifdef SIGNAL_TUNE_MARIO_THEME
-int8_t signal_tune[] = {
-    BUZZER_NOTE_E6, 7,
-    BUZZER_NOTE_REST, 2,
-    BUZZER_NOTE_E6, 7,
-    BUZZER_NOTE_REST, 10,
-    BUZZER_NOTE_E6, 7,
-    BUZZER_NOTE_REST, 11,
-    BUZZER_NOTE_C6, 7,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_E6, 7,
-    BUZZER_NOTE_REST, 10,
-    BUZZER_NOTE_G6, 8,
-    BUZZER_NOTE_REST, 30,
-    BUZZER_NOTE_G5, 8,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 3,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 11,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 12,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C6), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 11,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 31,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5), 9,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_MARIO_THEME
 
 #ifdef SIGNAL_TUNE_MGS_CODEC
-int8_t signal_tune[] = {
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_REST, 6,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 1,
-    BUZZER_NOTE_C6, 1,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_REPEAT_START,
+        BUZZER_TUNE_NOTE(BUZZER_NOTE_G5SHARP_A5FLAT), 2,
+        BUZZER_TUNE_NOTE(BUZZER_NOTE_C6), 2,
+    BUZZER_TUNE_REPEAT_END, 4,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 7,
+    BUZZER_TUNE_REPEAT_START,
+        BUZZER_TUNE_NOTE(BUZZER_NOTE_G5SHARP_A5FLAT), 2,
+        BUZZER_TUNE_NOTE(BUZZER_NOTE_C6), 2,
+    BUZZER_TUNE_REPEAT_END, 4,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_MGS_CODEC
 
 #ifdef SIGNAL_TUNE_KIM_POSSIBLE
-int8_t signal_tune[] = {
-    BUZZER_NOTE_G7, 6,
-    BUZZER_NOTE_G4, 2,
-    BUZZER_NOTE_REST, 5,
-    BUZZER_NOTE_G7, 6,
-    BUZZER_NOTE_G4, 2,
-    BUZZER_NOTE_REST, 5,
-    BUZZER_NOTE_A7SHARP_B7FLAT, 6,
-    BUZZER_NOTE_REST, 2,
-    BUZZER_NOTE_G7, 6,
-    BUZZER_NOTE_G4, 2,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G4), 3,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G4), 3,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A7SHARP_B7FLAT), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 3,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G4), 3,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_KIM_POSSIBLE
 
 #ifdef SIGNAL_TUNE_POWER_RANGERS
-int8_t signal_tune[] = {
-    BUZZER_NOTE_D8, 6,
-    BUZZER_NOTE_REST, 8,
-    BUZZER_NOTE_D8, 6,
-    BUZZER_NOTE_REST, 8,
-    BUZZER_NOTE_C8, 6,
-    BUZZER_NOTE_REST, 2,
-    BUZZER_NOTE_D8, 6,
-    BUZZER_NOTE_REST, 8,
-    BUZZER_NOTE_F8, 6,
-    BUZZER_NOTE_REST, 8,
-    BUZZER_NOTE_D8, 6,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D8), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D8), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 3,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D8), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F8), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D8), 7,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_POWER_RANGERS
 
 #ifdef SIGNAL_TUNE_LAYLA
-int8_t signal_tune[] = {
-    BUZZER_NOTE_A6, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_C7, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_D7, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F7, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_D7, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_C7, 5,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_D7, 20,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A6), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D7), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F7), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D7), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D7), 21,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_LAYLA
 
 #ifdef SIGNAL_TUNE_HARRY_POTTER_SHORT
-int8_t signal_tune[] = {
-    BUZZER_NOTE_B5, 12,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_E6, 12,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_G6, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6SHARP_G6FLAT, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_E6, 16,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_B6, 8,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_A6, 24,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6SHARP_G6FLAT, 24,
-    0
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 13,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 13,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6SHARP_G6FLAT), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 17,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A6), 25,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6SHARP_G6FLAT), 25,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_HARRY_POTTER_SHORT
 
 #ifdef SIGNAL_TUNE_HARRY_POTTER_LONG
-int8_t signal_tune[] = {
-    BUZZER_NOTE_B5, 12,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_E6, 12,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_G6, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6SHARP_G6FLAT, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_E6, 16,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_B6, 8,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_A6, 24,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6SHARP_G6FLAT, 24,
-    BUZZER_NOTE_REST, 1,
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 13,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 13,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6SHARP_G6FLAT), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 17,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A6), 25,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6SHARP_G6FLAT), 25,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
 
-    BUZZER_NOTE_E6, 12,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_G6, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6SHARP_G6FLAT, 6,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_D6SHARP_E6FLAT, 16,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_F6, 8,
-    BUZZER_NOTE_REST, 1,
-    BUZZER_NOTE_B5, 24,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E6), 13,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6SHARP_G6FLAT), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D6SHARP_E6FLAT), 17,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 25,
 
-    0
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_HARRY_POTTER_LONG
 
 #ifdef SIGNAL_TUNE_JURASSIC_PARK
-int8_t signal_tune[] = {
-    BUZZER_NOTE_B5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_B5, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_E5, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_B5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_B5, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_E5, 13,
-    0,
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A5SHARP_B5FLAT), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5SHARP_G5FLAT), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E5), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A5SHARP_B5FLAT), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B5), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5SHARP_G5FLAT), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E5), 14,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_JURASSIC_PARK
 
 #ifdef SIGNAL_TUNE_EVANGELION
-int8_t signal_tune[] = {
-    BUZZER_NOTE_C5, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_D5SHARP_E5FLAT, 13,
-    BUZZER_NOTE_REST, 13,
-    BUZZER_NOTE_F5, 13,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_D5SHARP_E5FLAT, 13,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_G5, 3,
-    BUZZER_NOTE_REST, 3,
-    BUZZER_NOTE_F5, 7,
-    BUZZER_NOTE_REST, 7,
-    BUZZER_NOTE_G5, 13,
-    0,
+const uint8_t signal_tune[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C5), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D5SHARP_E5FLAT), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_D5SHARP_E5FLAT), 14,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_A5SHARP_B5FLAT), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5SHARP_A5FLAT), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5), 4,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 4,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F5), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 8,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G5), 14,
+    BUZZER_TUNE_END
 };
 #endif // SIGNAL_TUNE_EVANGELION
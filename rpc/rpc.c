@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "rpc.h"
+#include "filesystem.h"
+#include "movement.h"
+#include "watch_utility.h"
+#include "zones.h"
+
+// the frame being received: bytes so far, and how many it will have once the length byte is in.
+static uint8_t _rpc_frame[RPC_MAX_FRAME];
+static uint8_t _rpc_frame_length = 0;
+static uint8_t _rpc_frame_expected = 0;
+
+static uint16_t _rpc_checksum(const uint8_t *data, uint16_t length) {
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint16_t _rpc_get_u16(const uint8_t *data) {
+    return data[0] | (data[1] << 8);
+}
+
+static uint32_t _rpc_get_u32(const uint8_t *data) {
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static uint8_t _rpc_put_u16(uint8_t *data, uint16_t value) {
+    data[0] = value;
+    data[1] = value >> 8;
+    return 2;
+}
+
+static uint8_t _rpc_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = value;
+    data[1] = value >> 8;
+    data[2] = value >> 16;
+    data[3] = value >> 24;
+    return 4;
+}
+
+/// Copies a file name out of a payload, since the filesystem wants it terminated. Returns false if it's too long.
+static bool _rpc_get_filename(const uint8_t *data, uint8_t length, char *filename) {
+    if (length == 0 || length > 12) return false;
+    memcpy(filename, data, length);
+    filename[length] = 0;
+    return true;
+}
+
+/// Runs a command. The response payload goes in out, after the status; returns the status, and sets *out_length.
+static rpc_status_t _rpc_dispatch(uint8_t command, const uint8_t *in, uint8_t in_length, uint8_t *out,
+                                  uint8_t *out_length) {
+    char filename[13];
+    *out_length = 0;
+
+    switch (command) {
+        case RPC_COMMAND_HELLO:
+            out[0] = RPC_PROTOCOL_VERSION;
+            out[1] = RPC_MAX_PAYLOAD;
+            *out_length = 2;
+            return RPC_STATUS_OK;
+        case RPC_COMMAND_GET_SETTINGS:
+            *out_length = _rpc_put_u32(out, movement_get_settings().reg);
+            return RPC_STATUS_OK;
+        case RPC_COMMAND_SET_SETTINGS: {
+            if (in_length != 4) return RPC_STATUS_BAD_ARGUMENT;
+            movement_settings_t settings;
+            settings.reg = _rpc_get_u32(in);
+            // a different layout would scramble every field.
+            if (settings.bit.version != movement_get_settings().bit.version) return RPC_STATUS_BAD_ARGUMENT;
+            if (settings.bit.time_zone >= NUM_ZONE_NAMES) return RPC_STATUS_BAD_ARGUMENT;
+            movement_set_settings(settings);
+            movement_store_settings();
+            return RPC_STATUS_OK;
+        }
+        case RPC_COMMAND_GET_TIME:
+            *out_length = _rpc_put_u32(out, watch_utility_date_time_to_unix_time(movement_get_utc_date_time(), 0));
+            out[(*out_length)++] = movement_get_timezone_index();
+            *out_length += _rpc_put_u32(out + *out_length, movement_get_current_timezone_offset());
+            return RPC_STATUS_OK;
+        case RPC_COMMAND_SET_TIME: {
+            if (in_length != 5 || in[4] >= NUM_ZONE_NAMES) return RPC_STATUS_BAD_ARGUMENT;
+            movement_set_timezone_index(in[4]);
+            int32_t offset = movement_get_current_timezone_offset();
+            movement_set_local_date_time(watch_utility_date_time_from_unix_time(_rpc_get_u32(in), offset));
+            movement_store_settings();
+            return RPC_STATUS_OK;
+        }
+        case RPC_COMMAND_LIST_FACES:
+            out[0] = movement_get_num_faces();
+            out[1] = movement_get_current_face();
+            *out_length = 2;
+            return RPC_STATUS_OK;
+        case RPC_COMMAND_READ_FILE: {
+            if (in_length < 4 || !_rpc_get_filename(in + 3, in_length - 3, filename)) return RPC_STATUS_BAD_ARGUMENT;
+            uint16_t offset = _rpc_get_u16(in);
+            uint8_t length = in[2];
+            if (length > RPC_MAX_PAYLOAD - 3) return RPC_STATUS_BAD_ARGUMENT;
+            int32_t size = filesystem_get_file_size(filename);
+            if (size < 0) return RPC_STATUS_FAILED;
+            *out_length = _rpc_put_u16(out, size);
+            if (offset >= size) return RPC_STATUS_OK;
+            int32_t read = filesystem_read_file_at(filename, (char *)out + 2, offset, length);
+            if (read < 0) return RPC_STATUS_FAILED;
+            *out_length += read;
+            return RPC_STATUS_OK;
+        }
+        case RPC_COMMAND_WRITE_FILE: {
+            if (in_length < 4 || in[2] + 3 > in_length) return RPC_STATUS_BAD_ARGUMENT;
+            if (!_rpc_get_filename(in + 3, in[2], filename)) return RPC_STATUS_BAD_ARGUMENT;
+            uint16_t offset = _rpc_get_u16(in);
+            char *data = (char *)in + 3 + in[2];
+            int32_t length = in_length - 3 - in[2];
+            bool ok;
+            if (offset == 0) {
+                ok = filesystem_write_file(filename, data, length);
+            } else {
+                // chunks arrive in order, so anything else means one was lost.
+                if (filesystem_get_file_size(filename) != offset) return RPC_STATUS_BAD_ARGUMENT;
+                ok = filesystem_append_file(filename, data, length);
+            }
+            return ok ? RPC_STATUS_OK : RPC_STATUS_FAILED;
+        }
+        default:
+            return RPC_STATUS_UNKNOWN_COMMAND;
+    }
+}
+
+uint8_t rpc_handle_frame(const uint8_t *request, uint8_t length, uint8_t *response) {
+    uint8_t command = length > 1 ? request[1] : 0;
+    uint8_t payload_length = 0;
+    rpc_status_t status;
+
+    if (length < RPC_FRAME_OVERHEAD || request[0] != RPC_FRAME_START || request[2] != length - RPC_FRAME_OVERHEAD ||
+        _rpc_checksum(request + 1, length - 3) != _rpc_get_u16(request + length - 2)) {
+        status = RPC_STATUS_BAD_FRAME;
+    } else {
+        status = _rpc_dispatch(command, request + 3, request[2], response + 4, &payload_length);
+    }
+
+    response[0] = RPC_FRAME_START;
+    response[1] = command | RPC_RESPONSE_FLAG;
+    response[2] = payload_length + 1;
+    response[3] = status;
+    _rpc_put_u16(response + 4 + payload_length, _rpc_checksum(response + 1, payload_length + 3));
+
+    return payload_length + 4 + 2;
+}
+
+bool rpc_receive(uint8_t byte, bool at_line_start) {
+    if (_rpc_frame_length == 0) {
+        if (byte != RPC_FRAME_START || !at_line_start) return false;
+        _rpc_frame_expected = RPC_FRAME_OVERHEAD;
+    }
+
+    _rpc_frame[_rpc_frame_length++] = byte;
+    if (_rpc_frame_length == 3) {
+        // a length we can't hold is answered now; the rest of that frame reaches the shell as garbage.
+        if (byte > RPC_MAX_PAYLOAD) _rpc_frame_expected = _rpc_frame_length;
+        else _rpc_frame_expected = byte + RPC_FRAME_OVERHEAD;
+    }
+    if (_rpc_frame_length < _rpc_frame_expected) return true;
+
+    uint8_t response[RPC_MAX_FRAME];
+    uint8_t response_length = rpc_handle_frame(_rpc_frame, _rpc_frame_length, response);
+    _rpc_frame_length = 0;
+
+    // one write, so that the USB stack sends the whole response in one packet.
+    fwrite(response, 1, response_length, stdout);
+    fflush(stdout);
+
+    return true;
+}
+
+static int _rpc_hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+int rpc_cmd(int argc, char *argv[]) {
+    (void) argc;
+    uint8_t request[RPC_MAX_FRAME];
+    uint8_t response[RPC_MAX_FRAME];
+    size_t digits = strlen(argv[1]);
+
+    if (digits % 2 || digits / 2 > RPC_MAX_FRAME) return -2;
+    for (size_t i = 0; i < digits / 2; i++) {
+        int high = _rpc_hex_value(argv[1][i * 2]);
+        int low = _rpc_hex_value(argv[1][i * 2 + 1]);
+        if (high < 0 || low < 0) return -2;
+        request[i] = (high << 4) | low;
+    }
+
+    uint8_t response_length = rpc_handle_frame(request, digits / 2, response);
+    printf("rpc: ");
+    for (uint8_t i = 0; i < response_length; i++) printf("%02x", response[i]);
+    printf("\r\n");
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Settings RPC
+ *
+ * A compact binary protocol for reading and changing the watch's settings from a computer, sharing the USB serial
+ * port with the shell. utils/settings_rpc/settings_rpc.py is a client for it.
+ *
+ * A request is a frame: RPC_FRAME_START, a command, the payload length, the payload, and a CRC-16/CCITT-FALSE of
+ * the command, length and payload, low byte first. The response is a frame for the same command with
+ * RPC_RESPONSE_FLAG set, whose payload starts with an rpc_status_t. A frame is at most RPC_MAX_FRAME bytes, so
+ * each response goes out in a single USB packet. Numbers are little endian.
+ *
+ * The shell only hands over a frame that starts at the beginning of a line, so typed text can't start one.
+ */
+
+#define RPC_FRAME_START 0xA5
+#define RPC_RESPONSE_FLAG 0x80
+#define RPC_MAX_FRAME 64                            // one full speed USB packet
+#define RPC_FRAME_OVERHEAD 5                        // start, command, length and checksum
+#define RPC_MAX_PAYLOAD (RPC_MAX_FRAME - RPC_FRAME_OVERHEAD)
+#define RPC_PROTOCOL_VERSION 1
+
+typedef enum {
+    RPC_COMMAND_HELLO = 0x01,           // -> version u8, largest payload u8
+    RPC_COMMAND_GET_SETTINGS = 0x02,    // -> movement_settings_t u32
+    RPC_COMMAND_SET_SETTINGS = 0x03,    // movement_settings_t u32; applied and stored
+    RPC_COMMAND_GET_TIME = 0x04,        // -> UNIX time u32 (UTC), zone index u8, current UTC offset s32 in seconds
+    RPC_COMMAND_SET_TIME = 0x05,        // UNIX time u32 (UTC), zone index u8
+    RPC_COMMAND_LIST_FACES = 0x06,      // -> number of faces u8, face on screen u8
+    RPC_COMMAND_READ_FILE = 0x07,       // offset u16, length u8, name -> file size u16, data
+    RPC_COMMAND_WRITE_FILE = 0x08,      // offset u16, name length u8, name, data; offset 0 replaces the file,
+                                        // otherwise it must be the file's size, and the data is appended
+} rpc_command_t;
+
+typedef enum {
+    RPC_STATUS_OK = 0,
+    RPC_STATUS_BAD_FRAME,               // the checksum didn't match, or the frame was too long
+    RPC_STATUS_UNKNOWN_COMMAND,
+    RPC_STATUS_BAD_ARGUMENT,            // wrong payload length, or a value out of range
+    RPC_STATUS_FAILED,                  // the watch couldn't do it, e.g. a missing file or a full filesystem
+} rpc_status_t;
+
+/** @brief Feeds the RPC endpoint one byte from the serial port, and answers on stdout when a frame is complete.
+  * @param byte The byte received.
+  * @param at_line_start true if the shell has nothing on its current line, the only place a frame may start.
+  * @return true if the byte belonged to a frame, false if it is the shell's.
+  */
+bool rpc_receive(uint8_t byte, bool at_line_start);
+
+/** @brief Handles one complete request frame.
+  * @param request The frame, from RPC_FRAME_START to the checksum.
+  * @param length The number of bytes in the frame.
+  * @param response A buffer of at least RPC_MAX_FRAME bytes for the response frame.
+  * @return The length of the response frame.
+  */
+uint8_t rpc_handle_frame(const uint8_t *request, uint8_t length, uint8_t *response);
+
+// the shell's way in, for the simulator and for terminals that can't send binary: takes a frame in hex, prints the
+// response in hex.
+int rpc_cmd(int argc, char *argv[]);
@@ -0,0 +1,321 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Sends request frames through the RPC endpoint, byte by byte as the shell would, and checks the responses: framing,
+// damaged and oversized frames, settings, time and zone, and a file written in chunks and read back. Also checks
+// that every response fits the single USB packet the endpoint promises.
+// Built and run by `make -C test`.
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+#include "../rpc.c"
+
+static movement_settings_t settings;
+static uint32_t stored_settings;
+static uint32_t utc_time = 1767225600;      // 2026-01-01 00:00:00 UTC
+static uint8_t zone;
+
+movement_settings_t movement_get_settings(void) { return settings; }
+void movement_set_settings(movement_settings_t value) { settings = value; }
+void movement_store_settings(void) { stored_settings = settings.reg; }
+uint8_t movement_get_num_faces(void) { return 12; }
+uint8_t movement_get_current_face(void) { return 3; }
+int32_t movement_get_timezone_index(void) { return zone; }
+void movement_set_timezone_index(uint8_t value) { zone = value; settings.bit.time_zone = value; }
+// zone n is n hours ahead of UTC.
+int32_t movement_get_current_timezone_offset(void) { return zone * 3600; }
+watch_date_time_t movement_get_utc_date_time(void) { return (watch_date_time_t){utc_time}; }
+void movement_set_local_date_time(watch_date_time_t date_time) { utc_time = date_time.reg - zone * 3600; }
+
+static char file_name[13];
+static uint8_t file[512];
+static int32_t file_size = -1;
+
+int32_t filesystem_get_file_size(char *filename) {
+    return strcmp(filename, file_name) ? -1 : file_size;
+}
+
+int32_t filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length) {
+    if (strcmp(filename, file_name)) return -1;
+    if (offset >= file_size) return 0;
+    if (length > file_size - offset) length = file_size - offset;
+    memcpy(buf, file + offset, length);
+    return length;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    strcpy(file_name, filename);
+    memcpy(file, text, length);
+    file_size = length;
+    return true;
+}
+
+bool filesystem_append_file(char *filename, char *text, int32_t length) {
+    if (strcmp(filename, file_name) || file_size + length > (int32_t)sizeof(file)) return false;
+    memcpy(file + file_size, text, length);
+    file_size += length;
+    return true;
+}
+
+static uint8_t response[256];
+static long response_length;
+static FILE *console;
+
+/// Sends what the endpoint writes to a scratch file instead of the console, until end_capture.
+static void begin_capture(void) {
+    fflush(stdout);
+    console = stdout;
+    stdout = tmpfile();
+}
+
+/// Puts the console back, and leaves what was written in response. Assertions wait until after this, so that
+/// Unity's report reaches the console.
+static void end_capture(void) {
+    fflush(stdout);
+    response_length = ftell(stdout);
+    rewind(stdout);
+    size_t read = fread(response, 1, response_length, stdout);
+    fclose(stdout);
+    stdout = console;
+    TEST_ASSERT_EQUAL(response_length, read);
+}
+
+/// Builds a frame and feeds it to the endpoint a byte at a time, capturing what it writes back.
+static void send(uint8_t command, const uint8_t *payload, uint8_t length) {
+    uint8_t frame[RPC_MAX_FRAME + 8];
+    frame[0] = RPC_FRAME_START;
+    frame[1] = command;
+    frame[2] = length;
+    if (length) memcpy(frame + 3, payload, length);
+    _rpc_put_u16(frame + 3 + length, _rpc_checksum(frame + 1, length + 2));
+
+    bool consumed = true;
+    begin_capture();
+    for (uint8_t i = 0; i < length + RPC_FRAME_OVERHEAD; i++) consumed = rpc_receive(frame[i], true) && consumed;
+    end_capture();
+    TEST_ASSERT_TRUE(consumed);
+}
+
+/// Checks that the response is a well formed frame for the command, and returns its status.
+static uint8_t status_of(uint8_t command) {
+    TEST_ASSERT_GREATER_OR_EQUAL(RPC_FRAME_OVERHEAD + 1, response_length);
+    TEST_ASSERT_LESS_OR_EQUAL(RPC_MAX_FRAME, response_length);
+    TEST_ASSERT_EQUAL_HEX8(RPC_FRAME_START, response[0]);
+    TEST_ASSERT_EQUAL_HEX8(command | RPC_RESPONSE_FLAG, response[1]);
+    TEST_ASSERT_EQUAL(response_length - RPC_FRAME_OVERHEAD, response[2]);
+    TEST_ASSERT_EQUAL_HEX16(_rpc_get_u16(response + response_length - 2), _rpc_checksum(response + 1, response_length - 3));
+    return response[3];
+}
+
+void setUp(void) {
+    settings.reg = 0;
+    settings.bit.version = 1;
+    stored_settings = 0;
+    utc_time = 1767225600;
+    zone = 0;
+    file_name[0] = '\0';
+    file_size = -1;
+}
+
+void tearDown(void) {
+}
+
+static void test_hello(void) {
+    send(RPC_COMMAND_HELLO, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_HELLO));
+    TEST_ASSERT_EQUAL(RPC_PROTOCOL_VERSION, response[4]);
+    TEST_ASSERT_EQUAL(RPC_MAX_PAYLOAD, response[5]);
+}
+
+static void test_unknown_command(void) {
+    send(0x7F, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_UNKNOWN_COMMAND, status_of(0x7F));
+}
+
+// a damaged frame is answered, and the next one still gets through.
+static void test_bad_frames_are_answered(void) {
+    const uint8_t damaged[] = {RPC_FRAME_START, RPC_COMMAND_HELLO, 0, 0x12, 0x34};
+    begin_capture();
+    for (uint8_t i = 0; i < sizeof(damaged); i++) rpc_receive(damaged[i], true);
+    // so is one too long to hold, as soon as its length arrives.
+    rpc_receive(RPC_FRAME_START, true);
+    rpc_receive(RPC_COMMAND_HELLO, true);
+    bool length_consumed = rpc_receive(RPC_MAX_PAYLOAD + 1, true);
+    bool next_consumed = rpc_receive('x', true);
+    end_capture();
+    TEST_ASSERT_TRUE(length_consumed);
+    TEST_ASSERT_FALSE(next_consumed);
+    TEST_ASSERT_EQUAL(2 * (RPC_FRAME_OVERHEAD + 1), response_length);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_BAD_FRAME, response[3]);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_BAD_FRAME, response[RPC_FRAME_OVERHEAD + 1 + 3]);
+
+    send(RPC_COMMAND_HELLO, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_HELLO));
+}
+
+// the start byte only starts a frame at the beginning of a line.
+static void test_start_byte_mid_line_is_ignored(void) {
+    TEST_ASSERT_FALSE(rpc_receive(RPC_FRAME_START, false));
+}
+
+// settings: read, change, and refuse a different layout version.
+static void test_settings(void) {
+    uint8_t payload[RPC_MAX_PAYLOAD];
+    settings.bit.le_interval = 2;
+    send(RPC_COMMAND_GET_SETTINGS, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_GET_SETTINGS));
+    TEST_ASSERT_EQUAL_HEX32(settings.reg, _rpc_get_u32(response + 4));
+
+    movement_settings_t changed = settings;
+    changed.bit.le_interval = 5;
+    changed.bit.clock_mode_24h = true;
+    _rpc_put_u32(payload, changed.reg);
+    send(RPC_COMMAND_SET_SETTINGS, payload, 4);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_SET_SETTINGS));
+    TEST_ASSERT_EQUAL_HEX32(changed.reg, settings.reg);
+    TEST_ASSERT_EQUAL_HEX32(changed.reg, stored_settings);
+
+    changed.bit.version = 2;
+    _rpc_put_u32(payload, changed.reg);
+    send(RPC_COMMAND_SET_SETTINGS, payload, 4);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_BAD_ARGUMENT, status_of(RPC_COMMAND_SET_SETTINGS));
+    TEST_ASSERT_EQUAL(1, settings.bit.version);
+}
+
+static void test_time_and_zone(void) {
+    uint8_t payload[RPC_MAX_PAYLOAD];
+    _rpc_put_u32(payload, 1800000000);
+    payload[4] = 2;
+    send(RPC_COMMAND_SET_TIME, payload, 5);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_SET_TIME));
+    TEST_ASSERT_EQUAL_UINT32(1800000000, utc_time);
+    TEST_ASSERT_EQUAL_UINT8(2, zone);
+    TEST_ASSERT_EQUAL_HEX32(settings.reg, stored_settings);
+
+    send(RPC_COMMAND_GET_TIME, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_GET_TIME));
+    TEST_ASSERT_EQUAL_UINT32(1800000000, _rpc_get_u32(response + 4));
+    TEST_ASSERT_EQUAL_UINT8(2, response[8]);
+    TEST_ASSERT_EQUAL_INT32(7200, _rpc_get_u32(response + 9));
+
+    payload[4] = NUM_ZONE_NAMES;
+    send(RPC_COMMAND_SET_TIME, payload, 5);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_BAD_ARGUMENT, status_of(RPC_COMMAND_SET_TIME));
+}
+
+static void test_list_faces(void) {
+    send(RPC_COMMAND_LIST_FACES, NULL, 0);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_LIST_FACES));
+    TEST_ASSERT_EQUAL_UINT8(12, response[4]);
+    TEST_ASSERT_EQUAL_UINT8(3, response[5]);
+}
+
+// a file written in chunks as large as a frame allows, then read back the same way.
+static void test_file_round_trip(void) {
+    uint8_t payload[RPC_MAX_PAYLOAD];
+    uint8_t contents[200];
+    for (uint16_t i = 0; i < sizeof(contents); i++) contents[i] = i * 7;
+    const char *name = "wclk_001.u32";
+    uint8_t name_length = strlen(name);
+    uint8_t chunk = RPC_MAX_PAYLOAD - 3 - name_length;
+    uint16_t writes = 0, reads = 0;
+    for (uint16_t offset = 0; offset < sizeof(contents); offset += chunk) {
+        uint8_t length = sizeof(contents) - offset < chunk ? sizeof(contents) - offset : chunk;
+        _rpc_put_u16(payload, offset);
+        payload[2] = name_length;
+        memcpy(payload + 3, name, name_length);
+        memcpy(payload + 3 + name_length, contents + offset, length);
+        send(RPC_COMMAND_WRITE_FILE, payload, 3 + name_length + length);
+        TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_WRITE_FILE));
+        writes++;
+    }
+    TEST_ASSERT_EQUAL_INT32(sizeof(contents), file_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(contents, file, sizeof(contents));
+
+    // a chunk that doesn't follow on from the last one means one went missing.
+    _rpc_put_u16(payload, 10);
+    send(RPC_COMMAND_WRITE_FILE, payload, 3 + name_length + 1);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_BAD_ARGUMENT, status_of(RPC_COMMAND_WRITE_FILE));
+
+    uint8_t readback[sizeof(contents)];
+    uint16_t offset = 0;
+    while (true) {
+        _rpc_put_u16(payload, offset);
+        payload[2] = RPC_MAX_PAYLOAD - 3;
+        memcpy(payload + 3, name, name_length);
+        send(RPC_COMMAND_READ_FILE, payload, 3 + name_length);
+        TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_OK, status_of(RPC_COMMAND_READ_FILE));
+        TEST_ASSERT_EQUAL_UINT16(sizeof(contents), _rpc_get_u16(response + 4));
+        uint8_t length = response_length - RPC_FRAME_OVERHEAD - 3;
+        if (length == 0) break;
+        TEST_ASSERT_LESS_OR_EQUAL(sizeof(contents), offset + length);
+        memcpy(readback + offset, response + 6, length);
+        offset += length;
+        reads++;
+    }
+    TEST_ASSERT_EQUAL_UINT16(sizeof(contents), offset);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(contents, readback, sizeof(contents));
+    printf("%u byte file: written in %u requests, read in %u\n", (unsigned)sizeof(contents), writes, reads);
+
+    memcpy(payload + 3, "nothing", 7);
+    send(RPC_COMMAND_READ_FILE, payload, 3 + 7);
+    TEST_ASSERT_EQUAL_HEX8(RPC_STATUS_FAILED, status_of(RPC_COMMAND_READ_FILE));
+}
+
+// the shell's hex way in.
+static void test_shell_command(void) {
+    char hex[11];
+    uint16_t checksum = _rpc_checksum((const uint8_t *)"\x01\x00", 2);
+    sprintf(hex, "a50100%02x%02x", checksum & 0xFF, checksum >> 8);
+    char *argv[] = {"rpc", hex};
+    begin_capture();
+    int result = rpc_cmd(2, argv);
+    end_capture();
+    TEST_ASSERT_EQUAL_INT(0, result);
+    // the response frame comes back in hex too.
+    TEST_ASSERT_EQUAL_STRING_LEN("rpc: a581", (char *)response, 9);
+
+    char bad[] = "a5010";
+    argv[1] = bad;
+    begin_capture();
+    result = rpc_cmd(2, argv);
+    end_capture();
+    TEST_ASSERT_EQUAL_INT(-2, result);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hello);
+    RUN_TEST(test_unknown_command);
+    RUN_TEST(test_bad_frames_are_answered);
+    RUN_TEST(test_start_byte_mid_line_is_ignored);
+    RUN_TEST(test_settings);
+    RUN_TEST(test_time_and_zone);
+    RUN_TEST(test_list_faces);
+    RUN_TEST(test_file_round_trip);
+    RUN_TEST(test_shell_command);
+    return UNITY_END();
+}
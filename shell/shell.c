@@ -45,6 +45,7 @@
 
 #include "watch.h"
 #include "shell_cmd_list.h"
+#include "rpc.h"
 
 extern shell_command_t g_shell_commands[];
 extern const size_t g_num_shell_commands;
@@ -197,6 +198,9 @@ void shell_task(void) {
             break;
         }
 
+        // a settings RPC frame may start where a command would.
+        if (rpc_receive(c, s_buf_len == 0)) continue;
+
         if (c == '\b') {
             // Handle backspace character.
             // We need to emit a backspace, overwrite the character on the
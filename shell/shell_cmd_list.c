@@ -27,14 +27,39 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
+#include "filesystem_log.h"
 #include "watch.h"
+#include "watch_utility.h"
 #include "delay.h"
+#include "movement.h"
+#include "rpc.h"
+#include "temperature_archive.h"
+#include "tick_arbiter.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int power_cmd(int argc, char *argv[]);
+static int standby_cmd(int argc, char *argv[]);
+static int periph_cmd(int argc, char *argv[]);
+static int mem_cmd(int argc, char *argv[]);
+static int wakes_cmd(int argc, char *argv[]);
+static int trace_cmd(int argc, char *argv[]);
+#ifdef MOVEMENT_POWER_LINT
+static int lint_cmd(int argc, char *argv[]);
+#endif
+#ifdef __EMSCRIPTEN__
+static int timescale_cmd(int argc, char *argv[]);
+static int lcdbench_cmd(int argc, char *argv[]);
+static int drain_cmd(int argc, char *argv[]);
+#endif
 
 shell_command_t g_shell_commands[] = {
     {
@@ -107,6 +132,20 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "logcat",
+        .help = "usage: logcat <PATH>",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_logcat,
+    },
+    {
+        .name = "temps",
+        .help = "print the temperature archive's hourly summaries and histogram",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = temperature_archive_cmd_temps,
+    },
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -114,6 +153,87 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "power",
+        .help = "measure the battery and print power governor state",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = power_cmd,
+    },
+    {
+        .name = "standby",
+        .help = "print wakes from sleep and deep standby state; usage: standby [MINUTES]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = standby_cmd,
+    },
+    {
+        .name = "periph",
+        .help = "print peripherals that are powered and their number of users",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = periph_cmd,
+    },
+    {
+        .name = "mem",
+        .help = "print heap and stack usage, and heap held by each watch face",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = mem_cmd,
+    },
+    {
+        .name = "wakes",
+        .help = "print wakes and time awake for each watch face, and the wake budget",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = wakes_cmd,
+    },
+    {
+        .name = "rpc",
+        .help = "handle a settings RPC frame given in hex, and print the response in hex; usage: rpc HEX",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = rpc_cmd,
+    },
+    {
+        .name = "trace",
+        .help = "record and replay inputs; usage: trace [start|stop|dump|stats|replay]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = trace_cmd,
+    },
+#ifdef __EMSCRIPTEN__
+    {
+        .name = "timescale",
+        .help = "print or set how many times faster than real time the simulated clock runs; usage: timescale [FACTOR]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = timescale_cmd,
+    },
+    {
+        .name = "lcdbench",
+        .help = "redraw the whole display COUNT times (default 1000) and print how many updates per second it sustains",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = lcdbench_cmd,
+    },
+    {
+        .name = "drain",
+        .help = "step the battery from FROM to TO mV, one half-hourly sample per step, and log the supply changes; usage: drain FROM TO [STEPS]",
+        .min_args = 2,
+        .max_args = 3,
+        .cb = drain_cmd,
+    },
+#endif
+#ifdef MOVEMENT_POWER_LINT
+    {
+        .name = "lint",
+        .help = "run every face and list those that leave expensive state behind",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = lint_cmd,
+    },
+#endif
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -171,3 +291,248 @@ static int stress_cmd(int argc, char *argv[]) {
 
     return 0;
 }
+
+static int power_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    const char *level_names[] = {"normal", "reduced", "critical"};
+
+    // read the battery for display only; the level and trend follow Movement's scheduled samples.
+    movement_power_level_t level = movement_get_power_level();
+    printf("battery: %u mV now, %u mV at the last sample\r\n", watch_get_vcc_voltage(), movement_get_battery_voltage());
+    printf("level: %s\r\n", level_names[level]);
+    switch (level) {
+        case MOVEMENT_POWER_LEVEL_NORMAL:
+            printf("no limits\r\n");
+            break;
+        case MOVEMENT_POWER_LEVEL_REDUCED:
+            printf("LED at half brightness, 1 s dwell; buzzer duty 12%%\r\n");
+            break;
+        case MOVEMENT_POWER_LEVEL_CRITICAL:
+            printf("LED disabled; buzzer duty 5%%\r\n");
+            break;
+    }
+
+    watch_supply_config_t supply = watch_get_supply_config();
+    printf("trend: %u mV (%d mV/sample)\r\n", supply.trend_millivolts, supply.slope_millivolts);
+    printf("regulator: LPEFF %s\r\n", supply.lpeff ? "on" : "off");
+    if (supply.guard_armed) {
+        printf("brown-out guard: %u mV, PSEL %u\r\n", 1445 + 34 * supply.guard_level, supply.prescaler);
+    } else {
+        printf("brown-out guard: off\r\n");
+    }
+
+    return 0;
+}
+
+static int standby_cmd(int argc, char *argv[]) {
+    if (argc == 2) {
+        movement_set_standby_interval(atoi(argv[1]));
+        movement_store_settings();
+    }
+
+    uint16_t interval = movement_get_standby_interval();
+    if (interval) {
+        printf("standby after: %u min in low energy mode\r\n", interval);
+    } else {
+        printf("standby after: never\r\n");
+    }
+    printf("in standby: %s\r\n", movement_is_in_standby() ? "yes" : "no");
+    printf("wakes from sleep: %lu\r\n", (unsigned long)watch_get_sleep_wake_count());
+#ifdef __EMSCRIPTEN__
+    printf("wake latency: %lu us, worst %lu us\r\n", (unsigned long)watch_get_sleep_wake_latency_us(false),
+           (unsigned long)watch_get_sleep_wake_latency_us(true));
+#endif
+
+    return 0;
+}
+
+static int periph_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    for (uint8_t i = 0; i < WATCH_NUM_PERIPHERALS; i++) {
+        uint8_t users = watch_peripheral_get_users((watch_peripheral_t)i);
+        printf("%-5s %s (%u users)\r\n", watch_peripheral_get_name((watch_peripheral_t)i), users ? "on" : "off", users);
+    }
+
+    return 0;
+}
+
+static int mem_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    watch_memory_stats_t stats;
+
+    watch_memory_get_stats(&stats);
+    printf("heap: %lu bytes in use, peak %lu\r\n", (unsigned long)stats.heap_in_use, (unsigned long)stats.heap_peak);
+    printf("allocations: %lu, failed: %lu\r\n", (unsigned long)stats.allocations, (unsigned long)stats.failed_allocations);
+    if (stats.untracked_allocations) {
+        printf("untracked: %lu allocations, raise WATCH_MEMORY_MAX_BLOCKS\r\n", (unsigned long)stats.untracked_allocations);
+    }
+    if (stats.heap_largest_free) {
+        printf("free: %lu bytes, largest block %lu\r\n", (unsigned long)stats.heap_free, (unsigned long)stats.heap_largest_free);
+    } else {
+        printf("free: %lu bytes\r\n", (unsigned long)stats.heap_free);
+    }
+    if (stats.stack_size) {
+        printf("stack: peak %lu of %lu bytes\r\n", (unsigned long)stats.stack_peak, (unsigned long)stats.stack_size);
+    } else {
+        printf("stack: peak %lu bytes\r\n", (unsigned long)stats.stack_peak);
+    }
+
+    for (uint8_t i = 0; i < WATCH_MEMORY_NUM_OWNERS; i++) {
+        uint32_t bytes = watch_memory_get_owner_bytes(i);
+        if (bytes) printf("face %u: %lu bytes\r\n", i, (unsigned long)bytes);
+    }
+    printf("system: %lu bytes\r\n", (unsigned long)watch_memory_get_owner_bytes(WATCH_MEMORY_OWNER_SYSTEM));
+
+    return 0;
+}
+
+static int wakes_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    movement_wake_stats_t stats;
+
+    printf("wake budget: %lu of %lu ms awake this minute\r\n", (unsigned long)movement_get_wake_budget_used(),
+           (unsigned long)movement_get_wake_budget());
+    uint32_t period = tick_arbiter_get_period(MOVEMENT_TICK_CLIENT_FACE);
+    if (period >= TICK_ARBITER_TICKS_PER_SECOND) {
+        printf("face tick: every %lu s\r\n", (unsigned long)(period / TICK_ARBITER_TICKS_PER_SECOND));
+    } else if (period) {
+        printf("face tick: %lu Hz\r\n", (unsigned long)(TICK_ARBITER_TICKS_PER_SECOND / period));
+    } else {
+        printf("face tick: off\r\n");
+    }
+
+    for (uint8_t i = 0; movement_get_wake_stats(i, &stats); i++) {
+        if (!stats.wakes && !stats.exempt) continue;
+        printf("face %u: %lu wakes, %lu us awake, over budget %u times%s\r\n", i, (unsigned long)stats.wakes,
+               (unsigned long)stats.awake_us, stats.over_budget, stats.exempt ? " (exempt)" : "");
+    }
+
+    return 0;
+}
+
+static int trace_cmd(int argc, char *argv[]) {
+    const char *action = argc > 1 ? argv[1] : "stats";
+
+    if (strcmp(action, "start") == 0) {
+        uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+        watch_trace_reset_stats();
+        watch_trace_start(now);
+        printf("recording up to %u records\r\n", WATCH_TRACE_LENGTH);
+    } else if (strcmp(action, "stop") == 0) {
+        watch_trace_stop();
+    } else if (strcmp(action, "dump") == 0) {
+        const watch_trace_record_t *records;
+        uint16_t count = watch_trace_get_records(&records);
+        // one header line, then each record as delta, event and data in hex; loadTrace() in the simulator reads this back.
+        printf("trace %lu %u%s\r\n", (unsigned long)watch_trace_get_start_time(), count, watch_trace_is_truncated() ? " truncated" : "");
+        for (uint16_t i = 0; i < count; i++) {
+            printf("%04x%02x%02x%s", records[i].delta, records[i].event, records[i].data, (i % 8 == 7 || i == count - 1) ? "\r\n" : " ");
+        }
+    } else if (strcmp(action, "stats") == 0) {
+        watch_trace_stats_t stats;
+        watch_trace_get_stats(&stats);
+        printf("%s\r\n", watch_trace_is_recording() ? "recording" : (watch_trace_is_replaying() ? "replaying" : "idle"));
+        printf("trace stats: wakes=%lu awake_us=%lu flash_writes=%lu\r\n", (unsigned long)stats.wakes,
+               (unsigned long)stats.awake_us, (unsigned long)stats.flash_writes);
+    } else if (strcmp(action, "replay") == 0) {
+        if (!watch_trace_replay()) printf("nothing to replay; load a dump with loadTrace() in the simulator\r\n");
+    } else {
+        printf("usage: trace [start|stop|dump|stats|replay]\r\n");
+        return -2;
+    }
+
+    return 0;
+}
+
+#ifdef MOVEMENT_POWER_LINT
+static int lint_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    movement_power_lint();
+
+    return 0;
+}
+#endif
+
+#ifdef __EMSCRIPTEN__
+static int timescale_cmd(int argc, char *argv[]) {
+    if (argc == 2) {
+        int factor = atoi(argv[1]);
+        if (factor < 1 || factor > UINT16_MAX) return -2;
+        watch_rtc_set_time_scale(factor);
+    }
+    printf("time scale: %ux\r\n", watch_rtc_get_time_scale());
+
+    return 0;
+}
+
+static int lcdbench_cmd(int argc, char *argv[]) {
+    int count = argc == 2 ? atoi(argv[1]) : 1000;
+    if (count < 1) return -2;
+
+    // alternate two strings that differ in every position, and commit each one as a frame would.
+    double start = emscripten_get_now();
+    for (int i = 0; i < count; i++) {
+        watch_display_text(WATCH_POSITION_FULL, (i & 1) ? "0987654321" : "1234567890");
+        watch_commit_display();
+    }
+    double elapsed_ms = emscripten_get_now() - start;
+
+    printf("%d display updates in %lu ms, %lu per second\r\n", count, (unsigned long)elapsed_ms,
+           (unsigned long)(elapsed_ms > 0 ? count * 1000.0 / elapsed_ms : 0));
+
+    return 0;
+}
+
+static int drain_cmd(int argc, char *argv[]) {
+    const char *level_names[] = {"normal", "reduced", "critical"};
+    int from = atoi(argv[1]);
+    int to = atoi(argv[2]);
+    int steps = argc == 4 ? atoi(argv[3]) : 16;
+    if (from < 1000 || from > 3600 || to < 1000 || to > 3600 || steps < 1) return -2;
+
+    movement_power_level_t last_level = movement_get_power_level();
+    watch_supply_config_t last = watch_get_supply_config();
+    uint8_t failures = 0;
+
+    for (int i = 0; i <= steps; i++) {
+        uint16_t millivolts = from + (to - from) * i / steps;
+        // each step stands in for Movement's half-hourly sample, taken the way the scheduled one is.
+        watch_set_vcc_voltage(millivolts);
+        movement_update_battery_voltage(watch_get_vcc_voltage());
+
+        movement_power_level_t level = movement_get_power_level();
+        watch_supply_config_t supply = watch_get_supply_config();
+        uint16_t guard = 1445 + 34 * supply.guard_level;
+        printf("%4d min: %u mV, trend %u: %s, LPEFF %s, BOD33 ", i * 30, millivolts, supply.trend_millivolts,
+               level_names[level], supply.lpeff ? "on" : "off");
+        if (supply.guard_armed) printf("%u mV, PSEL %u", guard, supply.prescaler);
+        else printf("off");
+        if (level != last_level) printf(" [level %s -> %s]", level_names[last_level], level_names[level]);
+        if (supply.lpeff != last.lpeff) printf(" [LPEFF %s]", supply.lpeff ? "on" : "off");
+        if (supply.guard_armed != last.guard_armed || supply.guard_level != last.guard_level) printf(" [BOD33 level]");
+        if (supply.prescaler != last.prescaler) printf(" [BOD33 sampling]");
+        printf("\r\n");
+
+        // the regulator has to be off below the guard, and the guard armed whenever it is on.
+        if (supply.lpeff && millivolts < guard) {
+            printf("error: LPEFF on below the %u mV guard\r\n", guard);
+            failures++;
+        }
+        if (supply.lpeff != supply.guard_armed) {
+            printf("error: BOD33 %s with LPEFF %s\r\n", supply.guard_armed ? "armed" : "off", supply.lpeff ? "on" : "off");
+            failures++;
+        }
+        last_level = level;
+        last = supply;
+    }
+
+    return failures ? 1 : 0;
+}
+#endif
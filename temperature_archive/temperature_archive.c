@@ -0,0 +1,413 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "temperature_archive.h"
+#include "filesystem.h"
+
+/*
+ * The archive file starts with a snapshot:
+ *
+ *     uint32  the hour (since the UNIX epoch) that the first record's gap counts from
+ *     uint8   number of non-empty histogram bins, then for each: uint8 bin, uint16 count
+ *
+ * followed by one record per finished hour:
+ *
+ *     uint8   hours since the previous record (or the snapshot), 1-255
+ *     int8    change in the mean from the previous record, or -128 followed by the mean as an int16
+ *     uint8   mean minus minimum
+ *     uint8   maximum minus mean
+ *     uint8   number of histogram bins the hour's readings fell into, then for each: uint8 bin, uint8 count
+ *
+ * Multi-byte values are little-endian; temperatures are in quarter degrees. Records written as part of a
+ * snapshot carry no histogram bins, since the snapshot's histogram already counts them; in place of the number
+ * of bins they have TEMPERATURE_ARCHIVE_NO_BINS, then a uint8 count of readings.
+ */
+
+#define TEMPERATURE_ARCHIVE_MEAN_ESCAPE (-128)
+#define TEMPERATURE_ARCHIVE_NO_BINS 0xFF
+#define TEMPERATURE_ARCHIVE_MAX_RECORD_SIZE (7 + 2 * TEMPERATURE_ARCHIVE_HISTOGRAM_BINS)
+
+typedef struct {
+    int16_t min;
+    int16_t max;
+    int16_t mean;
+    uint8_t samples;
+} temperature_archive_summary_t;
+
+static struct {
+    temperature_archive_summary_t hours[TEMPERATURE_ARCHIVE_HOURS]; // finished hours, by hour % TEMPERATURE_ARCHIVE_HOURS
+    uint32_t last_hour;         // the latest finished hour
+    uint16_t histogram[TEMPERATURE_ARCHIVE_HISTOGRAM_BINS];
+
+    // the hour in progress
+    uint32_t hour;
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+    uint8_t samples;
+    uint8_t hour_bins[TEMPERATURE_ARCHIVE_HISTOGRAM_BINS];
+
+    int16_t last_mean;          // the mean in the file's last record, which the next record's is relative to
+    int32_t log_size;
+    uint32_t bytes_written;
+} _temperature_archive;
+
+static int16_t _temperature_archive_quarters(float temperature_c) {
+    float quarters = temperature_c * 4;
+    if (quarters > 32000) return 32000;
+    if (quarters < -32000) return -32000;
+    return (int16_t)(quarters < 0 ? quarters - 0.5f : quarters + 0.5f);
+}
+
+static uint8_t _temperature_archive_bin(int16_t quarters) {
+    int16_t degrees = (quarters < 0 ? quarters - 3 : quarters) / 4 - TEMPERATURE_ARCHIVE_HISTOGRAM_MIN_C;
+    if (degrees < 0) return 0;
+    if (degrees >= TEMPERATURE_ARCHIVE_HISTOGRAM_BINS) return TEMPERATURE_ARCHIVE_HISTOGRAM_BINS - 1;
+    return degrees;
+}
+
+static void _temperature_archive_count(uint8_t bin, uint16_t count) {
+    if (bin >= TEMPERATURE_ARCHIVE_HISTOGRAM_BINS) return;
+    if ((uint32_t)_temperature_archive.histogram[bin] + count > UINT16_MAX) {
+        // rounding up, so that a bin that has seen anything never goes back to zero.
+        for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; i++) {
+            _temperature_archive.histogram[i] = (_temperature_archive.histogram[i] + 1) >> 1;
+        }
+    }
+    _temperature_archive.histogram[bin] += count;
+}
+
+/// Files a finished hour in the ring, clearing any hours skipped since the last one.
+static void _temperature_archive_push_hour(uint32_t hour, const temperature_archive_summary_t *summary) {
+    if (hour <= _temperature_archive.last_hour || hour - _temperature_archive.last_hour >= TEMPERATURE_ARCHIVE_HOURS) {
+        // the clock went back, or we missed a day or more; either way none of the old hours are recent any more.
+        memset(_temperature_archive.hours, 0, sizeof(_temperature_archive.hours));
+    } else {
+        for (uint32_t skipped = _temperature_archive.last_hour + 1; skipped < hour; skipped++) {
+            _temperature_archive.hours[skipped % TEMPERATURE_ARCHIVE_HOURS].samples = 0;
+        }
+    }
+    _temperature_archive.hours[hour % TEMPERATURE_ARCHIVE_HOURS] = *summary;
+    _temperature_archive.last_hour = hour;
+}
+
+static uint8_t _temperature_archive_encode_hour(uint8_t *buf, uint8_t gap, const temperature_archive_summary_t *summary, const uint8_t *bins) {
+    uint8_t length = 0;
+    int16_t delta = summary->mean - _temperature_archive.last_mean;
+
+    buf[length++] = gap;
+    if (delta > INT8_MIN && delta <= INT8_MAX) {
+        buf[length++] = (uint8_t)(int8_t)delta;
+    } else {
+        buf[length++] = (uint8_t)TEMPERATURE_ARCHIVE_MEAN_ESCAPE;
+        buf[length++] = (uint16_t)summary->mean & 0xFF;
+        buf[length++] = (uint16_t)summary->mean >> 8;
+    }
+    buf[length++] = summary->mean - summary->min;
+    buf[length++] = summary->max - summary->mean;
+
+    if (bins == NULL) {
+        buf[length++] = TEMPERATURE_ARCHIVE_NO_BINS;
+        buf[length++] = summary->samples;
+    } else {
+        uint8_t *num_bins = &buf[length++];
+        *num_bins = 0;
+        for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; i++) {
+            if (bins[i] == 0) continue;
+            buf[length++] = i;
+            buf[length++] = bins[i];
+            (*num_bins)++;
+        }
+    }
+    _temperature_archive.last_mean = summary->mean;
+
+    return length;
+}
+
+/// Rewrites the file from scratch, as a snapshot of the current state.
+static void _temperature_archive_write_snapshot(void) {
+    uint8_t *buf = malloc(5 + 3 * TEMPERATURE_ARCHIVE_HISTOGRAM_BINS + TEMPERATURE_ARCHIVE_HOURS * 8);
+    if (buf == NULL) return;
+
+    uint32_t anchor = _temperature_archive.last_hour > TEMPERATURE_ARCHIVE_HOURS ? _temperature_archive.last_hour - TEMPERATURE_ARCHIVE_HOURS : 0;
+    uint16_t length = 0;
+    for (uint8_t i = 0; i < 4; i++) buf[length++] = anchor >> (8 * i);
+
+    uint8_t *num_bins = &buf[length++];
+    *num_bins = 0;
+    for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; i++) {
+        if (_temperature_archive.histogram[i] == 0) continue;
+        buf[length++] = i;
+        buf[length++] = _temperature_archive.histogram[i] & 0xFF;
+        buf[length++] = _temperature_archive.histogram[i] >> 8;
+        (*num_bins)++;
+    }
+
+    _temperature_archive.last_mean = 0;
+    uint32_t previous = anchor;
+    for (uint32_t hour = anchor + 1; hour <= _temperature_archive.last_hour; hour++) {
+        temperature_archive_summary_t *summary = &_temperature_archive.hours[hour % TEMPERATURE_ARCHIVE_HOURS];
+        if (summary->samples == 0) continue;
+        length += _temperature_archive_encode_hour(buf + length, hour - previous, summary, NULL);
+        previous = hour;
+    }
+
+    if (filesystem_write_file(TEMPERATURE_ARCHIVE_FILENAME, (char *)buf, length)) {
+        _temperature_archive.log_size = length;
+        _temperature_archive.bytes_written += length;
+    } else {
+        // try again from scratch at the end of the next hour.
+        _temperature_archive.log_size = 0;
+    }
+    free(buf);
+}
+
+static void _temperature_archive_finish_hour(void) {
+    if (_temperature_archive.samples == 0) return;
+
+    temperature_archive_summary_t summary;
+    int32_t sum = _temperature_archive.sum;
+    int32_t samples = _temperature_archive.samples;
+    summary.mean = (sum < 0 ? sum - samples / 2 : sum + samples / 2) / samples;
+    // the file keeps the extremes as offsets of up to 255 quarter degrees from the mean; so does RAM, to match.
+    summary.min = summary.mean - (summary.mean - _temperature_archive.min > 255 ? 255 : summary.mean - _temperature_archive.min);
+    summary.max = summary.mean + (_temperature_archive.max - summary.mean > 255 ? 255 : _temperature_archive.max - summary.mean);
+    summary.samples = _temperature_archive.samples;
+
+    uint32_t hour = _temperature_archive.hour;
+    uint32_t gap = hour - _temperature_archive.last_hour;
+    bool rewrite = _temperature_archive.log_size <= 0 || hour <= _temperature_archive.last_hour || gap > UINT8_MAX;
+
+    _temperature_archive_push_hour(hour, &summary);
+    for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; i++) {
+        if (_temperature_archive.hour_bins[i]) _temperature_archive_count(i, _temperature_archive.hour_bins[i]);
+    }
+
+    if (!rewrite) {
+        uint8_t record[TEMPERATURE_ARCHIVE_MAX_RECORD_SIZE];
+        int16_t last_mean = _temperature_archive.last_mean;
+        uint8_t length = _temperature_archive_encode_hour(record, gap, &summary, _temperature_archive.hour_bins);
+        if (_temperature_archive.log_size + length > TEMPERATURE_ARCHIVE_MAX_LOG_SIZE) {
+            _temperature_archive.last_mean = last_mean;
+            rewrite = true;
+        } else if (filesystem_append_file(TEMPERATURE_ARCHIVE_FILENAME, (char *)record, length)) {
+            _temperature_archive.log_size += length;
+            _temperature_archive.bytes_written += length;
+        } else {
+            // the file no longer matches what we have; start it over next time.
+            _temperature_archive.log_size = 0;
+        }
+    }
+    if (rewrite) _temperature_archive_write_snapshot();
+
+    _temperature_archive.samples = 0;
+    _temperature_archive.sum = 0;
+    memset(_temperature_archive.hour_bins, 0, sizeof(_temperature_archive.hour_bins));
+}
+
+/// Replays the archive file; returns false if it's damaged.
+static bool _temperature_archive_replay(const uint8_t *buf, int32_t size) {
+    int32_t pos = 0;
+    if (size < 5) return false;
+
+    uint32_t hour = 0;
+    for (uint8_t i = 0; i < 4; i++) hour |= (uint32_t)buf[pos++] << (8 * i);
+    _temperature_archive.last_hour = hour;
+
+    uint8_t num_bins = buf[pos++];
+    if (pos + 3 * num_bins > size) return false;
+    for (uint8_t i = 0; i < num_bins; i++, pos += 3) {
+        _temperature_archive_count(buf[pos], buf[pos + 1] | (buf[pos + 2] << 8));
+    }
+
+    _temperature_archive.last_mean = 0;
+    while (pos < size) {
+        temperature_archive_summary_t summary;
+        if (pos + 5 > size || buf[pos] == 0) return false;
+        hour += buf[pos++];
+        int8_t delta = (int8_t)buf[pos++];
+        if (delta == TEMPERATURE_ARCHIVE_MEAN_ESCAPE) {
+            if (pos + 5 > size) return false;
+            summary.mean = (int16_t)(buf[pos] | (buf[pos + 1] << 8));
+            pos += 2;
+        } else {
+            summary.mean = _temperature_archive.last_mean + delta;
+        }
+        summary.min = summary.mean - buf[pos++];
+        summary.max = summary.mean + buf[pos++];
+        num_bins = buf[pos++];
+        summary.samples = 0;
+        if (num_bins == TEMPERATURE_ARCHIVE_NO_BINS) {
+            if (pos + 1 > size) return false;
+            summary.samples = buf[pos++];
+        } else {
+            if (pos + 2 * num_bins > size) return false;
+            for (uint8_t i = 0; i < num_bins; i++, pos += 2) {
+                _temperature_archive_count(buf[pos], buf[pos + 1]);
+                summary.samples += buf[pos + 1];
+            }
+        }
+        if (summary.samples == 0) return false;
+        _temperature_archive.last_mean = summary.mean;
+        _temperature_archive_push_hour(hour, &summary);
+    }
+
+    return true;
+}
+
+void temperature_archive_init(void) {
+    memset(&_temperature_archive, 0, sizeof(_temperature_archive));
+
+    int32_t size = filesystem_get_file_size(TEMPERATURE_ARCHIVE_FILENAME);
+    if (size <= 0) return;
+
+    uint8_t *buf = size <= TEMPERATURE_ARCHIVE_MAX_LOG_SIZE ? malloc(size) : NULL;
+    if (buf != NULL && filesystem_read_file(TEMPERATURE_ARCHIVE_FILENAME, (char *)buf, size) && _temperature_archive_replay(buf, size)) {
+        _temperature_archive.log_size = size;
+        // until the first reading comes in, answer queries as if it's the hour after the last one on file.
+        _temperature_archive.hour = _temperature_archive.last_hour + 1;
+    } else {
+        // damaged, or too big to be ours; keep what's there until the next hour is written, then start over.
+        uint32_t bytes_written = _temperature_archive.bytes_written;
+        memset(&_temperature_archive, 0, sizeof(_temperature_archive));
+        _temperature_archive.bytes_written = bytes_written;
+    }
+    free(buf);
+}
+
+void temperature_archive_add_sample(uint32_t timestamp, float temperature_c) {
+    uint32_t hour = timestamp / 3600;
+    int16_t quarters = _temperature_archive_quarters(temperature_c);
+
+    if (hour != _temperature_archive.hour) {
+        _temperature_archive_finish_hour();
+        _temperature_archive.hour = hour;
+    }
+    // a reading a minute is the most Movement takes; the counts in a record only have room for 255.
+    if (_temperature_archive.samples == UINT8_MAX) return;
+
+    if (_temperature_archive.samples == 0 || quarters < _temperature_archive.min) _temperature_archive.min = quarters;
+    if (_temperature_archive.samples == 0 || quarters > _temperature_archive.max) _temperature_archive.max = quarters;
+    _temperature_archive.sum += quarters;
+    _temperature_archive.hour_bins[_temperature_archive_bin(quarters)]++;
+    _temperature_archive.samples++;
+}
+
+static bool _temperature_archive_get_summary(uint8_t hours_ago, temperature_archive_summary_t *summary) {
+    if (hours_ago >= TEMPERATURE_ARCHIVE_HOURS) return false;
+
+    if (hours_ago == 0) {
+        if (_temperature_archive.samples == 0) return false;
+        int32_t sum = _temperature_archive.sum;
+        int32_t samples = _temperature_archive.samples;
+        summary->mean = (sum < 0 ? sum - samples / 2 : sum + samples / 2) / samples;
+        summary->min = _temperature_archive.min;
+        summary->max = _temperature_archive.max;
+        summary->samples = _temperature_archive.samples;
+        return true;
+    }
+
+    uint32_t hour = _temperature_archive.hour - hours_ago;
+    if (hour > _temperature_archive.last_hour || _temperature_archive.last_hour - hour >= TEMPERATURE_ARCHIVE_HOURS) return false;
+    *summary = _temperature_archive.hours[hour % TEMPERATURE_ARCHIVE_HOURS];
+
+    return summary->samples != 0;
+}
+
+bool temperature_archive_get_hour(uint8_t hours_ago, temperature_archive_hour_t *hour) {
+    temperature_archive_summary_t summary;
+    if (!_temperature_archive_get_summary(hours_ago, &summary)) return false;
+
+    hour->min_c = summary.min / 4.0f;
+    hour->max_c = summary.max / 4.0f;
+    hour->mean_c = summary.mean / 4.0f;
+    hour->samples = summary.samples;
+
+    return true;
+}
+
+bool temperature_archive_get_range(uint8_t hours, float *min_c, float *max_c) {
+    temperature_archive_summary_t summary;
+    int16_t min = INT16_MAX;
+    int16_t max = INT16_MIN;
+    bool found = false;
+
+    for (uint8_t i = 0; i < hours && i < TEMPERATURE_ARCHIVE_HOURS; i++) {
+        if (!_temperature_archive_get_summary(i, &summary)) continue;
+        if (summary.min < min) min = summary.min;
+        if (summary.max > max) max = summary.max;
+        found = true;
+    }
+    if (found) {
+        *min_c = min / 4.0f;
+        *max_c = max / 4.0f;
+    }
+
+    return found;
+}
+
+uint16_t temperature_archive_get_histogram_count(float temperature_c) {
+    uint8_t bin = _temperature_archive_bin(_temperature_archive_quarters(temperature_c));
+    uint32_t count = _temperature_archive.histogram[bin] + _temperature_archive.hour_bins[bin];
+    return count > UINT16_MAX ? UINT16_MAX : count;
+}
+
+uint32_t temperature_archive_get_bytes_written(void) {
+    return _temperature_archive.bytes_written;
+}
+
+static void _temperature_archive_print_quarters(int16_t quarters) {
+    int32_t hundredths = quarters * 25;
+    printf("%s%3ld.%02ld", hundredths < 0 ? "-" : " ", labs(hundredths) / 100, labs(hundredths) % 100);
+}
+
+int temperature_archive_cmd_temps(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+    temperature_archive_summary_t summary;
+
+    printf("hours ago     min     max    mean  readings\r\n");
+    for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HOURS; i++) {
+        if (!_temperature_archive_get_summary(i, &summary)) continue;
+        printf("%9d ", i);
+        _temperature_archive_print_quarters(summary.min);
+        _temperature_archive_print_quarters(summary.max);
+        _temperature_archive_print_quarters(summary.mean);
+        printf("  %8d\r\n", summary.samples);
+    }
+
+    printf("histogram (C: readings):\r\n");
+    for (uint8_t i = 0; i < TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; i++) {
+        uint32_t count = _temperature_archive.histogram[i] + _temperature_archive.hour_bins[i];
+        if (count) printf("%4d: %lu\r\n", i + TEMPERATURE_ARCHIVE_HISTOGRAM_MIN_C, (unsigned long)count);
+    }
+
+    printf("log: %ld bytes, %lu bytes written since boot\r\n", (long)(_temperature_archive.log_size > 0 ? _temperature_archive.log_size : 0),
+           (unsigned long)_temperature_archive.bytes_written);
+
+    return 0;
+}
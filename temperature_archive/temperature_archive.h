@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEMPERATURE_ARCHIVE_H_
+#define TEMPERATURE_ARCHIVE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Temperature archive
+ *
+ * Movement reads the temperature sensor every MOVEMENT_TEMPERATURE_ARCHIVE_INTERVAL minutes and hands the
+ * reading to this service, which keeps per-hour minimum, maximum and mean temperatures for the last day, and a
+ * histogram of every reading taken, one bin per degree. Faces query it instead of sampling the sensor from a
+ * background task of their own.
+ *
+ * Readings are kept in RAM until their hour is over. Each finished hour is then appended to the archive file
+ * as a record of five bytes or so, plus two bytes for every histogram bin the hour touched; the file is only
+ * rewritten from scratch, as a compact snapshot of the current state, when it outgrows
+ * TEMPERATURE_ARCHIVE_MAX_LOG_SIZE, or when the clock is set back. At boot the file is replayed to rebuild the
+ * state. Readings from the hour in progress are lost if the watch resets.
+ *
+ * Temperatures are kept to a quarter of a degree Celsius.
+ */
+
+#define TEMPERATURE_ARCHIVE_FILENAME "temps.log"
+
+#ifndef TEMPERATURE_ARCHIVE_MAX_LOG_SIZE
+#define TEMPERATURE_ARCHIVE_MAX_LOG_SIZE 1024
+#endif
+
+#define TEMPERATURE_ARCHIVE_HOURS 24                ///< Hourly summaries kept, counting the hour in progress.
+#define TEMPERATURE_ARCHIVE_HISTOGRAM_MIN_C (-20)   ///< Lowest histogram bin; colder readings count here.
+#define TEMPERATURE_ARCHIVE_HISTOGRAM_BINS 70       ///< One per degree; readings above the last bin count there.
+
+typedef struct {
+    float min_c;
+    float max_c;
+    float mean_c;
+    uint8_t samples;    ///< Readings taken during the hour.
+} temperature_archive_hour_t;
+
+/** @brief Rebuilds the archive from its file. Call once at boot, after the filesystem is mounted.
+  */
+void temperature_archive_init(void);
+
+/** @brief Adds a reading to the archive, appending the previous hour to the file if this one starts a new hour.
+  * @param timestamp The time of the reading, in seconds since the UNIX epoch.
+  * @param temperature_c The reading, in degrees Celsius.
+  */
+void temperature_archive_add_sample(uint32_t timestamp, float temperature_c);
+
+/** @brief Gets the summary of one hour.
+  * @param hours_ago 0 for the hour in progress, 1 for the hour before, and so on up to TEMPERATURE_ARCHIVE_HOURS - 1.
+  * @param hour Filled in with the summary.
+  * @return false if no readings were taken that hour.
+  */
+bool temperature_archive_get_hour(uint8_t hours_ago, temperature_archive_hour_t *hour);
+
+/** @brief Gets the lowest and highest readings over the most recent hours.
+  * @param hours How many hours to look back, counting the hour in progress; at most TEMPERATURE_ARCHIVE_HOURS.
+  * @return false if no readings were taken in that time.
+  */
+bool temperature_archive_get_range(uint8_t hours, float *min_c, float *max_c);
+
+/** @brief Returns how many readings fell into the one degree bin holding temperature_c. Counts are halved
+  *        across the whole histogram whenever one would overflow, so they're relative, not absolute.
+  */
+uint16_t temperature_archive_get_histogram_count(float temperature_c);
+
+/** @brief Returns the number of bytes the archive has written to the filesystem since boot.
+  */
+uint32_t temperature_archive_get_bytes_written(void);
+
+/** @brief Shell command: prints the hourly summaries, the histogram and the archive's write volume.
+  */
+int temperature_archive_cmd_temps(int argc, char *argv[]);
+
+#endif // TEMPERATURE_ARCHIVE_H_
@@ -0,0 +1,245 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Feeds the temperature archive a simulated week of readings, checks its answers against the raw readings and
+// against a fresh copy rebuilt from its file, and reports how many bytes a day it hands to the filesystem.
+// Built and run by `make -C test`.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+
+// built in, so the test can compare the archive's internal state before and after a reboot.
+#include "../temperature_archive.c"
+
+#define START_TIME 1767225600   // 2026-01-01 00:00:00 UTC
+#define INTERVAL 300            // Movement's default: a reading every five minutes
+#define DAYS 7
+#define MAX_READINGS (DAYS * 86400 / INTERVAL + 64)
+
+static uint8_t file[4096];
+static int32_t file_size = -1;
+
+int32_t filesystem_get_file_size(char *filename) {
+    (void) filename;
+    return file_size;
+}
+
+bool filesystem_read_file(char *filename, char *buf, int32_t length) {
+    (void) filename;
+    if (file_size < 0) return false;
+    memcpy(buf, file, length < file_size ? length : file_size);
+    return true;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    (void) filename;
+    if (length > (int32_t)sizeof(file)) return false;
+    memcpy(file, text, length);
+    file_size = length;
+    return true;
+}
+
+bool filesystem_append_file(char *filename, char *text, int32_t length) {
+    (void) filename;
+    if (file_size < 0) file_size = 0;
+    if (file_size + length > (int32_t)sizeof(file)) return false;
+    memcpy(file + file_size, text, length);
+    file_size += length;
+    return true;
+}
+
+static uint32_t timestamps[MAX_READINGS];
+static int16_t readings[MAX_READINGS];
+static uint32_t num_readings;
+static uint32_t timestamp;
+
+static float simulated_temperature(uint32_t timestamp) {
+    // a daily swing of ten degrees around 20, and a little sensor noise.
+    float phase = (timestamp % 86400) * 2 * M_PI / 86400;
+    return 20.0f + 5.0f * sinf(phase) + (rand() % 100 - 50) / 100.0f;
+}
+
+static void add_reading(uint32_t timestamp, float temperature_c) {
+    temperature_archive_add_sample(timestamp, temperature_c);
+    timestamps[num_readings] = timestamp;
+    readings[num_readings] = _temperature_archive_quarters(temperature_c);
+    num_readings++;
+}
+
+static void add_readings_for(uint32_t seconds) {
+    for (uint32_t end = timestamp + seconds; timestamp < end; timestamp += INTERVAL) {
+        add_reading(timestamp, simulated_temperature(timestamp));
+    }
+}
+
+// checks every hour the archive reports against the readings themselves.
+static void check_against_readings(void) {
+    uint32_t current_hour = timestamps[num_readings - 1] / 3600;
+    for (uint8_t hours_ago = 0; hours_ago < TEMPERATURE_ARCHIVE_HOURS; hours_ago++) {
+        int16_t min = INT16_MAX, max = INT16_MIN;
+        int32_t sum = 0, count = 0;
+        for (uint32_t i = 0; i < num_readings; i++) {
+            if (timestamps[i] / 3600 != current_hour - hours_ago) continue;
+            if (readings[i] < min) min = readings[i];
+            if (readings[i] > max) max = readings[i];
+            sum += readings[i];
+            count++;
+        }
+        temperature_archive_hour_t hour;
+        bool found = temperature_archive_get_hour(hours_ago, &hour);
+        TEST_ASSERT_EQUAL(count > 0, found);
+        if (!found) continue;
+        int16_t mean = (sum < 0 ? sum - count / 2 : sum + count / 2) / count;
+        TEST_ASSERT_EQUAL(count, hour.samples);
+        TEST_ASSERT_EQUAL_FLOAT(min / 4.0f, hour.min_c);
+        TEST_ASSERT_EQUAL_FLOAT(max / 4.0f, hour.max_c);
+        TEST_ASSERT_EQUAL_FLOAT(mean / 4.0f, hour.mean_c);
+    }
+}
+
+// reboots the archive, and checks it comes back from its file with the same finished hours and histogram.
+static void check_reload(void) {
+    temperature_archive_summary_t hours[TEMPERATURE_ARCHIVE_HOURS];
+    uint16_t histogram[TEMPERATURE_ARCHIVE_HISTOGRAM_BINS];
+    uint32_t last_hour = _temperature_archive.last_hour;
+    memcpy(hours, _temperature_archive.hours, sizeof(hours));
+    memcpy(histogram, _temperature_archive.histogram, sizeof(histogram));
+
+    temperature_archive_init();
+
+    TEST_ASSERT_EQUAL_UINT32(last_hour, _temperature_archive.last_hour);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(histogram, _temperature_archive.histogram, TEMPERATURE_ARCHIVE_HISTOGRAM_BINS);
+    for (uint32_t hour = last_hour - TEMPERATURE_ARCHIVE_HOURS + 1; hour <= last_hour; hour++) {
+        temperature_archive_summary_t *before = &hours[hour % TEMPERATURE_ARCHIVE_HOURS];
+        temperature_archive_summary_t *after = &_temperature_archive.hours[hour % TEMPERATURE_ARCHIVE_HOURS];
+        TEST_ASSERT_EQUAL(before->samples, after->samples);
+        if (!before->samples) continue;
+        TEST_ASSERT_EQUAL_INT16(before->min, after->min);
+        TEST_ASSERT_EQUAL_INT16(before->max, after->max);
+        TEST_ASSERT_EQUAL_INT16(before->mean, after->mean);
+    }
+}
+
+void setUp(void) {
+    srand(1);
+    file_size = -1;
+    num_readings = 0;
+    timestamp = START_TIME;
+    temperature_archive_init();
+}
+
+void tearDown(void) {
+}
+
+static void test_empty_archive_has_no_hours(void) {
+    TEST_ASSERT_FALSE(temperature_archive_get_hour(0, &(temperature_archive_hour_t){0}));
+}
+
+// a week of readings, rebooting once a day to check the file replays to the same state.
+static void test_week_of_readings(void) {
+    uint32_t bytes_per_day[DAYS];
+    uint32_t bytes_before = 0;
+    for (uint8_t day = 0; day < DAYS; day++) {
+        add_readings_for(86400);
+        check_against_readings();
+        bytes_per_day[day] = temperature_archive_get_bytes_written() - bytes_before;
+        TEST_ASSERT_LESS_OR_EQUAL(TEMPERATURE_ARCHIVE_MAX_LOG_SIZE, file_size);
+        check_reload();
+        bytes_before = temperature_archive_get_bytes_written();
+        // the hour in progress is lost in a reboot; take it out of the expected readings too.
+        while (num_readings && timestamps[num_readings - 1] / 3600 > _temperature_archive.last_hour) num_readings--;
+    }
+
+    float min_c, max_c;
+    TEST_ASSERT_TRUE(temperature_archive_get_range(TEMPERATURE_ARCHIVE_HOURS, &min_c, &max_c));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 15.0f, min_c);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 25.0f, max_c);
+    uint32_t total = 0;
+    for (float t = TEMPERATURE_ARCHIVE_HISTOGRAM_MIN_C; t < TEMPERATURE_ARCHIVE_HISTOGRAM_MIN_C + TEMPERATURE_ARCHIVE_HISTOGRAM_BINS; t++) {
+        total += temperature_archive_get_histogram_count(t);
+    }
+    TEST_ASSERT_EQUAL_UINT32(num_readings, total);
+
+    uint32_t week = 0;
+    printf("bytes written per day:");
+    for (uint8_t day = 0; day < DAYS; day++) {
+        printf(" %lu", (unsigned long)bytes_per_day[day]);
+        week += bytes_per_day[day];
+    }
+    uint32_t readings_per_day = 86400 / INTERVAL;
+    uint32_t rewrite_per_day = readings_per_day * (uint32_t)sizeof(_temperature_archive);
+    printf("\naverage %lu bytes/day; rewriting the %lu byte state on every reading would be %lu bytes/day\n",
+           (unsigned long)(week / DAYS), (unsigned long)sizeof(_temperature_archive), (unsigned long)rewrite_per_day);
+    TEST_ASSERT_LESS_THAN_UINT32(400, week / DAYS);
+}
+
+// readings below freezing land in the right bins, and extremes in the end bins.
+static void test_histogram_bins_below_freezing(void) {
+    add_reading(timestamp, -0.6f);
+    add_reading(timestamp + 1, -45.0f);
+    TEST_ASSERT_EQUAL_UINT16(1, temperature_archive_get_histogram_count(-0.9f));
+    TEST_ASSERT_EQUAL_UINT16(1, temperature_archive_get_histogram_count(-21.0f));
+}
+
+// setting the clock back a day starts the file over, and it still replays correctly.
+static void test_clock_set_back_starts_over(void) {
+    add_readings_for(86400);
+    timestamp -= 86400;
+    add_readings_for(3 * 3600);
+    num_readings = 0;
+    add_readings_for(3600);
+    temperature_archive_hour_t hour;
+    TEST_ASSERT_TRUE(temperature_archive_get_hour(1, &hour));
+    TEST_ASSERT_EQUAL(3600 / INTERVAL, hour.samples);
+    TEST_ASSERT_FALSE(temperature_archive_get_hour(4, &hour));
+    check_reload();
+}
+
+// a damaged file is ignored, and replaced at the end of the next hour.
+static void test_damaged_file_is_replaced(void) {
+    add_readings_for(6 * 3600);
+    file_size -= 3;
+    temperature_archive_init();
+    temperature_archive_hour_t hour;
+    TEST_ASSERT_FALSE(temperature_archive_get_hour(1, &hour));
+    for (uint32_t end = timestamp + 2 * 3600; timestamp < end; timestamp += INTERVAL) {
+        temperature_archive_add_sample(timestamp, 20.0f);
+    }
+    TEST_ASSERT_TRUE(temperature_archive_get_hour(1, &hour));
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, hour.mean_c);
+    check_reload();
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_archive_has_no_hours);
+    RUN_TEST(test_week_of_readings);
+    RUN_TEST(test_histogram_bins_below_freezing);
+    RUN_TEST(test_clock_set_back_starts_over);
+    RUN_TEST(test_damaged_file_is_replaced);
+    return UNITY_END();
+}
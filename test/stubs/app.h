@@ -0,0 +1,13 @@
+/*
+ * Host-side stand-in for app.h; the test implements app_setup.
+ */
+
+#ifndef _APP_H_INCLUDED
+#define _APP_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void app_setup(void);
+
+#endif
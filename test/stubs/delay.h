@@ -0,0 +1,9 @@
+/*
+ * Host-side stand-in for delay.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+static inline void delay_ms(const uint16_t ms) { (void) ms; }
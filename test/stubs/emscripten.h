@@ -0,0 +1,24 @@
+/*
+ * Host-side stand-in for emscripten.h, for the simulator's code. The JavaScript is dropped: EM_ASYNC_JS only declares
+ * its function, for the test to implement, and each EM_ASM block counts one trip into JavaScript in js_calls.
+ */
+
+#ifndef _EMSCRIPTEN_H_INCLUDED
+#define _EMSCRIPTEN_H_INCLUDED
+
+#include <stdbool.h>
+
+typedef int EM_BOOL;
+#define EM_TRUE 1
+#define EM_FALSE 0
+
+extern unsigned int js_calls;
+
+#define EM_ASYNC_JS(ret, name, params, ...) ret name params
+#define EM_ASM(...) (js_calls++)
+
+double emscripten_get_now(void);
+long emscripten_set_interval(void (*callback)(void *user_data), double interval_ms, void *user_data);
+void emscripten_clear_timeout(long id);
+
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Host-side stand-in for emscripten/html5.h; the test holds on to the animation frame callback and runs it when it
+ * wants a frame to go by.
+ */
+
+#ifndef _EMSCRIPTEN_HTML5_H_INCLUDED
+#define _EMSCRIPTEN_HTML5_H_INCLUDED
+
+#include "../emscripten.h"
+
+long emscripten_request_animation_frame(EM_BOOL (*callback)(double time, void *user_data), void *user_data);
+
+#endif
@@ -0,0 +1,15 @@
+/*
+ * Host-side stand-in for filesystem.h, for code that keeps files through it. The tests keep those files in RAM.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// temperature_archive.c and rpc.c
+int32_t filesystem_get_file_size(char *filename);
+bool filesystem_read_file(char *filename, char *buf, int32_t length);
+int32_t filesystem_read_file_at(char *filename, char *buf, int32_t offset, int32_t length);
+bool filesystem_write_file(char *filename, char *text, int32_t length);
+bool filesystem_append_file(char *filename, char *text, int32_t length);
@@ -0,0 +1,48 @@
+/*
+ * Host-side stand-in for movement.h, declaring only what the code under test uses.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "watch_utility.h"
+
+// filesystem.h
+typedef union {
+    struct {
+        int16_t latitude : 16;
+        int16_t longitude : 16;
+    } bit;
+    uint32_t reg;
+} movement_location_t;
+
+// rpc.c
+typedef union {
+    struct {
+        uint8_t version : 2;
+        bool button_should_sound : 1;
+        uint8_t to_interval : 2;
+        uint8_t le_interval : 3;
+        uint8_t led_duration : 3;
+        uint8_t led_red_color : 4;
+        uint8_t led_green_color : 4;
+        uint8_t led_blue_color : 4;
+        uint8_t time_zone : 6;
+        bool clock_mode_24h : 1;
+        bool use_imperial_units : 1;
+        bool button_volume : 1;
+    } bit;
+    uint32_t reg;
+} movement_settings_t;
+
+movement_settings_t movement_get_settings(void);
+void movement_set_settings(movement_settings_t settings);
+void movement_store_settings(void);
+uint8_t movement_get_num_faces(void);
+uint8_t movement_get_current_face(void);
+int32_t movement_get_timezone_index(void);
+void movement_set_timezone_index(uint8_t value);
+int32_t movement_get_current_timezone_offset(void);
+watch_date_time_t movement_get_utc_date_time(void);
+void movement_set_local_date_time(watch_date_time_t date_time);
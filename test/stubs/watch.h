@@ -0,0 +1,31 @@
+/*
+ * Host-side stand-in for watch.h, so that code built on it can be tested on a computer.
+ * Only the calls the code under test makes are declared; each test implements the ones it needs.
+ */
+
+#ifndef _WATCH_H_INCLUDED
+#define _WATCH_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// lis2dw.c: the I2C bus, served by a register file in test_lis2dw.c.
+#define I2C_SERCOM 1
+
+void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length);
+void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length);
+void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data);
+uint8_t watch_i2c_read8(int16_t addr, uint8_t reg);
+uint16_t watch_i2c_read16(int16_t addr, uint8_t reg);
+
+// filesystem.c: the RWW EEPROM, backed by a RAM array in test_filesystem.c and sized like the SAM L22's.
+#define NVMCTRL_PAGE_SIZE 64
+#define NVMCTRL_ROW_SIZE 256
+#define NVMCTRL_RWWEE_PAGES 128
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size);
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size);
+bool watch_storage_erase(uint32_t row);
+bool watch_storage_sync(void);
+
+#endif
@@ -0,0 +1 @@
+// Host-side stand-in for watch_common_display.h; what watch_slcd.c needs from it is declared in watch_slcd.h.
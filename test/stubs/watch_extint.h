@@ -0,0 +1,31 @@
+/*
+ * Host-side stand-in for watch_extint.h, declaring what the simulator's watch_deepsleep.c calls.
+ */
+
+#ifndef _WATCH_EXTINT_H_INCLUDED
+#define _WATCH_EXTINT_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef void (*watch_cb_t)(void);
+
+typedef enum {
+    INTERRUPT_TRIGGER_NONE = 0,
+    INTERRUPT_TRIGGER_RISING,
+    INTERRUPT_TRIGGER_FALLING,
+    INTERRUPT_TRIGGER_BOTH,
+} eic_interrupt_trigger_t;
+
+uint8_t HAL_GPIO_BTN_ALARM_pin(void);
+uint8_t HAL_GPIO_BTN_MODE_pin(void);
+uint8_t HAL_GPIO_BTN_LIGHT_pin(void);
+
+void watch_enable_external_interrupts(void);
+void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger);
+void watch_rtc_disable_all_periodic_callbacks(void);
+
+// from watch_deepsleep.h, which the real watch_extint.h brings in by way of watch.h.
+void sleep(const uint8_t mode);
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ * Host-side stand-in for watch_slcd.h and watch_common_display.h, declaring what the simulator's watch_slcd.c needs.
+ * The test implements the one display call the file makes.
+ */
+
+#ifndef _WATCH_SLCD_H_INCLUDED
+#define _WATCH_SLCD_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    WATCH_LCD_TYPE_UNKNOWN = 0,
+    WATCH_LCD_TYPE_CLASSIC,
+    WATCH_LCD_TYPE_CUSTOM,
+} watch_lcd_type_t;
+
+typedef uint8_t watch_indicator_t;
+
+watch_lcd_type_t watch_get_lcd_type(void);
+void watch_enable_display(void);
+void watch_disable_display(void);
+void watch_set_pixel(uint8_t com, uint8_t seg);
+void watch_clear_pixel(uint8_t com, uint8_t seg);
+void watch_clear_display(void);
+void watch_commit_display(void);
+void watch_start_character_blink(char character, uint32_t duration);
+void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration);
+void watch_stop_blink(void);
+void watch_start_sleep_animation(uint32_t duration);
+bool watch_sleep_animation_is_running(void);
+void watch_stop_sleep_animation(void);
+
+void watch_display_character(uint8_t character, uint8_t position);
+
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Host-side stand-in for watch_utility.h. The date type just carries a UNIX time, which is all rpc.c needs.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t reg;
+} watch_date_time_t;
+
+static inline uint32_t watch_utility_date_time_to_unix_time(watch_date_time_t date_time, int32_t utc_offset) {
+    return date_time.reg - utc_offset;
+}
+
+static inline watch_date_time_t watch_utility_date_time_from_unix_time(uint32_t timestamp, int32_t utc_offset) {
+    watch_date_time_t date_time = {timestamp + utc_offset};
+    return date_time;
+}
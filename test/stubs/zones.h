@@ -0,0 +1,7 @@
+/*
+ * Host-side stand-in for zones.h.
+ */
+
+#pragma once
+
+#define NUM_ZONE_NAMES 40
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Compiles a text tune notation into the compact tune format played by watch_buzzer_play_tune.
+
+Notation (whitespace separated, ';' starts a comment):
+
+    tempo 16        length of one duration unit in 1/1024 s (default 16, i.e. 1/64 s)
+    bpm 120 4       alternatively: 120 beats per minute, with a beat divided into 4 duration units
+    volume 25       duty cycle for the following notes, 0-50 (5 is soft, 25 is loud)
+    C8:6            a note and its duration in units; sharps are C8#, flats are D8b
+    r:7             a rest
+    [ ... ]x5       play the enclosed section 5 times in total
+
+Example:
+
+    python3 compile_tune.py --name signal_tune mytune.txt
+
+prints a C array ready to paste into movement_custom_signal_tunes.h or a watch face.
+
+With --sequence, the input is instead the initializer of an old int8_t note sequence for
+watch_buzzer_play_sequence, e.g. '{BUZZER_NOTE_C8, 5, BUZZER_NOTE_REST, 6, -2, 1, 0}'. It is converted to the
+same sound: the sequence player held each note for one tick more than its duration, and a -n, count pair
+replays the last n notes count more times.
+"""
+
+import argparse
+import re
+import sys
+
+TUNE_END = 0x00
+TUNE_TEMPO = 0xF0
+TUNE_VOLUME = 0xF1
+TUNE_REPEAT_START = 0xF2
+TUNE_REPEAT_END = 0xF3
+MAX_REPEAT_DEPTH = 3
+TICKS_PER_SECOND = 1024
+
+SEMITONES = {'C': 0, 'D': 2, 'E': 4, 'F': 5, 'G': 7, 'A': 9, 'B': 11}
+NOTE_REST = 87
+
+
+class TuneError(Exception):
+    pass
+
+
+def note_index(name):
+    """Returns the watch_buzzer_note_t value for a note name like C8, F5# or B4b."""
+    if name.lower() in ('r', 'rest'):
+        return NOTE_REST
+    m = re.fullmatch(r'([A-Ga-g])(\d)([#b]?)', name)
+    if not m:
+        raise TuneError("bad note name '%s'" % name)
+    semitone = SEMITONES[m.group(1).upper()] + {'': 0, '#': 1, 'b': -1}[m.group(3)]
+    # BUZZER_NOTE_A1 is note 0; A is semitone 9 of octave 1.
+    index = int(m.group(2)) * 12 + semitone - 21
+    if index < 0 or index >= NOTE_REST:
+        raise TuneError("note '%s' is out of the buzzer's range (A1 to B8)" % name)
+    return index
+
+
+def varint(value):
+    if value < 0:
+        raise TuneError("negative duration")
+    out = []
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return out
+
+
+def compile_tune(text):
+    """Compiles the notation to a list of (bytes, C source fragment) items."""
+    items = []
+    depth = 0
+    tokens = []
+    for line in text.splitlines():
+        tokens.extend(line.split(';', 1)[0].split())
+    i = 0
+    while i < len(tokens):
+        token = tokens[i]
+        if token == 'tempo':
+            ticks = int(tokens[i + 1])
+            items.append(([TUNE_TEMPO] + varint(ticks), "BUZZER_TUNE_TEMPO, %s" % ", ".join(str(b) for b in varint(ticks))))
+            i += 2
+        elif token == 'bpm':
+            bpm, units = int(tokens[i + 1]), int(tokens[i + 2])
+            ticks = round(TICKS_PER_SECOND * 60 / (bpm * units))
+            items.append(([TUNE_TEMPO] + varint(ticks), "BUZZER_TUNE_TEMPO, %s" % ", ".join(str(b) for b in varint(ticks))))
+            i += 3
+        elif token == 'volume':
+            volume = int(tokens[i + 1])
+            if not 0 <= volume <= 50:
+                raise TuneError("volume must be between 0 and 50")
+            items.append(([TUNE_VOLUME, volume], "BUZZER_TUNE_VOLUME, %d" % volume))
+            i += 2
+        elif token == '[':
+            depth += 1
+            if depth > MAX_REPEAT_DEPTH:
+                raise TuneError("repeats can only be nested %d deep" % MAX_REPEAT_DEPTH)
+            items.append(([TUNE_REPEAT_START], "BUZZER_TUNE_REPEAT_START"))
+            i += 1
+        elif re.fullmatch(r'\]x\d+', token):
+            if depth == 0:
+                raise TuneError("']' without matching '['")
+            depth -= 1
+            count = int(token[2:]) - 1
+            if not 0 <= count <= 254:
+                raise TuneError("a section can be played 1 to 255 times")
+            items.append(([TUNE_REPEAT_END, count], "BUZZER_TUNE_REPEAT_END, %d" % count))
+            i += 1
+        elif ':' in token:
+            name, duration = token.split(':', 1)
+            index = note_index(name)
+            encoded = varint(int(duration))
+            items.append(([index + 1] + encoded, "BUZZER_TUNE_NOTE(%s), %s" % (enum_name(index), ", ".join(str(b) for b in encoded))))
+            i += 1
+        else:
+            raise TuneError("unexpected token '%s'" % token)
+    if depth:
+        raise TuneError("unterminated repeat")
+    items.append(([TUNE_END], "BUZZER_TUNE_END"))
+    return items
+
+
+def sequence_to_notation(text):
+    """Converts the initializer of an int8_t sequence for watch_buzzer_play_sequence to the text notation."""
+    notes = {enum_name(index): index for index in range(NOTE_REST + 1)}
+    values = []
+    for token in re.split(r'[\s,{}]+', text.split('=', 1)[-1].replace(';', ' ')):
+        if not token:
+            continue
+        if token in notes:
+            values.append(notes[token])
+        else:
+            values.append(int(token, 0))
+
+    # each item is a list of tokens, so that a repeat can wrap the last few notes without looking inside them.
+    items = []
+    for i in range(0, len(values) - 1, 2):
+        value, argument = values[i], values[i + 1]
+        if value == 0 or (value > 0 and argument == 0):
+            break
+        if value < 0:
+            count = -value
+            if count > len(items) or any(len(item) != 1 for item in items[-count:]):
+                raise TuneError("repeat of %d notes does not cover plain notes" % count)
+            section = [token for item in items[-count:] for token in item]
+            del items[-count:]
+            items.append(['['] + section + [']x%d' % (argument + 1)])
+        else:
+            items.append(['%s:%d' % (note_name(value), argument + 1)])
+    return ' '.join(token for item in items for token in item)
+
+
+def note_name(index):
+    """Returns the notation name for a note index, the inverse of note_index."""
+    if index == NOTE_REST:
+        return 'r'
+    absolute = index + 21
+    octave, semitone = divmod(absolute, 12)
+    for letter, offset in SEMITONES.items():
+        if offset == semitone:
+            return '%s%d' % (letter, octave)
+        if offset + 1 == semitone:
+            return '%s%d#' % (letter, octave)
+    raise TuneError("bad note index %d" % index)
+
+
+def enum_name(index):
+    """Returns the watch_buzzer_note_t enumerator name for a note index."""
+    if index == NOTE_REST:
+        return "BUZZER_NOTE_REST"
+    names = ["C", "C%dSHARP_D%dFLAT", "D", "D%dSHARP_E%dFLAT", "E", "F", "F%dSHARP_G%dFLAT", "G", "G%dSHARP_A%dFLAT",
+             "A", "A%dSHARP_B%dFLAT", "B"]
+    absolute = index + 21
+    octave, semitone = divmod(absolute, 12)
+    name = names[semitone]
+    if '%d' in name:
+        return "BUZZER_NOTE_" + (name % (octave, octave))
+    return "BUZZER_NOTE_%s%d" % (name, octave)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile a text tune for watch_buzzer_play_tune.")
+    parser.add_argument("input", nargs="?", help="tune file (default: stdin)")
+    parser.add_argument("--name", default="tune", help="name of the generated C array")
+    parser.add_argument("--sequence", action="store_true", help="convert an old watch_buzzer_play_sequence array")
+    args = parser.parse_args()
+
+    text = open(args.input).read() if args.input else sys.stdin.read()
+    try:
+        if args.sequence:
+            text = sequence_to_notation(text)
+        items = compile_tune(text)
+    except (TuneError, ValueError, IndexError) as e:
+        sys.exit("error: %s" % e)
+
+    size = sum(len(b) for b, _ in items)
+    print("// %d bytes, generated by utils/buzzer_tune_compiler/compile_tune.py" % size)
+    print("const uint8_t %s[] = {" % args.name)
+    for _, source in items[:-1]:
+        print("    %s," % source)
+    print("    %s" % items[-1][1])
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""Reads and changes the watch's settings over USB serial, using the binary RPC frames handled in rpc/rpc.c.
+
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 settings
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 settings le_interval=2 clock_mode_24h=1
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 time --set now --zone 12
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 faces --config movement_config.h
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 get wclk_000.u32 backup.bin
+    python3 utils/settings_rpc/settings_rpc.py --port /dev/ttyACM0 put wclk_000.u32 backup.bin
+
+The simulator has no serial port. With --simulator, each request is printed as an `rpc` shell command to paste into
+the simulator's shell, and the client waits for the "rpc: ..." line it prints back to be pasted here.
+"""
+
+import argparse
+import os
+import re
+import select
+import struct
+import sys
+import time
+
+FRAME_START = 0xA5
+RESPONSE_FLAG = 0x80
+MAX_FRAME = 64
+FRAME_OVERHEAD = 5
+MAX_PAYLOAD = MAX_FRAME - FRAME_OVERHEAD
+
+HELLO, GET_SETTINGS, SET_SETTINGS, GET_TIME, SET_TIME, LIST_FACES, READ_FILE, WRITE_FILE = range(1, 9)
+STATUSES = ['ok', 'bad frame', 'unknown command', 'bad argument', 'failed']
+
+# movement_settings_t as the compiler lays it out: (name, first bit, width). button_volume lies past the 32 bits the
+# watch keeps in its settings register, so it can't be read or set this way.
+SETTINGS_FIELDS = [
+    ('version', 0, 2),
+    ('button_should_sound', 2, 1),
+    ('to_interval', 3, 2),
+    ('le_interval', 5, 3),
+    ('led_duration', 8, 3),
+    ('led_red_color', 11, 4),
+    ('led_green_color', 16, 4),
+    ('led_blue_color', 20, 4),
+    ('time_zone', 24, 6),
+    ('clock_mode_24h', 30, 1),
+    ('use_imperial_units', 31, 1),
+]
+
+
+class RpcError(Exception):
+    pass
+
+
+def checksum(data):
+    """CRC-16/CCITT-FALSE, as in rpc.c."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+def encode_frame(command, payload=b''):
+    if len(payload) > MAX_PAYLOAD:
+        raise RpcError("payload of %d bytes is over the %d byte limit" % (len(payload), MAX_PAYLOAD))
+    body = bytes([command, len(payload)]) + payload
+    return bytes([FRAME_START]) + body + struct.pack('<H', checksum(body))
+
+
+def decode_frame(command, frame):
+    """Checks a response frame and returns its payload after the status byte."""
+    if len(frame) < FRAME_OVERHEAD + 1 or frame[0] != FRAME_START or frame[2] != len(frame) - FRAME_OVERHEAD:
+        raise RpcError("malformed response: %s" % frame.hex())
+    if checksum(frame[1:-2]) != struct.unpack('<H', frame[-2:])[0]:
+        raise RpcError("response checksum mismatch")
+    if frame[1] != command | RESPONSE_FLAG:
+        raise RpcError("response for command %d, expected %d" % (frame[1] & ~RESPONSE_FLAG, command))
+    status = frame[3]
+    if status:
+        raise RpcError(STATUSES[status] if status < len(STATUSES) else "status %d" % status)
+    return frame[4:-2]
+
+
+class SerialTransport:
+    def __init__(self, port, timeout):
+        import termios
+        import tty
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        attributes = termios.tcgetattr(self.fd)
+        attributes[3] &= ~termios.ECHO
+        termios.tcsetattr(self.fd, termios.TCSANOW, attributes)
+        self.timeout = timeout
+        # a line left half typed would stop the shell handing our frames over, so end it, and drop what comes back.
+        os.write(self.fd, b'\r')
+        self._drain(0.2)
+
+    def _drain(self, seconds):
+        while select.select([self.fd], [], [], seconds)[0]:
+            if not os.read(self.fd, 256):
+                break
+
+    def exchange(self, frame):
+        os.write(self.fd, frame)
+        received = b''
+        deadline = time.monotonic() + self.timeout
+        while True:
+            start = received.find(bytes([FRAME_START]))
+            if start >= 0 and len(received) >= start + 3 and len(received) >= start + received[start + 2] + FRAME_OVERHEAD:
+                return received[start:start + received[start + 2] + FRAME_OVERHEAD]
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+                raise RpcError("no response from the watch")
+            received += os.read(self.fd, 256)
+
+
+class SimulatorTransport:
+    def exchange(self, frame):
+        print("rpc %s" % frame.hex(), file=sys.stderr)
+        while True:
+            line = sys.stdin.readline()
+            if not line:
+                raise RpcError("no response pasted")
+            m = re.search(r'rpc:\s*([0-9a-fA-F]+)', line)
+            if m:
+                return bytes.fromhex(m.group(1))
+
+
+class Watch:
+    def __init__(self, transport):
+        self.transport = transport
+
+    def call(self, command, payload=b''):
+        return decode_frame(command, self.transport.exchange(encode_frame(command, payload)))
+
+    def hello(self):
+        version, max_payload = struct.unpack('<BB', self.call(HELLO))
+        return version, max_payload
+
+    def get_settings(self):
+        return struct.unpack('<I', self.call(GET_SETTINGS))[0]
+
+    def set_settings(self, register):
+        self.call(SET_SETTINGS, struct.pack('<I', register))
+
+    def get_time(self):
+        return struct.unpack('<IBi', self.call(GET_TIME))
+
+    def set_time(self, timestamp, zone):
+        self.call(SET_TIME, struct.pack('<IB', timestamp, zone))
+
+    def list_faces(self):
+        return struct.unpack('<BB', self.call(LIST_FACES))
+
+    def read_file(self, name):
+        name = name.encode()
+        data = b''
+        while True:
+            chunk = self.call(READ_FILE, struct.pack('<HB', len(data), MAX_PAYLOAD - 3) + name)
+            size = struct.unpack('<H', chunk[:2])[0]
+            data += chunk[2:]
+            if len(chunk) == 2 or len(data) >= size:
+                return data
+
+    def write_file(self, name, data):
+        name = name.encode()
+        chunk_size = MAX_PAYLOAD - 3 - len(name)
+        offset = 0
+        while True:
+            chunk = data[offset:offset + chunk_size]
+            self.call(WRITE_FILE, struct.pack('<HB', offset, len(name)) + name + chunk)
+            offset += len(chunk)
+            if offset >= len(data):
+                return
+
+
+def decode_settings(register):
+    return dict((name, (register >> shift) & ((1 << width) - 1)) for name, shift, width in SETTINGS_FIELDS)
+
+
+def encode_settings(register, changes):
+    fields = dict((name, (shift, width)) for name, shift, width in SETTINGS_FIELDS)
+    for change in changes:
+        name, _, value = change.partition('=')
+        if name not in fields or not value:
+            raise RpcError("expected FIELD=VALUE with FIELD one of: %s" % ", ".join(fields))
+        shift, width = fields[name]
+        value = int(value, 0)
+        if not 0 <= value < (1 << width):
+            raise RpcError("%s takes values from 0 to %d" % (name, (1 << width) - 1))
+        register = (register & ~(((1 << width) - 1) << shift)) | (value << shift)
+    return register
+
+
+def read_face_order(config):
+    """Returns the face names listed in watch_faces[] in movement_config.h, in order."""
+    with open(config) as f:
+        text = f.read()
+    m = re.search(r'watch_faces\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        return []
+    body = re.sub(r'//.*|/\*.*?\*/', '', m.group(1), flags=re.S)
+    return [name.strip() for name in body.split(',') if name.strip()]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Read and change the watch's settings over USB serial.")
+    parser.add_argument("--port", help="the watch's serial port, e.g. /dev/ttyACM0")
+    parser.add_argument("--simulator", action="store_true", help="exchange frames with the simulator by copy and paste")
+    parser.add_argument("--timeout", type=float, default=2.0, help="seconds to wait for each response")
+    commands = parser.add_subparsers(dest="command", required=True)
+    commands.add_parser("hello", help="print the protocol version")
+    settings = commands.add_parser("settings", help="print the settings, or change them with FIELD=VALUE")
+    settings.add_argument("changes", nargs="*")
+    clock = commands.add_parser("time", help="print the time and zone, or set them")
+    clock.add_argument("--set", help="UNIX time in UTC, or 'now' for this computer's clock")
+    clock.add_argument("--zone", type=int, help="time zone index")
+    faces = commands.add_parser("faces", help="print the number of faces and the one on screen")
+    faces.add_argument("--config", default="movement_config.h", help="movement_config.h, to name the faces")
+    get = commands.add_parser("get", help="copy a file from the watch")
+    get.add_argument("name")
+    get.add_argument("output", nargs="?", help="where to save it (default: print it in hex)")
+    put = commands.add_parser("put", help="copy a file to the watch")
+    put.add_argument("name")
+    put.add_argument("input")
+    args = parser.parse_args()
+
+    if args.simulator == bool(args.port):
+        parser.error("give exactly one of --port and --simulator")
+    transport = SimulatorTransport() if args.simulator else SerialTransport(args.port, args.timeout)
+    watch = Watch(transport)
+
+    try:
+        if args.command == "hello":
+            version, max_payload = watch.hello()
+            print("protocol version %d, payloads up to %d bytes" % (version, max_payload))
+        elif args.command == "settings":
+            register = watch.get_settings()
+            if args.changes:
+                register = encode_settings(register, args.changes)
+                watch.set_settings(register)
+            for name, value in decode_settings(register).items():
+                print("%-20s %d" % (name, value))
+        elif args.command == "time":
+            if args.set is not None or args.zone is not None:
+                timestamp, zone, _ = watch.get_time()
+                if args.set is not None:
+                    timestamp = int(time.time()) if args.set == "now" else int(args.set)
+                watch.set_time(timestamp, zone if args.zone is None else args.zone)
+            timestamp, zone, offset = watch.get_time()
+            print("utc: %s" % time.strftime("%Y-%m-%d %H:%M:%S", time.gmtime(timestamp)))
+            print("zone: %d (UTC%+.2g h)" % (zone, offset / 3600))
+        elif args.command == "faces":
+            count, current = watch.list_faces()
+            names = read_face_order(args.config) if os.path.exists(args.config) else []
+            for i in range(count):
+                name = names[i] if i < len(names) else ""
+                print("%s%2d %s" % ("*" if i == current else " ", i, name))
+        elif args.command == "get":
+            data = watch.read_file(args.name)
+            if args.output:
+                with open(args.output, 'wb') as f:
+                    f.write(data)
+            else:
+                print(data.hex())
+        elif args.command == "put":
+            with open(args.input, 'rb') as f:
+                watch.write_file(args.name, f.read())
+    except RpcError as e:
+        sys.exit("error: %s" % e)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""Attributes flash and RAM to watch faces, libraries and Movement subsystems, from a GNU ld map file.
+
+Every loaded input section in the map is charged to the object it came from, and objects are grouped:
+
+    face:<name>          watch-faces/*/<name>.o
+    movement:<name>      movement.o, and the filesystem, shell, location, temperature archive, tick arbiter and RPC subsystems
+    watch-library:<name> the watch library, one entry per file
+    lib:<name>           lib/<name>, littlefs, utz, tinyusb and gossamer
+    toolchain:<name>     soft-float, printf, libm, libc and libgcc members pulled in from the toolchain
+
+Toolchain members also name the object whose reference first pulled them in (from the map's "Archive member
+included to satisfy reference" table), so a face that starts using double math shows up next to the soft-float
+routines it drags in. ld only records the first reference, so a member needed by two faces is charged to one.
+
+Example:
+
+    make BOARD=sensorwatch_pro DISPLAY=classic LDFLAGS+=-Wl,-Map=build/watch.map
+    python3 utils/size_report/size_report.py build/watch.map --json build/size_report.json
+
+Heap use can't be read from the map. Pass --mem with the output of the `mem` shell command to add each face's
+heap holdings to the report; faces are named by their order in movement_config.h.
+
+Pass --budget FILE to exit with an error when any group goes over budget. The file is JSON, keyed by group
+name (or "total"), with limits in bytes for any of flash, ram, text, data, bss and heap:
+
+    {
+        "total": {"flash": 240000, "ram": 24000},
+        "face:wordle_face": {"flash": 12000, "ram": 400},
+        "toolchain:soft-float": {"flash": 0}
+    }
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import sys
+
+# an input section line looks like " .text.clock_face_loop\n                0x00001234       0x88 build/clock_face.o",
+# with the address, size and object on the same line when the section name is short enough.
+SECTION_RE = re.compile(r'^ (\.[^\s]+|COMMON)\s*$|^ (\.[^\s]+|COMMON)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.*)$')
+CONTINUATION_RE = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(.*)$')
+ARCHIVE_MEMBER_RE = re.compile(r'^(\S+\.a\([^)]+\))(?:\s+(\S+)\s+\((.+)\))?\s*$')
+REQUESTER_RE = re.compile(r'^\s+(\S+)\s+\((.+)\)\s*$')
+
+TEXT_RE = re.compile(r'^\.(text|rodata|vectors|glue_7|vfp11_veneer|v4_bx|iplt|init|fini|ctors|dtors|preinit_array|'
+                     r'init_array|fini_array|ARM\.ex|eh_frame)')
+DATA_RE = re.compile(r'^\.(data|ramfunc|relocate)')
+BSS_RE = re.compile(r'^(\.bss|COMMON$)')
+
+SOFT_FLOAT_RE = re.compile(r'(df|sf)\d*(si|di)?\.o$|(fix|float|trunc|extend|unord)\w*\.o$')
+PRINTF_RE = re.compile(r'printf|dtoa|mprec|fvwrite|wsetup|makebuf|wbuf|putc|puts|locale|ctype')
+MOVEMENT_SUBSYSTEMS = ('filesystem', 'shell', 'location', 'temperature_archive', 'rpc')
+LIBRARIES = ('littlefs', 'utz', 'tinyusb', 'gossamer')
+# for builds that put every object in one directory, the names that give away where an object came from.
+LIBRARY_OBJECTS = {'littlefs': ('lfs', 'lfs_util'), 'utz': ('utz', 'zones')}
+WATCH_LIBRARY_DRIVERS = ('lis2dw', 'thermistor_driver')
+
+MEM_FACE_RE = re.compile(r'^face (\d+): (\d+) bytes')
+MEM_SYSTEM_RE = re.compile(r'^system: (\d+) bytes')
+
+
+def parse_map(lines):
+    """Yields ('member', member, requester) for each archive member pulled in, then ('section', name, size, object)
+    for every input section in the memory map."""
+    lines = iter(lines)
+    member = None
+    for line in lines:
+        if line.startswith('Discarded input sections') or line.startswith('Memory Configuration'):
+            break
+        if member:
+            m = REQUESTER_RE.match(line)
+            if m:
+                yield 'member', member, m.group(1)
+            member = None
+            continue
+        m = ARCHIVE_MEMBER_RE.match(line)
+        if m:
+            if m.group(2):
+                yield 'member', m.group(1), m.group(2)
+            else:
+                member = m.group(1)
+
+    # skip the discarded sections and memory configuration; their sizes never reach the image.
+    for line in lines:
+        if line.startswith('Linker script and memory map'):
+            break
+
+    pending = None
+    for line in lines:
+        if pending:
+            m = CONTINUATION_RE.match(line)
+            if m:
+                yield 'section', pending, int(m.group(2), 16), m.group(3).strip()
+            pending = None
+            continue
+        m = SECTION_RE.match(line)
+        if not m:
+            continue
+        if m.group(1):
+            pending = m.group(1)
+        else:
+            yield 'section', m.group(2), int(m.group(4), 16), m.group(5).strip()
+
+
+def section_kind(name):
+    """Returns 'text', 'data' or 'bss' for a loaded input section, or None for debug info and the like."""
+    if TEXT_RE.match(name):
+        return 'text'
+    if DATA_RE.match(name):
+        return 'data'
+    if BSS_RE.match(name):
+        return 'bss'
+    return None
+
+
+def group_for(obj):
+    """Returns the report group an object file or archive member belongs to."""
+    path = obj.replace('\\', '/')
+    m = re.match(r'^(.*)\.a\((.+)\)$', path)
+    if m:
+        archive, member = os.path.basename(m.group(1)), m.group(2)
+        for library in LIBRARIES:
+            if '/%s/' % library in '/' + path:
+                return 'lib:' + library
+        if archive.startswith('libgcc'):
+            return 'toolchain:soft-float' if SOFT_FLOAT_RE.search(member) else 'toolchain:libgcc'
+        if archive.startswith('libm'):
+            return 'toolchain:libm'
+        if archive.startswith('libc') or archive.startswith('libg'):
+            return 'toolchain:printf' if PRINTF_RE.search(member) else 'toolchain:libc'
+        return 'toolchain:' + archive
+    name = os.path.splitext(os.path.basename(path))[0]
+    parts = ('/' + path).split('/')
+    if name.startswith('crt'):
+        return 'toolchain:startup'
+    if 'watch-faces' in parts or 'legacy' in parts or name.endswith('_face'):
+        return 'face:' + name
+    if 'watch-library' in parts or name.startswith('watch') or name in WATCH_LIBRARY_DRIVERS:
+        return 'watch-library:' + name
+    for library in LIBRARIES:
+        if library in parts or name in LIBRARY_OBJECTS.get(library, ()):
+            return 'lib:' + library
+    if 'lib' in parts:
+        return 'lib:' + parts[parts.index('lib') + 1]
+    if name == 'movement':
+        return 'movement:core'
+    for subsystem in MOVEMENT_SUBSYSTEMS:
+        if subsystem in parts or name.startswith(subsystem):
+            return 'movement:' + subsystem
+    return 'other:' + name
+
+
+def read_face_order(config):
+    """Returns the face names listed in watch_faces[] in movement_config.h, in order."""
+    with open(config) as f:
+        text = f.read()
+    m = re.search(r'watch_faces\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        return []
+    body = re.sub(r'//.*|/\*.*?\*/', '', m.group(1), flags=re.S)
+    return [name.strip() for name in body.split(',') if name.strip()]
+
+
+def read_mem(path, faces):
+    """Returns heap bytes per group from a capture of the `mem` shell command."""
+    heap = collections.Counter()
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            m = MEM_FACE_RE.match(line)
+            if m:
+                index = int(m.group(1))
+                name = faces[index] if index < len(faces) else 'face_%d' % index
+                heap['face:' + name] += int(m.group(2))
+            m = MEM_SYSTEM_RE.match(line)
+            if m:
+                heap['movement:core'] += int(m.group(1))
+    return heap
+
+
+def build_report(map_lines, heap=None):
+    groups = collections.defaultdict(lambda: collections.Counter())
+    pulled_in_by = {}
+    for record in parse_map(map_lines):
+        if record[0] == 'member':
+            pulled_in_by[record[1]] = record[2]
+            continue
+        _, name, size, obj = record
+        kind = section_kind(name)
+        if kind is None or size == 0:
+            continue
+        groups[group_for(obj)][kind] += size
+
+    for name, bytes_held in (heap or {}).items():
+        groups[name]['heap'] += bytes_held
+
+    report = {'groups': {}, 'total': collections.Counter(), 'pulled_in': {}}
+    for name, sizes in groups.items():
+        entry = {kind: sizes[kind] for kind in ('text', 'data', 'bss')}
+        entry['flash'] = sizes['text'] + sizes['data']
+        entry['ram'] = sizes['data'] + sizes['bss']
+        if heap is not None:
+            entry['heap'] = sizes['heap']
+        report['groups'][name] = entry
+        report['total'].update(entry)
+    report['total'] = dict(report['total'])
+
+    # follow each toolchain member back to the first object outside an archive that needed it.
+    for member, requester in pulled_in_by.items():
+        seen = set()
+        while requester in pulled_in_by and requester not in seen:
+            seen.add(requester)
+            requester = pulled_in_by[requester]
+        group = group_for(member)
+        if group.startswith('toolchain:'):
+            report['pulled_in'].setdefault(group_for(requester), {}).setdefault(group, []).append(
+                os.path.basename(member))
+    return report
+
+
+def check_budget(report, budget):
+    """Returns a list of messages describing every limit the report exceeds."""
+    problems = []
+    for name, limits in sorted(budget.items()):
+        actual = report['total'] if name == 'total' else report['groups'].get(name, {})
+        for kind, limit in sorted(limits.items()):
+            if actual.get(kind, 0) > limit:
+                problems.append("%s uses %d bytes of %s, over its %d byte budget" % (name, actual[kind], kind, limit))
+    return problems
+
+
+def print_report(report):
+    has_heap = 'heap' in report['total']
+    header = "%-36s %7s %7s %7s %7s %7s" % ("group", "text", "data", "bss", "flash", "ram")
+    print(header + (" %7s" % "heap" if has_heap else ""))
+    ordered = sorted(report['groups'].items(), key=lambda item: (item[0].split(':')[0], -item[1]['flash']))
+    for name, entry in ordered + [('total', report['total'])]:
+        line = "%-36s %7d %7d %7d %7d %7d" % (name, entry['text'], entry['data'], entry['bss'], entry['flash'],
+                                              entry['ram'])
+        print(line + (" %7d" % entry['heap'] if has_heap else ""))
+    for requester, pulled in sorted(report['pulled_in'].items()):
+        for group, members in sorted(pulled.items()):
+            if group in ('toolchain:soft-float', 'toolchain:printf', 'toolchain:libm'):
+                print("%s pulls in %s: %s" % (requester, group[len('toolchain:'):], ", ".join(sorted(members))))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report flash and RAM per watch face, library and subsystem.")
+    parser.add_argument("map", help="linker map file")
+    parser.add_argument("--json", help="also write the report to this file as JSON")
+    parser.add_argument("--mem", help="output of the `mem` shell command, to add heap use per face")
+    parser.add_argument("--config", default="movement_config.h", help="movement_config.h, to name faces for --mem")
+    parser.add_argument("--budget", help="JSON file of per-group limits; exit with an error if any is exceeded")
+    args = parser.parse_args()
+
+    heap = read_mem(args.mem, read_face_order(args.config)) if args.mem else None
+    with open(args.map) as f:
+        report = build_report(f, heap)
+
+    print_report(report)
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(report, f, indent=2, sort_keys=True)
+
+    if args.budget:
+        with open(args.budget) as f:
+            problems = check_budget(report, json.load(f))
+        if problems:
+            sys.exit("error: " + "\nerror: ".join(problems))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Checks smallchess_face's resumable search and compares it with the SCL_getAIMove call it replaced. Runs on the
+ * host:
+ *
+ *     cc -O2 -I legacy/lib/smallchesslib -I legacy/watch_faces/complication \
+ *         -o smallchess_bench utils/smallchess/smallchess_bench.c && ./smallchess_bench
+ *
+ * First it counts the leaves of the move tree from the starting position (perft) with the search's own move
+ * generator, against the published figures; smallchesslib only ever promotes to a queen, which doesn't come up
+ * within five plies of the start. Then it searches a few positions both ways, printing the move chosen, the work
+ * done and nodes per second. SCL_getAIMove counts only the positions it evaluates, while the search counts every
+ * position it visits, so the search's figure is the larger one for the same tree. Host timings don't carry over
+ * to the watch, but the node counts do, and they're what SMALLCHESS_SEARCH_MAX_NODES and the face's per-tick
+ * budget are measured in.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#define SCL_COUNT_EVALUATED_POSITIONS 1
+#include "smallchesslib.h"
+#include "smallchess_search.h"
+
+#define PERFT_DEPTH 5
+
+static const uint32_t _perft_expected[PERFT_DEPTH + 1] = {1, 20, 400, 8902, 197281, 4865609};
+
+static const char *_positions[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "r1bq1rk1/ppp2ppp/2np1n2/2b1p3/2B1P3/2NP1N2/PPP2PPP/R1BQ1RK1 w - - 0 7",
+    "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1",
+    "8/5k2/8/3K4/8/8/4P3/8 w - - 0 1",
+};
+
+static smallchess_search_t _search;
+
+static uint32_t _perft(uint8_t depth) {
+    if (depth == 0) return 1;
+
+    uint16_t first = _search.ply ? _search.stack[_search.ply - 1].first_move + _search.stack[_search.ply - 1].num_moves : 0;
+    smallchess_frame_t *frame = &_search.stack[_search.ply];
+    uint16_t count = _smallchess_search_generate(&_search, first, 0xFF, 0xFF);
+    if (count == SMALLCHESS_SEARCH_NEW_NODE) {
+        printf("move stack overflow\n");
+        return 0;
+    }
+    frame->first_move = first;
+    frame->num_moves = count;
+    if (depth == 1) return count;
+
+    uint32_t leaves = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        smallchess_move_t move = _search.moves[first + i];
+        SCL_MoveUndo undo = SCL_boardMakeMove(_search.board, move.from, move.to, 'q');
+        _search.ply++;
+        leaves += _perft(depth - 1);
+        _search.ply--;
+        SCL_boardUndoMove(_search.board, undo);
+    }
+
+    return leaves;
+}
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void) {
+    int failures = 0;
+
+    for (uint8_t depth = 1; depth <= PERFT_DEPTH; depth++) {
+        SCL_boardInit(_search.board);
+        _search.ply = 0;
+        double start = _now();
+        uint32_t leaves = _perft(depth);
+        double elapsed = _now() - start;
+        printf("perft %d: %8lu (expected %8lu) %s, %.0f ms\n", depth, (unsigned long)leaves,
+               (unsigned long)_perft_expected[depth], leaves == _perft_expected[depth] ? "ok" : "MISMATCH",
+               elapsed * 1e3);
+        if (leaves != _perft_expected[depth]) failures++;
+    }
+
+    printf("\n%-10s %22s %28s\n", "", "SCL_getAIMove depth 3", "smallchess_search");
+    printf("%-10s %6s %8s %6s %6s %8s %6s %5s\n", "position", "move", "nodes", "knps", "move", "nodes", "knps", "depth");
+    for (uint8_t i = 0; i < sizeof(_positions) / sizeof(_positions[0]); i++) {
+        SCL_Board board;
+        char from_str[3], to_str[3];
+        uint8_t from, to;
+        char promotion;
+
+        SCL_boardFromFEN(board, _positions[i]);
+        SCL_positionsEvaluated = 0;
+        double start = _now();
+        SCL_getAIMove(board, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, 0, 0, &from, &to, &promotion);
+        double scl_time = _now() - start;
+        uint32_t scl_nodes = SCL_positionsEvaluated;
+        SCL_squareToString(from, from_str);
+        SCL_squareToString(to, to_str);
+        printf("%-10d %s-%s %8lu %6.0f ", i, from_str, to_str, (unsigned long)scl_nodes, scl_nodes / scl_time / 1e3);
+
+        start = _now();
+        smallchess_search_start(&_search, board, 0, 0);
+        while (!smallchess_search_step(&_search, 64));
+        double search_time = _now() - start;
+        if (!smallchess_search_get_move(&_search, &from, &to, &promotion)) {
+            printf("no move\n");
+            failures++;
+            continue;
+        }
+        SCL_squareToString(from, from_str);
+        SCL_squareToString(to, to_str);
+        printf("%s-%s %8lu %6.0f %5d\n", from_str, to_str, (unsigned long)_search.nodes,
+               _search.nodes / search_time / 1e3, _search.completed_depth);
+    }
+
+    printf("\nsearch state: %lu bytes\n", (unsigned long)sizeof(smallchess_search_t));
+
+    return failures ? 1 : 0;
+}
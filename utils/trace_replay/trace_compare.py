@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Compares wakes, time awake and flash writes between two replays of the same input trace.
+
+Record a session on the watch, then replay it in the simulator on each build:
+
+    trace start             (in the watch's shell; use the watch for a while)
+    trace dump              (copy everything from the "trace" header line down)
+
+    loadTrace(`...`)        (in the simulator page's JavaScript console, pasting the dump)
+    trace replay            (in the simulator's shell)
+
+When the replay finishes, the simulator prints a line like
+
+    trace stats: wakes=1234 awake_us=567890 flash_writes=12
+
+Save the console output of each build to a file, and compare them:
+
+    python3 utils/trace_replay/trace_compare.py before.txt after.txt
+
+Pass --max-increase PERCENT to exit with an error if any figure grew by more than that.
+"""
+
+import argparse
+import re
+import sys
+
+STATS_RE = re.compile(r'trace stats:\s*(.*)$')
+FIELDS = ('wakes', 'awake_us', 'flash_writes')
+
+
+def read_stats(path):
+    """Returns the figures from the last "trace stats:" line in a log."""
+    stats = None
+    with open(path) as f:
+        for line in f:
+            m = STATS_RE.search(line.strip())
+            if m:
+                stats = dict((key, int(value)) for key, value in re.findall(r'(\w+)=(\d+)', m.group(1)))
+    if stats is None:
+        sys.exit("error: no 'trace stats:' line in %s" % path)
+    return stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two replays of the same input trace.")
+    parser.add_argument("before", help="simulator output from the first build")
+    parser.add_argument("after", help="simulator output from the second build")
+    parser.add_argument("--max-increase", type=float, help="fail if any figure grows by more than this percentage")
+    args = parser.parse_args()
+
+    before = read_stats(args.before)
+    after = read_stats(args.after)
+
+    regressions = []
+    print("%-14s %12s %12s %12s %8s" % ("", "before", "after", "change", "%"))
+    for field in FIELDS:
+        old, new = before.get(field, 0), after.get(field, 0)
+        percent = (new - old) * 100.0 / old if old else (0.0 if new == old else float('inf'))
+        print("%-14s %12d %12d %+12d %+7.1f%%" % (field, old, new, new - old, percent))
+        if args.max_increase is not None and percent > args.max_increase:
+            regressions.append("%s grew by %.1f%%" % (field, percent))
+
+    if regressions:
+        sys.exit("error: " + ", ".join(regressions))
+
+
+if __name__ == "__main__":
+    main()
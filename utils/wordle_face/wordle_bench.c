@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Compares the packed wordle dictionary against the one-string-per-word layout it replaced: flash used, and
+ * the cost of checking a guess (a linear scan of both word lists before, a binary search on codes now).
+ * Runs on the host:
+ *
+ *     cc -O2 -I watch-faces/complication -o wordle_bench utils/wordle_face/wordle_bench.c && ./wordle_bench
+ *
+ * Host timings don't carry over to the watch, so the number of letter compares and probes per lookup is
+ * printed too; on the Cortex-M0+ each is a handful of cycles.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES false
+#include "wordle_face_dict.h"
+
+#define NUM_LETTERS (sizeof(_valid_letters) / sizeof(_valid_letters[0]))
+#define NUM_NON_WORDS 10000
+#define ROUNDS 20
+
+static char _string_valid_words[WORDLE_NUM_WORDS][WORDLE_LENGTH + 1];
+static char _string_possible_words[WORDLE_NUM_DICT_WORDS][WORDLE_LENGTH + 1];
+static uint16_t _num_string_possible_words;
+static unsigned long _compares;
+static unsigned long _probes;
+
+static void _decode(uint32_t code, char *text) {
+    for (uint8_t i = 0; i < WORDLE_LENGTH; i++) text[i] = _valid_letters[_wordle_letter_of(code, i)];
+    text[WORDLE_LENGTH] = '\0';
+}
+
+// the guess check as it was: every answer, then every other word, a letter at a time.
+static uint16_t _string_find(const uint8_t *word_elements) {
+    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) {
+        bool match = true;
+        for (uint8_t j = 0; j < WORDLE_LENGTH; j++) {
+            _compares++;
+            if (_valid_letters[word_elements[j]] != _string_valid_words[i][j]) {
+                match = false;
+                break;
+            }
+        }
+        if (match) return i;
+    }
+    for (uint16_t i = 0; i < _num_string_possible_words; i++) {
+        bool match = true;
+        for (uint8_t j = 0; j < WORDLE_LENGTH; j++) {
+            _compares++;
+            if (_valid_letters[word_elements[j]] != _string_possible_words[i][j]) {
+                match = false;
+                break;
+            }
+        }
+        if (match) return WORDLE_NUM_WORDS + i;
+    }
+    return WORDLE_NUM_WORDS + _num_string_possible_words;
+}
+
+static uint16_t _packed_find(const uint8_t *word_elements) {
+    uint32_t code = 0;
+    for (uint8_t i = 0; i < WORDLE_LENGTH; i++) code = (code << 4) | word_elements[i];
+    // same search as _wordle_dict_find, counting probes.
+    uint16_t low = 0;
+    uint16_t high = WORDLE_NUM_DICT_WORDS;
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        uint32_t mid_code = _wordle_code_at(_dict_words, mid);
+        _probes++;
+        if (mid_code == code) return mid;
+        if (mid_code < code) low = mid + 1;
+        else high = mid;
+    }
+    return WORDLE_NUM_DICT_WORDS;
+}
+
+static double _now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void) {
+    // rebuild the old layout from the packed one.
+    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) _decode(_wordle_code_at(_valid_words, i), _string_valid_words[i]);
+    for (uint16_t i = 0; i < WORDLE_NUM_DICT_WORDS; i++) {
+        char text[WORDLE_LENGTH + 1];
+        _decode(_wordle_code_at(_dict_words, i), text);
+        bool is_answer = false;
+        for (uint16_t j = 0; j < WORDLE_NUM_WORDS && !is_answer; j++) is_answer = strcmp(text, _string_valid_words[j]) == 0;
+        if (!is_answer) strcpy(_string_possible_words[_num_string_possible_words++], text);
+    }
+
+    // every word in the dictionary, then random letter strings, which are almost never words.
+    uint32_t num_queries = WORDLE_NUM_DICT_WORDS + NUM_NON_WORDS;
+    uint8_t (*queries)[WORDLE_LENGTH] = malloc(num_queries * WORDLE_LENGTH);
+    for (uint16_t i = 0; i < WORDLE_NUM_DICT_WORDS; i++) {
+        uint32_t code = _wordle_code_at(_dict_words, i);
+        for (uint8_t j = 0; j < WORDLE_LENGTH; j++) queries[i][j] = _wordle_letter_of(code, j);
+    }
+    srand(1);
+    for (uint32_t i = WORDLE_NUM_DICT_WORDS; i < num_queries; i++) {
+        for (uint8_t j = 0; j < WORDLE_LENGTH; j++) queries[i][j] = rand() % NUM_LETTERS;
+    }
+
+    for (uint32_t i = 0; i < num_queries; i++) {
+        bool string_found = _string_find(queries[i]) != WORDLE_NUM_WORDS + _num_string_possible_words;
+        bool packed_found = _packed_find(queries[i]) != WORDLE_NUM_DICT_WORDS;
+        if (string_found != packed_found || (i < WORDLE_NUM_DICT_WORDS && !packed_found)) {
+            printf("mismatch on query %lu\n", (unsigned long)i);
+            return 1;
+        }
+    }
+
+    volatile uint32_t sink = 0;
+    _compares = _probes = 0;
+    double start = _now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (uint32_t i = 0; i < num_queries; i++) sink += _string_find(queries[i]);
+    }
+    double string_time = _now() - start;
+    start = _now();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (uint32_t i = 0; i < num_queries; i++) sink += _packed_find(queries[i]);
+    }
+    double packed_time = _now() - start;
+    (void) sink;
+
+    unsigned long lookups = (unsigned long)num_queries * ROUNDS;
+    printf("words: %d answers, %d in the guess dictionary\n", WORDLE_NUM_WORDS, WORDLE_NUM_DICT_WORDS);
+    printf("flash:  strings %lu bytes, packed %lu bytes\n",
+           (unsigned long)(WORDLE_NUM_WORDS + _num_string_possible_words) * (WORDLE_LENGTH + 1),
+           (unsigned long)(sizeof(_valid_words) + sizeof(_dict_words)));
+    printf("lookup: strings %.1f letter compares, %.0f ns; packed %.1f probes, %.0f ns\n",
+           (double)_compares / lookups, string_time * 1e9 / lookups,
+           (double)_probes / lookups, packed_time * 1e9 / lookups);
+
+    free(queries);
+
+    return 0;
+}
@@ -93,6 +93,9 @@ void close_enough_face_activate(void *context) {
     // this ensures that none of the five_minute_periods will match, so we always rerender when the face activates
     state->prev_five_minute_period = -1;
     state->prev_min_checked = -1;
+
+    // nothing on screen changes between minutes, so there's no need to wake every second.
+    movement_request_tick_period(60);
 }
 
 static void clock_check_battery_periodically(close_enough_state_t *state) {
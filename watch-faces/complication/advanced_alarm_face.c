@@ -413,7 +413,7 @@ bool advanced_alarm_face_loop(movement_event_t event, void *context) {
         // play alarm
         if (state->alarm[state->alarm_playing_idx].beeps == 0) {
             // short beep
-            if (watch_is_buzzer_or_led_enabled()) {
+            if (watch_is_buzzer_enabled()) {
                 _alarm_play_short_beep(state->alarm[state->alarm_playing_idx].pitch);
             } else {
                 // enable, play beep and disable buzzer again
@@ -97,45 +97,30 @@ bool counter_face_loop(movement_event_t event, void *context) {
 void beep_counter(counter_state_t *state) {
     int low_count = state->counter_idx/5;
     int high_count = state->counter_idx - low_count * 5;
-    static int8_t sound_seq[15];
-    memset(sound_seq, 0, 15);
+    static uint8_t tune[17];
     int i = 0;
     if (low_count > 0) {
-        sound_seq[i] = BUZZER_NOTE_A6;
-        i++;
-        sound_seq[i] = 3;
-        i++;
-        sound_seq[i] = BUZZER_NOTE_REST;
-        i++;
-        sound_seq[i] = 6;
-        i++;
-        if (low_count > 1) {
-            sound_seq[i] = -2;
-            i++;
-            sound_seq[i] = low_count-1;
-            i++;
-        }
-        sound_seq[i] = BUZZER_NOTE_REST;
-        i++;
-        sound_seq[i] = 6;
-        i++;
+        tune[i++] = BUZZER_TUNE_REPEAT_START;
+        tune[i++] = BUZZER_TUNE_NOTE(BUZZER_NOTE_A6);
+        tune[i++] = 4;
+        tune[i++] = BUZZER_TUNE_NOTE(BUZZER_NOTE_REST);
+        tune[i++] = 7;
+        tune[i++] = BUZZER_TUNE_REPEAT_END;
+        tune[i++] = low_count - 1;
+        tune[i++] = BUZZER_TUNE_NOTE(BUZZER_NOTE_REST);
+        tune[i++] = 7;
     }
     if (high_count > 0) {
-        sound_seq[i] = BUZZER_NOTE_B6;
-        i++;
-        sound_seq[i] = 3;
-        i++;
-        sound_seq[i] = BUZZER_NOTE_REST;
-        i++;
-        sound_seq[i] = 6;
-        i++;
+        tune[i++] = BUZZER_TUNE_REPEAT_START;
+        tune[i++] = BUZZER_TUNE_NOTE(BUZZER_NOTE_B6);
+        tune[i++] = 4;
+        tune[i++] = BUZZER_TUNE_NOTE(BUZZER_NOTE_REST);
+        tune[i++] = 7;
+        tune[i++] = BUZZER_TUNE_REPEAT_END;
+        tune[i++] = high_count - 1;
     }
-    if (high_count > 1) {
-        sound_seq[i] = -2;
-        i++;
-        sound_seq[i] = high_count-1;
-    }
-    watch_buzzer_play_sequence((int8_t *)sound_seq, NULL);
+    tune[i] = BUZZER_TUNE_END;
+    watch_buzzer_play_tune(tune, NULL);
 }
 
 
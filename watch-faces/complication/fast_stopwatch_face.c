@@ -271,6 +271,8 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
                 _cb_start();
                 // schedule the keepalive task when running
                 movement_schedule_background_task(distant_future);
+                // ticking at 16 Hz is the point while it runs; don't count it against the wake budget.
+                movement_set_wake_budget_exempt(true);
             } else {
                 // stop the stopwatch
                 _cb_stop();
@@ -278,6 +280,7 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
                 _set_colon();
                 // cancel the keepalive task
                 movement_cancel_background_task();
+                movement_set_wake_budget_exempt(false);
             }
             _draw();
             _button_beep();
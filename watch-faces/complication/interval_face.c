@@ -73,11 +73,44 @@ static const int8_t _default_timers[6][5] = {{0, 40, 20, 0, 0},
 static const uint8_t _intro_segdata[4][2] = {{1, 8}, {0, 8}, {0, 7}, {1, 7}};
 static const uint8_t _intro_segdata_cd[4][2] = {{1, 8}, {1, 9}, {0, 9}, {0, 8}};
 static const uint8_t _setting_page_idx[] = {1, 0, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4};
-static const int8_t _sound_seq_warmup[] = {BUZZER_NOTE_F6, 8, BUZZER_NOTE_REST, 1, -2, 3, 0};
-static const int8_t _sound_seq_work[] = {BUZZER_NOTE_F6, 8, BUZZER_NOTE_REST, 1, -2, 2, BUZZER_NOTE_C7, 24, 0};
-static const int8_t _sound_seq_break[] = {BUZZER_NOTE_B6, 15, BUZZER_NOTE_REST, 1, -2, 1, BUZZER_NOTE_B6, 16, 0};
-static const int8_t _sound_seq_cooldown[] = {BUZZER_NOTE_C7, 15, BUZZER_NOTE_REST, 1, -2, 1, BUZZER_NOTE_C7, 24, 0};
-static const int8_t _sound_seq_finish[] = {BUZZER_NOTE_C7, 6, BUZZER_NOTE_E7, 6, BUZZER_NOTE_G7, 6, BUZZER_NOTE_C8, 18, 0};
+static const uint8_t _tune_warmup[] = {
+    BUZZER_TUNE_REPEAT_START,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_REPEAT_END, 3,
+    BUZZER_TUNE_END
+};
+static const uint8_t _tune_work[] = {
+    BUZZER_TUNE_REPEAT_START,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_F6), 9,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_REPEAT_END, 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 25,
+    BUZZER_TUNE_END
+};
+static const uint8_t _tune_break[] = {
+    BUZZER_TUNE_REPEAT_START,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B6), 16,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_REPEAT_END, 1,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_B6), 17,
+    BUZZER_TUNE_END
+};
+static const uint8_t _tune_cooldown[] = {
+    BUZZER_TUNE_REPEAT_START,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 16,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 2,
+    BUZZER_TUNE_REPEAT_END, 1,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 25,
+    BUZZER_TUNE_END
+};
+static const uint8_t _tune_finish[] = {
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_E7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_G7), 7,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 19,
+    BUZZER_TUNE_END
+};
 
 static interval_setting_idx_t _setting_idx;
 static int8_t _ticks;
@@ -357,27 +390,27 @@ static void _handle_alarm_button(interval_face_state_t *state) {
 static void _set_next_timestamp(interval_face_state_t *state) {
     // set next timestamp for the running timer, set background task and pay sound sequence
     uint16_t delta = 0;
-    int8_t *sound_seq;
+    const uint8_t *tune;
     interval_timer_setting_t timer = state->timer[state->timer_idx];
     switch (_timer_run_state) {
     case 0:
         delta = timer.warmup_minutes * 60 + timer.warmup_seconds;
-        sound_seq = (int8_t *)_sound_seq_warmup;
+        tune = _tune_warmup;
         break;
     case 1:
         delta = timer.work_minutes * 60 + timer.work_seconds;
-        sound_seq = (int8_t *)_sound_seq_work;
+        tune = _tune_work;
         break;
     case 2:
         delta = timer.break_minutes * 60 + timer.break_seconds;
-        sound_seq = (int8_t *)_sound_seq_break;
+        tune = _tune_break;
         break;
     case 3:
         delta = timer.cooldown_minutes * 60 + timer.cooldown_seconds;
-        sound_seq = (int8_t *)_sound_seq_cooldown;
+        tune = _tune_cooldown;
         break;
     default:
-        sound_seq = NULL;
+        tune = NULL;
         break;
     }
     // failsafe
@@ -387,7 +420,7 @@ static void _set_next_timestamp(interval_face_state_t *state) {
     watch_date_time_t target_dt = watch_utility_date_time_from_unix_time(_target_ts, 0);
     movement_schedule_background_task_for_face(state->face_idx, target_dt);
     // play sound
-    watch_buzzer_play_sequence(sound_seq, NULL);
+    if (tune) watch_buzzer_play_tune(tune, NULL);
 }
 
 static inline bool _is_timer_empty(interval_timer_setting_t *timer) {
@@ -444,6 +477,9 @@ void interval_face_setup(uint8_t watch_face_index, void **context_ptr) {
             state->timer[i].cooldown_seconds = _default_timers[i][4];
         }
     }
+    // the nine timer settings can wait on flash while another face is shown; a running timer still gets its
+    // scheduled background task, which reads them back in.
+    movement_set_context_swappable(watch_face_index, sizeof(interval_face_state_t));
 }
 
 void interval_face_activate(void *context) {
@@ -664,7 +700,7 @@ bool interval_face_loop(movement_event_t event, void *context) {
             state->face_state = interval_state_waiting;
             _init_timer_info(state);
             _face_draw(state, event.subsecond);
-            watch_buzzer_play_sequence((int8_t *)_sound_seq_finish, NULL);
+            watch_buzzer_play_tune(_tune_finish, NULL);
         }
         break;
     case EVENT_TIMEOUT:
@@ -84,8 +84,8 @@ static const unit vols[VOL_COUNT] = {
     {"Gallon", 4546.09, 3785.412, 0},
 };
 
-static int8_t calc_success_seq[5] = {BUZZER_NOTE_G6, 10, BUZZER_NOTE_C7, 10, 0};
-static int8_t calc_fail_seq[5] = {BUZZER_NOTE_C7, 10, BUZZER_NOTE_G6, 10, 0};
+static const uint8_t calc_success_tune[] = {BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 11, BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 11, BUZZER_TUNE_END};
+static const uint8_t calc_fail_tune[] = {BUZZER_TUNE_NOTE(BUZZER_NOTE_C7), 11, BUZZER_TUNE_NOTE(BUZZER_NOTE_G6), 11, BUZZER_TUNE_END};
 
 // Resets all state variables to 0
 static void reset_state(kitchen_conversions_state_t *state)
@@ -272,7 +272,7 @@ static void display(kitchen_conversions_state_t *state, uint8_t subsec)
             watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, " Error", " Err");
 
             if (movement_button_should_sound())
-                watch_buzzer_play_sequence(calc_fail_seq, NULL);
+                watch_buzzer_play_tune(calc_fail_tune, NULL);
         }
         else
         {
@@ -293,7 +293,7 @@ static void display(kitchen_conversions_state_t *state, uint8_t subsec)
             }
 
             if (movement_button_should_sound())
-                watch_buzzer_play_sequence(calc_success_seq, NULL);
+                watch_buzzer_play_tune(calc_success_tune, NULL);
         }
         watch_display_text_with_fallback(WATCH_POSITION_TOP, "Res =", " =");
     }
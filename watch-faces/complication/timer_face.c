@@ -30,16 +30,24 @@
 
 static const uint32_t _default_timer_values[] = {0x000200, 0x000500, 0x000A00, 0x001400, 0x002D02}; // default timers: 2 min, 5 min, 10 min, 20 min, 2 h 45 min
 
-// sound sequence for a single beeping sequence
-static const int8_t _sound_seq_beep[] = {BUZZER_NOTE_C8, 3, BUZZER_NOTE_REST, 3, -2, 2, BUZZER_NOTE_C8, 5, BUZZER_NOTE_REST, 25, 0};
-static const int8_t _sound_seq_start[] = {BUZZER_NOTE_C8, 2, 0};
+// tune for a single beeping sequence
+static const uint8_t _tune_beep[] = {
+    BUZZER_TUNE_REPEAT_START,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 4,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 4,
+    BUZZER_TUNE_REPEAT_END, 2,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 6,
+    BUZZER_TUNE_NOTE(BUZZER_NOTE_REST), 26,
+    BUZZER_TUNE_END
+};
+static const uint8_t _tune_start[] = {BUZZER_TUNE_NOTE(BUZZER_NOTE_C8), 3, BUZZER_TUNE_END};
 
 static uint8_t _beeps_to_play;    // temporary counter for ring signals playing
 
 static void _signal_callback() {
     if (_beeps_to_play) {
         _beeps_to_play--;
-        watch_buzzer_play_sequence((int8_t *)_sound_seq_beep, _signal_callback);
+        watch_buzzer_play_tune(_tune_beep, _signal_callback);
     }
 }
 
@@ -58,7 +66,7 @@ static void _start(timer_state_t *state, bool with_beep) {
     state->mode = running;
     movement_schedule_background_task_for_face(state->watch_face_index, target_dt);
     watch_set_indicator(WATCH_INDICATOR_BELL);
-    if (with_beep) watch_buzzer_play_sequence((int8_t *)_sound_seq_start, NULL);
+    if (with_beep) watch_buzzer_play_tune(_tune_start, NULL);
 }
 
 static void _draw(timer_state_t *state, uint8_t subsecond) {
@@ -201,6 +209,8 @@ void timer_face_setup(uint8_t watch_face_index, void ** context_ptr) {
             state->timers[i].value = _default_timer_values[i];
         }
     }
+    // page the timer slots out while off screen; the alarm comes from a scheduled background task, not advise.
+    movement_set_context_swappable(watch_face_index, sizeof(timer_state_t));
 }
 
 void timer_face_activate(void *context) {
@@ -302,7 +312,7 @@ bool timer_face_loop(movement_event_t event, void *context) {
         case EVENT_BACKGROUND_TASK:
             // play the alarm
             _beeps_to_play = 4;
-            watch_buzzer_play_sequence((int8_t *)_sound_seq_beep, _signal_callback);
+            watch_buzzer_play_tune(_tune_beep, _signal_callback);
             _reset(state);
             if (state->timers[state->current_timer].unit.repeat) _start(state, false);
             break;
@@ -36,6 +36,13 @@ static uint32_t get_random(uint32_t max) {
     #endif
 }
 
+static void get_word_text(uint32_t code, char *text) {
+    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
+        text[i] = _valid_letters[_wordle_letter_of(code, i)];
+    }
+    text[WORDLE_LENGTH] = '\0';
+}
+
 static uint8_t get_first_pos(wordle_letter_result *word_elements_result) {
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
         if (word_elements_result[i] != WORDLE_LETTER_CORRECT)
@@ -111,38 +118,26 @@ static void display_already_guessed(wordle_state_t *state) {
     state->ignore_btn_ticks = WORDLE_TICK_BAD_GUESS;
 }
 
-static uint32_t check_word_in_dict(uint8_t *word_elements) {
-    bool is_exact_match;
-    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _valid_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return i;
-    }
-    for (uint16_t i = 0; i < WORDLE_NUM_POSSIBLE_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _possible_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return WORDLE_NUM_WORDS + i;
+static uint32_t get_word_code(const uint8_t *word_elements) {
+    uint32_t code = 0;
+    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
+        code = (code << 4) | word_elements[i];
     }
-    return WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
+    return code;
+}
+
+static uint16_t check_word_in_dict(uint8_t *word_elements) {
+    return _wordle_dict_find(get_word_code(word_elements));
 }
 #endif
 
 static bool check_word(wordle_state_t *state) {
+    uint32_t answer = _wordle_code_at(_valid_words, state->curr_answer);
     // Exact
     bool is_exact_match = true;
     bool answer_already_accounted[WORDLE_LENGTH] = { false };
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][i]) {
+        if (state->word_elements[i] == _wordle_letter_of(answer, i)) {
             state->word_elements_result[i] = WORDLE_LETTER_CORRECT;
             answer_already_accounted[i] = true;
         }
@@ -157,7 +152,7 @@ static bool check_word(wordle_state_t *state) {
         if (state->word_elements_result[i] != WORDLE_LETTER_WRONG) continue;
         for (size_t j = 0; j < WORDLE_LENGTH; j++) {
             if (answer_already_accounted[j]) continue;
-            if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][j]) {
+            if (state->word_elements[i] == _wordle_letter_of(answer, j)) {
                 state->word_elements_result[i] = WORDLE_LETTER_WRONG_LOC;
                 answer_already_accounted[j] = true;
                 break;
@@ -219,7 +214,7 @@ static void reset_all_elements(wordle_state_t *state) {
     }
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
     for (size_t i = 0; i < WORDLE_MAX_ATTEMPTS; i++) {
-        state->guessed_words[i] = WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
+        state->guessed_words[i] = WORDLE_NUM_DICT_WORDS;
     }
 #endif
     state->using_random_guess = false;
@@ -250,7 +245,9 @@ static void reset_board(wordle_state_t *state) {
     display_playing(state);
     watch_display_character('-', 5);
 #if __EMSCRIPTEN__
-    printf("ANSWER: %s\r\n", _valid_words[state->curr_answer]);
+    char answer[WORDLE_LENGTH + 1];
+    get_word_text(_wordle_code_at(_valid_words, state->curr_answer), answer);
+    printf("ANSWER: %s\r\n", answer);
 #endif
 }
 
@@ -320,7 +317,9 @@ static uint32_t get_day_unix_time(void) {
 
 static void display_lose(wordle_state_t *state, uint8_t subsecond) {
     char buf[10];
-    sprintf(buf," %s", subsecond % 2 ? _valid_words[state->curr_answer] : "     ");
+    char answer[WORDLE_LENGTH + 1];
+    get_word_text(_wordle_code_at(_valid_words, state->curr_answer), answer);
+    sprintf(buf," %s", subsecond % 2 ? answer : "     ");
     watch_display_text(WATCH_POSITION_TOP, "L   ");
     watch_display_text(WATCH_POSITION_BOTTOM, buf);
 }
@@ -451,7 +450,7 @@ static void get_result(wordle_state_t *state) {
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
     // Check if it's in the dict
     uint16_t in_dict = check_word_in_dict(state->word_elements);
-    if (in_dict == WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS) {
+    if (in_dict == WORDLE_NUM_DICT_WORDS) {
         display_not_in_dict(state);
         return;
     }
@@ -495,13 +494,10 @@ static void insert_random_guess(wordle_state_t *state) {
     do {  // Don't allow the guess to be the same as the answer
         random_guess = get_random(_num_random_guess_words);
     } while (random_guess == state->curr_answer); 
+    uint32_t code = _wordle_code_at(_valid_words, random_guess);
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++)
-        {
-            if (_valid_words[random_guess][i] == _valid_letters[j])
-                state->word_elements[i] = j;     
-        }
-    } 
+        state->word_elements[i] = _wordle_letter_of(code, i);
+    }
     state->position = WORDLE_LENGTH - 1;
     display_all_letters(state);
     state->using_random_guess = true;
@@ -530,7 +526,6 @@ static void _activate(wordle_state_t *state) {
 }
 
 void wordle_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(wordle_state_t));
         memset(*context_ptr, 0, sizeof(wordle_state_t));
@@ -540,6 +535,8 @@ void wordle_face_setup(uint8_t watch_face_index, void ** context_ptr) {
         reset_all_elements(state);
         memset(state->not_to_use, 0xff, sizeof(state->not_to_use));
     }
+    // only the game on screen needs to be in RAM.
+    movement_set_context_swappable(watch_face_index, sizeof(wordle_state_t));
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
 
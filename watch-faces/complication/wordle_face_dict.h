@@ -9,285 +9,754 @@
 #define WORDLE_USE_RANDOM_GUESS 2
 #endif
 
+#if WORDLE_LENGTH != 5
+#error "wordle_face_dict.h holds 5 letter words; regenerate it with utils/wordle_face/wordle_list.py"
+#endif
+
 static const char _valid_letters[] = {'A', 'C', 'E', 'H', 'I', 'L', 'N', 'O', 'P', 'R', 'S', 'T'};
 
+// Words are packed as one 4-bit index into _valid_letters per letter, first letter in the high nibble, so each
+// word is a 20-bit code, and codes sort the same way the words do. Word i starts at nibble i * WORDLE_LENGTH.
+#define WORDLE_NUM_WORDS 432
+#define WORDLE_NUM_DICT_WORDS 2330
+
 // From: https://matthewminer.name/projects/calculators/wordle-words-left/
 // Number of words found: 432
-static const char _valid_words[][WORDLE_LENGTH + 1] = {
-    "SLATE", "STARE", "SNARE", "SANER", "CRANE", "STALE", "CRATE", "RAISE", "TRACE", 
-    "SHARE", "ARISE", "SCARE", "SPARE", "CHAOS", "TAPIR", "CAIRN", "TENOR", "CLEAN", 
-    "HEART", "SCOPE", "SNARL", "SLEPT", "SINCE", "EPOCH", "SPACE", "RELIC", "SPOIL", 
-    "LITER", "LEAPT", "LANCE", "RANCH", "HORSE", "LEACH", "LATER", "STEAL", "CHEAP", 
-    "SHORT", "ETHIC", "CHANT", "ACTOR", "REACH", "SEPIA", "ONSET", "SPLAT", "LEANT", 
-    "REACT", "OCTAL", "SPORE", "IRATE", "CORAL", "NICER", "SPILT", "SCENT", "PANIC", 
-    "SHIRT", "PECAN", "SLAIN", "SPLIT", "ROACH", "ASCOT", "PHONE", "LITHE", "STOIC", 
-    "STRIP", "RENAL", "POISE", "ENACT", "CHEAT", "PITCH", "NOISE", "INLET", "PEARL", 
-    "POLAR", "PEACH", "STOLE", "CASTE", "CREST", "CRONE", "ETHOS", "THEIR", "STONE", 
-    "SHIRE", "LATCH", "HASTE", "CLOSE", "SPINE", "SLANT", "SPEAR", "SCALE", "CAPER", 
-    "RETCH", "PESTO", "CHIRP", "SPORT", "OPTIC", "SNAIL", "PRICE", "PLANE", "TORCH", 
-    "PASTE", "RECAP", "SOLAR", "CRASH", "LINER", "OPINE", "ASHEN", "PALER", "ECLAT", 
-    "SPELT", "TRIAL", "PERIL", "SLICE", "SCANT", "SAINT", "POSIT", "ATONE", "SPIRE", 
-    "COAST", "INEPT", "SHOAL", "CLASH", "THORN", "PHASE", "SCORE", "TRICE", "PERCH", 
-    "PORCH", "SHEAR", "CHOIR", "RHINO", "PLANT", "SHONE", "CHORE", "LEARN", "ALTER", 
-    "CHAIN", "PANEL", "PLIER", "STEIN", "COPSE", "SONIC", "ALIEN", "CHOSE", "ACORN", 
-    "ANTIC", "CHEST", "OTHER", "CHINA", "TALON", "SCORN", "PLAIN", "PILOT", "RIPEN", 
-    "PATCH", "SPICE", "CLONE", "SCION", "SCONE", "STRAP", "PARSE", "SHALE", "RISEN", 
-    "CANOE", "INTER", "LEASH", "ISLET", "PRINT", "SHINE", "NORTH", "CLEAT", "PLAIT", 
-    "SCRAP", "CLEAR", "SLOTH", "LAPSE", "CHAIR", "SNORT", "SHARP", "OPERA", "STAIN", 
-    "TEACH", "TRAIL", "TRAIN", "LATHE", "PIANO", "PINCH", "PETAL", "STERN", "PRONE", 
-    "PROSE", "PLEAT", "TROPE", "PLACE", "POSER", "INERT", "CHASE", "CAROL", "STAIR", 
-    "SATIN", "SPITE", "LOATH", "ROAST", "ARSON", "SHAPE", "CLASP", "LOSER", "SALON", 
-    "CATER", "SHALT", "INTRO", "ALERT", "PENAL", "SHORE", "RINSE", "CREPT", "APRON", 
-    "SONAR", "AISLE", "AROSE", "HATER", "NICHE", "POINT", "EARTH", "PINTO", "THOSE", 
-    "CLOTH", "NOTCH", "TOPIC", "RESIN", "SCALP", "HEIST", "HERON", "TRIPE", "TONAL", 
-    "TAPER", "SHORN", "TONIC", "HOIST", "SNORE", "STORE", "SLOPE", "OCEAN", "CHART", 
-    "PAINT", "SPENT", "SNIPE", "CRISP", "TRASH", "PATIO", "PLATE", "HOTEL", "LEAST", 
-    "ALONE", "RALPH", "SPIEL", "SIREN", "RATIO", "STOOP", "TROLL", "ATOLL", "SLASH", 
-    "RETRO", "CREEP", "STILT", "SPREE", "TASTE", "CACHE", "CANON", "EATEN", "TEPEE", 
-    "SHEET", "SNEER", "ERROR", "NATAL", "SLEEP", "STINT", "TROOP", "SHALL", "STALL", 
-    "PIPER", "TOAST", "NASAL", "CORER", "THERE", "POOCH", "SCREE", "ELITE", "ALTAR", 
-    "PENCE", "EATER", "ALPHA", "TENTH", "LINEN", "SHEER", "TAINT", "HEATH", "CRIER", 
-    "TENSE", "CARAT", "CANAL", "APNEA", "THESE", "HATCH", "SHELL", "CIRCA", "APART", 
-    "SPILL", "STEEL", "LOCAL", "STOOL", "SHEEN", "RESET", "STEEP", "ELATE", "PRESS", 
-    "SLEET", "CROSS", "TOTAL", "TREAT", "ONION", "STATE", "CINCH", "ASSET", "THREE", 
-    "TORSO", "SNOOP", "PENNE", "SPOON", "SHEEP", "PAPAL", "STILL", "CHILL", "THETA", 
-    "LEECH", "INNER", "HONOR", "LOOSE", "CONIC", "SCENE", "COACH", "CONCH", "LATTE", 
-    "ERASE", "ESTER", "PEACE", "PASTA", "INANE", "SPOOL", "TEASE", "HARSH", "PIECE", 
-    "STEER", "SCOOP", "NINTH", "OTTER", "OCTET", "EERIE", "RISER", "LAPEL", "HIPPO", 
-    "PREEN", "ETHER", "AORTA", "SENSE", "TRACT", "SHOOT", "SLOOP", "REPEL", "TITHE", 
-    "IONIC", "CELLO", "CHESS", "SOOTH", "COCOA", "TITAN", "TOOTH", "TIARA", "CRESS", 
-    "SLOSH", "RARER", "TERSE", "ERECT", "HELLO", "PARER", "RIPER", "NOOSE", "CREPE", 
-    "CACAO", "ILIAC", "POSSE", "CACTI", "EASEL", "LASSO", "ROOST", "ALLOT", "COLON", 
-    "LEPER", "TEETH", "TITLE", "HENCE", "NIECE", "PAPER", "TRITE", "SPELL", "RACER", 
-    "ATTIC", "CRASS", "HITCH", "LEASE", "CEASE", "ROTOR", "ELOPE", "APPLE", "CHILI", 
-    "START", "PHOTO", "SALSA", "STASH", "PRIOR", "TAROT", "COLOR", "CHEER", "CLASS", 
-    "ARENA", "ELECT", "ENTER", "CATCH", "TENET", "TACIT", "TRAIT", "TERRA", "LILAC", 
+static const uint8_t _valid_words[] = {
+    0xA5, 0x0B, 0x2A, 0xB0, 0x92, 0xA6, 0x09, 0x2A, 0x06, 0x29,  // SLATE STARE SNARE SANER
+    0x19, 0x06, 0x2A, 0xB0, 0x52, 0x19, 0x0B, 0x29, 0x04, 0xA2,  // CRANE STALE CRATE RAISE
+    0xB9, 0x01, 0x2A, 0x30, 0x92, 0x09, 0x4A, 0x2A, 0x10, 0x92,  // TRACE SHARE ARISE SCARE
+    0xA8, 0x09, 0x21, 0x30, 0x7A, 0xB0, 0x84, 0x91, 0x04, 0x96,  // SPARE CHAOS TAPIR CAIRN
+    0xB2, 0x67, 0x91, 0x52, 0x06, 0x32, 0x09, 0xBA, 0x17, 0x82,  // TENOR CLEAN HEART SCOPE
+    0xA6, 0x09, 0x5A, 0x52, 0x8B, 0xA4, 0x61, 0x22, 0x87, 0x13,  // SNARL SLEPT SINCE EPOCH
+    0xA8, 0x01, 0x29, 0x25, 0x41, 0xA8, 0x74, 0x55, 0x4B, 0x29,  // SPACE RELIC SPOIL LITER
+    0x52, 0x08, 0xB5, 0x06, 0x12, 0x90, 0x61, 0x33, 0x79, 0xA2,  // LEAPT LANCE RANCH HORSE
+    0x52, 0x01, 0x35, 0x0B, 0x29, 0xAB, 0x20, 0x51, 0x32, 0x08,  // LEACH LATER STEAL CHEAP
+    0xA3, 0x79, 0xB2, 0xB3, 0x41, 0x13, 0x06, 0xB0, 0x1B, 0x79,  // SHORT ETHIC CHANT ACTOR
+    0x92, 0x01, 0x3A, 0x28, 0x40, 0x76, 0xA2, 0xBA, 0x85, 0x0B,  // REACH SEPIA ONSET SPLAT
+    0x52, 0x06, 0xB9, 0x20, 0x1B, 0x71, 0xB0, 0x5A, 0x87, 0x92,  // LEANT REACT OCTAL SPORE
+    0x49, 0x0B, 0x21, 0x79, 0x05, 0x64, 0x12, 0x9A, 0x84, 0x5B,  // IRATE CORAL NICER SPILT
+    0xA1, 0x26, 0xB8, 0x06, 0x41, 0xA3, 0x49, 0xB8, 0x21, 0x06,  // SCENT PANIC SHIRT PECAN
+    0xA5, 0x04, 0x6A, 0x85, 0x4B, 0x97, 0x01, 0x30, 0xA1, 0x7B,  // SLAIN SPLIT ROACH ASCOT
+    0x83, 0x76, 0x25, 0x4B, 0x32, 0xAB, 0x74, 0x1A, 0xB9, 0x48,  // PHONE LITHE STOIC STRIP
+    0x92, 0x60, 0x58, 0x74, 0xA2, 0x26, 0x01, 0xB1, 0x32, 0x0B,  // RENAL POISE ENACT CHEAT
+    0x84, 0xB1, 0x36, 0x74, 0xA2, 0x46, 0x52, 0xB8, 0x20, 0x95,  // PITCH NOISE INLET PEARL
+    0x87, 0x50, 0x98, 0x20, 0x13, 0xAB, 0x75, 0x21, 0x0A, 0xB2,  // POLAR PEACH STOLE CASTE
+    0x19, 0x2A, 0xB1, 0x97, 0x62, 0x2B, 0x37, 0xAB, 0x32, 0x49,  // CREST CRONE ETHOS THEIR
+    0xAB, 0x76, 0x2A, 0x34, 0x92, 0x50, 0xB1, 0x33, 0x0A, 0xB2,  // STONE SHIRE LATCH HASTE
+    0x15, 0x7A, 0x2A, 0x84, 0x62, 0xA5, 0x06, 0xBA, 0x82, 0x09,  // CLOSE SPINE SLANT SPEAR
+    0xA1, 0x05, 0x21, 0x08, 0x29, 0x92, 0xB1, 0x38, 0x2A, 0xB7,  // SCALE CAPER RETCH PESTO
+    0x13, 0x49, 0x8A, 0x87, 0x9B, 0x78, 0xB4, 0x1A, 0x60, 0x45,  // CHIRP SPORT OPTIC SNAIL
+    0x89, 0x41, 0x28, 0x50, 0x62, 0xB7, 0x91, 0x38, 0x0A, 0xB2,  // PRICE PLANE TORCH PASTE
+    0x92, 0x10, 0x8A, 0x75, 0x09, 0x19, 0x0A, 0x35, 0x46, 0x29,  // RECAP SOLAR CRASH LINER
+    0x78, 0x46, 0x20, 0xA3, 0x26, 0x80, 0x52, 0x92, 0x15, 0x0B,  // OPINE ASHEN PALER ECLAT
+    0xA8, 0x25, 0xBB, 0x94, 0x05, 0x82, 0x94, 0x5A, 0x54, 0x12,  // SPELT TRIAL PERIL SLICE
+    0xA1, 0x06, 0xBA, 0x04, 0x6B, 0x87, 0xA4, 0xB0, 0xB7, 0x62,  // SCANT SAINT POSIT ATONE
+    0xA8, 0x49, 0x21, 0x70, 0xAB, 0x46, 0x28, 0xBA, 0x37, 0x05,  // SPIRE COAST INEPT SHOAL
+    0x15, 0x0A, 0x3B, 0x37, 0x96, 0x83, 0x0A, 0x2A, 0x17, 0x92,  // CLASH THORN PHASE SCORE
+    0xB9, 0x41, 0x28, 0x29, 0x13, 0x87, 0x91, 0x3A, 0x32, 0x09,  // TRICE PERCH PORCH SHEAR
+    0x13, 0x74, 0x99, 0x34, 0x67, 0x85, 0x06, 0xBA, 0x37, 0x62,  // CHOIR RHINO PLANT SHONE
+    0x13, 0x79, 0x25, 0x20, 0x96, 0x05, 0xB2, 0x91, 0x30, 0x46,  // CHORE LEARN ALTER CHAIN
+    0x80, 0x62, 0x58, 0x54, 0x29, 0xAB, 0x24, 0x61, 0x78, 0xA2,  // PANEL PLIER STEIN COPSE
+    0xA7, 0x64, 0x10, 0x54, 0x26, 0x13, 0x7A, 0x20, 0x17, 0x96,  // SONIC ALIEN CHOSE ACORN
+    0x06, 0xB4, 0x11, 0x32, 0xAB, 0x7B, 0x32, 0x91, 0x34, 0x60,  // ANTIC CHEST OTHER CHINA
+    0xB0, 0x57, 0x6A, 0x17, 0x96, 0x85, 0x04, 0x68, 0x45, 0x7B,  // TALON SCORN PLAIN PILOT
+    0x94, 0x82, 0x68, 0x0B, 0x13, 0xA8, 0x41, 0x21, 0x57, 0x62,  // RIPEN PATCH SPICE CLONE
+    0xA1, 0x47, 0x6A, 0x17, 0x62, 0xAB, 0x90, 0x88, 0x09, 0xA2,  // SCION SCONE STRAP PARSE
+    0xA3, 0x05, 0x29, 0x4A, 0x26, 0x10, 0x67, 0x24, 0x6B, 0x29,  // SHALE RISEN CANOE INTER
+    0x52, 0x0A, 0x34, 0xA5, 0x2B, 0x89, 0x46, 0xBA, 0x34, 0x62,  // LEASH ISLET PRINT SHINE
+    0x67, 0x9B, 0x31, 0x52, 0x0B, 0x85, 0x04, 0xBA, 0x19, 0x08,  // NORTH CLEAT PLAIT SCRAP
+    0x15, 0x20, 0x9A, 0x57, 0xB3, 0x50, 0x8A, 0x21, 0x30, 0x49,  // CLEAR SLOTH LAPSE CHAIR
+    0xA6, 0x79, 0xBA, 0x30, 0x98, 0x78, 0x29, 0x0A, 0xB0, 0x46,  // SNORT SHARP OPERA STAIN
+    0xB2, 0x01, 0x3B, 0x90, 0x45, 0xB9, 0x04, 0x65, 0x0B, 0x32,  // TEACH TRAIL TRAIN LATHE
+    0x84, 0x06, 0x78, 0x46, 0x13, 0x82, 0xB0, 0x5A, 0xB2, 0x96,  // PIANO PINCH PETAL STERN
+    0x89, 0x76, 0x28, 0x97, 0xA2, 0x85, 0x20, 0xBB, 0x97, 0x82,  // PRONE PROSE PLEAT TROPE
+    0x85, 0x01, 0x28, 0x7A, 0x29, 0x46, 0x29, 0xB1, 0x30, 0xA2,  // PLACE POSER INERT CHASE
+    0x10, 0x97, 0x5A, 0xB0, 0x49, 0xA0, 0xB4, 0x6A, 0x84, 0xB2,  // CAROL STAIR SATIN SPITE
+    0x57, 0x0B, 0x39, 0x70, 0xAB, 0x09, 0xA7, 0x6A, 0x30, 0x82,  // LOATH ROAST ARSON SHAPE
+    0x15, 0x0A, 0x85, 0x7A, 0x29, 0xA0, 0x57, 0x61, 0x0B, 0x29,  // CLASP LOSER SALON CATER
+    0xA3, 0x05, 0xB4, 0x6B, 0x97, 0x05, 0x29, 0xB8, 0x26, 0x05,  // SHALT INTRO ALERT PENAL
+    0xA3, 0x79, 0x29, 0x46, 0xA2, 0x19, 0x28, 0xB0, 0x89, 0x76,  // SHORE RINSE CREPT APRON
+    0xA7, 0x60, 0x90, 0x4A, 0x52, 0x09, 0x7A, 0x23, 0x0B, 0x29,  // SONAR AISLE AROSE HATER
+    0x64, 0x13, 0x28, 0x74, 0x6B, 0x20, 0x9B, 0x38, 0x46, 0xB7,  // NICHE POINT EARTH PINTO
+    0xB3, 0x7A, 0x21, 0x57, 0xB3, 0x67, 0xB1, 0x3B, 0x78, 0x41,  // THOSE CLOTH NOTCH TOPIC
+    0x92, 0xA4, 0x6A, 0x10, 0x58, 0x32, 0x4A, 0xB3, 0x29, 0x76,  // RESIN SCALP HEIST HERON
+    0xB9, 0x48, 0x2B, 0x76, 0x05, 0xB0, 0x82, 0x9A, 0x37, 0x96,  // TRIPE TONAL TAPER SHORN
+    0xB7, 0x64, 0x13, 0x74, 0xAB, 0xA6, 0x79, 0x2A, 0xB7, 0x92,  // TONIC HOIST SNORE STORE
+    0xA5, 0x78, 0x27, 0x12, 0x06, 0x13, 0x09, 0xB8, 0x04, 0x6B,  // SLOPE OCEAN CHART PAINT
+    0xA8, 0x26, 0xBA, 0x64, 0x82, 0x19, 0x4A, 0x8B, 0x90, 0xA3,  // SPENT SNIPE CRISP TRASH
+    0x80, 0xB4, 0x78, 0x50, 0xB2, 0x37, 0xB2, 0x55, 0x20, 0xAB,  // PATIO PLATE HOTEL LEAST
+    0x05, 0x76, 0x29, 0x05, 0x83, 0xA8, 0x42, 0x5A, 0x49, 0x26,  // ALONE RALPH SPIEL SIREN
+    0x90, 0xB4, 0x7A, 0xB7, 0x78, 0xB9, 0x75, 0x50, 0xB7, 0x55,  // RATIO STOOP TROLL ATOLL
+    0xA5, 0x0A, 0x39, 0x2B, 0x97, 0x19, 0x22, 0x8A, 0xB4, 0x5B,  // SLASH RETRO CREEP STILT
+    0xA8, 0x92, 0x2B, 0x0A, 0xB2, 0x10, 0x13, 0x21, 0x06, 0x76,  // SPREE TASTE CACHE CANON
+    0x20, 0xB2, 0x6B, 0x28, 0x22, 0xA3, 0x22, 0xBA, 0x62, 0x29,  // EATEN TEPEE SHEET SNEER
+    0x29, 0x97, 0x96, 0x0B, 0x05, 0xA5, 0x22, 0x8A, 0xB4, 0x6B,  // ERROR NATAL SLEEP STINT
+    0xB9, 0x77, 0x8A, 0x30, 0x55, 0xAB, 0x05, 0x58, 0x48, 0x29,  // TROOP SHALL STALL PIPER
+    0xB7, 0x0A, 0xB6, 0x0A, 0x05, 0x17, 0x92, 0x9B, 0x32, 0x92,  // TOAST NASAL CORER THERE
+    0x87, 0x71, 0x3A, 0x19, 0x22, 0x25, 0x4B, 0x20, 0x5B, 0x09,  // POOCH SCREE ELITE ALTAR
+    0x82, 0x61, 0x22, 0x0B, 0x29, 0x05, 0x83, 0x0B, 0x26, 0xB3,  // PENCE EATER ALPHA TENTH
+    0x54, 0x62, 0x6A, 0x32, 0x29, 0xB0, 0x46, 0xB3, 0x20, 0xB3,  // LINEN SHEER TAINT HEATH
+    0x19, 0x42, 0x9B, 0x26, 0xA2, 0x10, 0x90, 0xB1, 0x06, 0x05,  // CRIER TENSE CARAT CANAL
+    0x08, 0x62, 0x0B, 0x32, 0xA2, 0x30, 0xB1, 0x3A, 0x32, 0x55,  // APNEA THESE HATCH SHELL
+    0x14, 0x91, 0x00, 0x80, 0x9B, 0xA8, 0x45, 0x5A, 0xB2, 0x25,  // CIRCA APART SPILL STEEL
+    0x57, 0x10, 0x5A, 0xB7, 0x75, 0xA3, 0x22, 0x69, 0x2A, 0x2B,  // LOCAL STOOL SHEEN RESET
+    0xAB, 0x22, 0x82, 0x50, 0xB2, 0x89, 0x2A, 0xAA, 0x52, 0x2B,  // STEEP ELATE PRESS SLEET
+    0x19, 0x7A, 0xAB, 0x7B, 0x05, 0xB9, 0x20, 0xB7, 0x64, 0x76,  // CROSS TOTAL TREAT ONION
+    0xAB, 0x0B, 0x21, 0x46, 0x13, 0x0A, 0xA2, 0xBB, 0x39, 0x22,  // STATE CINCH ASSET THREE
+    0xB7, 0x9A, 0x7A, 0x67, 0x78, 0x82, 0x66, 0x2A, 0x87, 0x76,  // TORSO SNOOP PENNE SPOON
+    0xA3, 0x22, 0x88, 0x08, 0x05, 0xAB, 0x45, 0x51, 0x34, 0x55,  // SHEEP PAPAL STILL CHILL
+    0xB3, 0x2B, 0x05, 0x22, 0x13, 0x46, 0x62, 0x93, 0x76, 0x79,  // THETA LEECH INNER HONOR
+    0x57, 0x7A, 0x21, 0x76, 0x41, 0xA1, 0x26, 0x21, 0x70, 0x13,  // LOOSE CONIC SCENE COACH
+    0x17, 0x61, 0x35, 0x0B, 0xB2, 0x29, 0x0A, 0x22, 0xAB, 0x29,  // CONCH LATTE ERASE ESTER
+    0x82, 0x01, 0x28, 0x0A, 0xB0, 0x46, 0x06, 0x2A, 0x87, 0x75,  // PEACE PASTA INANE SPOOL
+    0xB2, 0x0A, 0x23, 0x09, 0xA3, 0x84, 0x21, 0x2A, 0xB2, 0x29,  // TEASE HARSH PIECE STEER
+    0xA1, 0x77, 0x86, 0x46, 0xB3, 0x7B, 0xB2, 0x97, 0x1B, 0x2B,  // SCOOP NINTH OTTER OCTET
+    0x22, 0x94, 0x29, 0x4A, 0x29, 0x50, 0x82, 0x53, 0x48, 0x87,  // EERIE RISER LAPEL HIPPO
+    0x89, 0x22, 0x62, 0xB3, 0x29, 0x07, 0x9B, 0x0A, 0x26, 0xA2,  // PREEN ETHER AORTA SENSE
+    0xB9, 0x01, 0xBA, 0x37, 0x7B, 0xA5, 0x77, 0x89, 0x28, 0x25,  // TRACT SHOOT SLOOP REPEL
+    0xB4, 0xB3, 0x24, 0x76, 0x41, 0x12, 0x55, 0x71, 0x32, 0xAA,  // TITHE IONIC CELLO CHESS
+    0xA7, 0x7B, 0x31, 0x71, 0x70, 0xB4, 0xB0, 0x6B, 0x77, 0xB3,  // SOOTH COCOA TITAN TOOTH
+    0xB4, 0x09, 0x01, 0x92, 0xAA, 0xA5, 0x7A, 0x39, 0x09, 0x29,  // TIARA CRESS SLOSH RARER
+    0xB2, 0x9A, 0x22, 0x92, 0x1B, 0x32, 0x55, 0x78, 0x09, 0x29,  // TERSE ERECT HELLO PARER
+    0x94, 0x82, 0x96, 0x77, 0xA2, 0x19, 0x28, 0x21, 0x01, 0x07,  // RIPER NOOSE CREPE CACAO
+    0x45, 0x40, 0x18, 0x7A, 0xA2, 0x10, 0x1B, 0x42, 0x0A, 0x25,  // ILIAC POSSE CACTI EASEL
+    0x50, 0xAA, 0x79, 0x77, 0xAB, 0x05, 0x57, 0xB1, 0x75, 0x76,  // LASSO ROOST ALLOT COLON
+    0x52, 0x82, 0x9B, 0x22, 0xB3, 0xB4, 0xB5, 0x23, 0x26, 0x12,  // LEPER TEETH TITLE HENCE
+    0x64, 0x21, 0x28, 0x08, 0x29, 0xB9, 0x4B, 0x2A, 0x82, 0x55,  // NIECE PAPER TRITE SPELL
+    0x90, 0x12, 0x90, 0xBB, 0x41, 0x19, 0x0A, 0xA3, 0x4B, 0x13,  // RACER ATTIC CRASS HITCH
+    0x52, 0x0A, 0x21, 0x20, 0xA2, 0x97, 0xB7, 0x92, 0x57, 0x82,  // LEASE CEASE ROTOR ELOPE
+    0x08, 0x85, 0x21, 0x34, 0x54, 0xAB, 0x09, 0xB8, 0x37, 0xB7,  // APPLE CHILI START PHOTO
+    0xA0, 0x5A, 0x0A, 0xB0, 0xA3, 0x89, 0x47, 0x9B, 0x09, 0x7B,  // SALSA STASH PRIOR TAROT
+    0x17, 0x57, 0x91, 0x32, 0x29, 0x15, 0x0A, 0xA0, 0x92, 0x60,  // COLOR CHEER CLASS ARENA
+    0x25, 0x21, 0xB2, 0x6B, 0x29, 0x10, 0xB1, 0x3B, 0x26, 0x2B,  // ELECT ENTER CATCH TENET
+    0xB0, 0x14, 0xBB, 0x90, 0x4B, 0xB2, 0x99, 0x05, 0x45, 0x01,  // TACIT TRAIT TERRA LILAC
 };
 
-// These are words that'll never be used, but still need to be in the dictionary for guesses.
-// Number of words found: 1898
-static const char _possible_words[][WORDLE_LENGTH + 1] = {
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
-    "AALII", "AARTI", "ACAIS", "ACARI", "ACCAS", "ACERS", "ACETA", "ACHAR", "ACHES", 
-    "ACHOO", "ACINI", "ACNES", "ACRES", "ACROS", "ACTIN", "ACTON", "AECIA", "AEONS", 
-    "AERIE", "AEROS", "AESIR", "AHEAP", "AHENT", "AHINT", "AINEE", "AIOLI", "AIRER", 
-    "AIRNS", "AIRTH", "AIRTS", "AITCH", "ALAAP", "ALANE", "ALANS", "ALANT", "ALAPA", 
-    "ALAPS", "ALATE", "ALCOS", "ALECS", "ALEPH", "ALIAS", "ALINE", "ALIST", "ALLEE", 
-    "ALLEL", "ALLIS", "ALOES", "ALOHA", "ALOIN", "ALOOS", "ALTHO", "ALTOS", "ANANA", 
-    "ANATA", "ANCHO", "ANCLE", "ANCON", "ANEAR", "ANELE", "ANENT", "ANILE", "ANILS", 
-    "ANION", "ANISE", "ANLAS", "ANNAL", "ANNAS", "ANNAT", "ANOAS", "ANOLE", "ANSAE", 
-    "ANTAE", "ANTAR", "ANTAS", "ANTES", "ANTIS", "ANTRA", "ANTRE", "APACE", "APERS", 
-    "APERT", "APHIS", "APIAN", "APIOL", "APISH", "APOOP", "APORT", "APPAL", "APPEL", 
-    "APPRO", "APRES", "APSES", "APSIS", "APSOS", "APTER", "ARARS", "ARCHI", "ARCOS", 
-    "AREAE", "AREAL", "AREAR", "AREAS", "ARECA", "AREIC", "ARENE", "AREPA", "ARERE", 
-    "ARETE", "ARETS", "ARETT", "ARHAT", "ARIAS", "ARIEL", "ARILS", "ARIOT", "ARISH", 
-    "ARLES", "ARNAS", "AROHA", "ARPAS", "ARPEN", "ARRAH", "ARRAS", "ARRET", "ARRIS", 
-    "ARSES", "ARSIS", "ARTAL", "ARTEL", "ARTIC", "ARTIS", "ASANA", "ASCON", "ASHES", 
-    "ASHET", "ASPEN", "ASPER", "ASPIC", "ASPIE", "ASPIS", "ASPRO", "ASSAI", "ASSES", 
-    "ASSOT", "ASTER", "ASTIR", "ATAPS", "ATILT", "ATLAS", "ATOCS", "ATRIA", "ATRIP", 
-    "ATTAP", "ATTAR", "CACAS", "CAECA", "CAESE", "CAINS", "CALLA", "CALLS", "CALOS", 
-    "CALPA", "CALPS", "CANEH", "CANER", "CANES", "CANNA", "CANNS", "CANSO", "CANST", 
-    "CANTO", "CANTS", "CAPAS", "CAPES", "CAPHS", "CAPLE", "CAPON", "CAPOS", "CAPOT", 
-    "CAPRI", "CARAP", "CARER", "CARES", "CARET", "CARLE", "CARLS", "CARNS", "CARON", 
-    "CARPI", "CARPS", "CARRS", "CARSE", "CARTA", "CARTE", "CARTS", "CASAS", "CASCO", 
-    "CASES", "CASTS", "CATES", "CECAL", "CEILI", "CEILS", "CELLA", "CELLI", "CELLS", 
-    "CELTS", "CENSE", "CENTO", "CENTS", "CEORL", "CEPES", "CERCI", "CERES", "CERIA", 
-    "CERIC", "CERNE", "CEROC", "CEROS", "CERTS", "CESSE", "CESTA", "CESTI", "CETES", 
-    "CHACE", "CHACO", "CHAIS", "CHALS", "CHANA", "CHAPE", "CHAPS", "CHAPT", "CHARA", 
-    "CHARE", "CHARR", "CHARS", "CHATS", "CHEEP", "CHELA", "CHELP", "CHERE", "CHERT", 
-    "CHETH", "CHIAO", "CHIAS", "CHICA", "CHICH", "CHICO", "CHICS", "CHIEL", "CHILE", 
-    "CHINE", "CHINO", "CHINS", "CHIPS", "CHIRL", "CHIRO", "CHIRR", "CHIRT", "CHITS", 
-    "CHOCO", "CHOCS", "CHOIL", "CHOLA", "CHOLI", "CHOLO", "CHONS", "CHOON", "CHOPS", 
-    "CHOTA", "CHOTT", "CIELS", "CILIA", "CILLS", "CINCT", "CINES", "CIONS", "CIPPI", 
-    "CIRCS", "CIRES", "CIRLS", "CIRRI", "CISCO", "CISTS", "CITAL", "CITER", "CITES", 
-    "CLACH", "CLAES", "CLANS", "CLAPS", "CLAPT", "CLARO", "CLART", "CLAST", "CLATS", 
-    "CLEEP", "CLEPE", "CLEPT", "CLIES", "CLINE", "CLINT", "CLIPE", "CLIPS", "CLIPT", 
-    "CLITS", "CLONS", "CLOOP", "CLOOT", "CLOPS", "CLOTE", "CLOTS", "COACT", "COALA", 
-    "COALS", "COAPT", "COATE", "COATI", "COATS", "COCAS", "COCCI", "COCCO", "COCOS", 
-    "COHEN", "COHOE", "COHOS", "COILS", "COINS", "COIRS", "COITS", "COLAS", "COLES", 
-    "COLIC", "COLIN", "COLLS", "COLTS", "CONES", "CONIA", "CONIN", "CONNE", "CONNS", 
-    "CONTE", "CONTO", "COOCH", "COOEE", "COOER", "COOLS", "COONS", "COOPS", "COOPT", 
-    "COOST", "COOTS", "COPAL", "COPEN", "COPER", "COPES", "COPRA", "CORES", "CORIA", 
-    "CORNI", "CORNO", "CORNS", "CORPS", "CORSE", "CORSO", "COSEC", "COSES", "COSET", 
-    "COSIE", "COSTA", "COSTE", "COSTS", "COTAN", "COTES", "COTHS", "COTTA", "COTTS", 
-    "CRAAL", "CRAIC", "CRANS", "CRAPE", "CRAPS", "CRARE", "CREEL", "CREES", "CRENA", 
-    "CREPS", "CRIAS", "CRIES", "CRINE", "CRIOS", "CRIPE", "CRIPS", "CRISE", "CRITH", 
-    "CRITS", "CROCI", "CROCS", "CRONS", "CROOL", "CROON", "CROPS", "CRORE", "CROST", 
-    "CTENE", "EALES", "EARLS", "EARNS", "EARNT", "EARST", "EASER", "EASES", "EASLE", 
-    "EASTS", "EATHE", "ECHES", "ECHOS", "EISEL", "ELAIN", "ELANS", "ELCHI", "ELINT", 
-    "ELOIN", "ELOPS", "ELPEE", "ELSIN", "ENATE", "ENIAC", "ENLIT", "ENOLS", "ENROL", 
-    "ENTIA", "EORLS", "EOSIN", "EPACT", "EPEES", "EPHAH", "EPHAS", "EPHOR", "EPICS", 
-    "EPOPT", "EPRIS", "ERICA", "ERICS", "ERNES", "EROSE", "ERSES", "ESCAR", "ESCOT", 
-    "ESILE", "ESNES", "ESSES", "ESTOC", "ESTOP", "ESTRO", "ETAPE", "ETATS", "ETENS", 
-    "ETHAL", "ETHNE", "ETICS", "ETNAS", "ETTIN", "ETTLE", "HAARS", "HAETS", "HAHAS", 
-    "HAILS", "HAINS", "HAINT", "HAIRS", "HAITH", "HALAL", "HALER", "HALES", "HALLO", 
-    "HALLS", "HALON", "HALOS", "HALSE", "HALTS", "HANAP", "HANCE", "HANCH", "HANSA", 
-    "HANSE", "HANTS", "HAOLE", "HAPPI", "HARES", "HARLS", "HARNS", "HAROS", "HARPS", 
-    "HARTS", "HASPS", "HASTA", "HATES", "HATHA", "HEALS", "HEAPS", "HEARE", "HEARS", 
-    "HEAST", "HEATS", "HECHT", "HEELS", "HEILS", "HEIRS", "HELES", "HELIO", "HELLS", 
-    "HELOS", "HELOT", "HELPS", "HENCH", "HENNA", "HENTS", "HEPAR", "HERES", "HERLS", 
-    "HERNS", "HEROS", "HERSE", "HESPS", "HESTS", "HETES", "HETHS", "HIANT", "HILAR", 
-    "HILCH", "HILLO", "HILLS", "HILTS", "HINTS", "HIOIS", "HIREE", "HIRER", "HIRES", 
-    "HISTS", "HITHE", "HOARS", "HOAST", "HOERS", "HOISE", "HOLES", "HOLLA", "HOLLO", 
-    "HOLON", "HOLOS", "HOLTS", "HONAN", "HONER", "HONES", "HOOCH", "HOONS", "HOOPS", 
-    "HOORS", "HOOSH", "HOOTS", "HOPER", "HOPES", "HORAH", "HORAL", "HORAS", "HORIS", 
-    "HORNS", "HORST", "HOSEL", "HOSEN", "HOSER", "HOSES", "HOSTA", "HOSTS", "HOTCH", 
-    "HOTEN", "ICERS", "ICHES", "ICHOR", "ICIER", "ICONS", "ICTAL", "ICTIC", "ILEAC", 
-    "ILEAL", "ILIAL", "ILLER", "ILLTH", "INAPT", "INCEL", "INCLE", "INION", "INNIT", 
-    "INSET", "INSPO", "INTEL", "INTIL", "INTIS", "INTRA", "IOTAS", "IPPON", "IRONE", 
-    "IRONS", "ISHES", "ISLES", "ISNAE", "ISSEI", "ISTLE", "ITHER", "LAARI", "LACER", 
-    "LACES", "LACET", "LAERS", "LAHAL", "LAHAR", "LAICH", "LAICS", "LAIRS", "LAITH", 
-    "LALLS", "LANAI", "LANAS", "LANCH", "LANES", "LANTS", "LAPIN", "LAPIS", "LARCH", 
-    "LAREE", "LARES", "LARIS", "LARNS", "LARNT", "LASER", "LASES", "LASSI", "LASTS", 
-    "LATAH", "LATEN", "LATHI", "LATHS", "LEANS", "LEAPS", "LEARE", "LEARS", "LEATS", 
-    "LEEAR", "LEEPS", "LEERS", "LEESE", "LEETS", "LEHRS", "LEIRS", "LEISH", "LENES", 
-    "LENIS", "LENOS", "LENSE", "LENTI", "LENTO", "LEONE", "LEPRA", "LEPTA", "LERES", 
-    "LERPS", "LESES", "LESTS", "LETCH", "LETHE", "LIANA", "LIANE", "LIARS", "LIART", 
-    "LICHI", "LICHT", "LICIT", "LIENS", "LIERS", "LILLS", "LILOS", "LILTS", "LINAC", 
-    "LINCH", "LINES", "LININ", "LINNS", "LINOS", "LINTS", "LIONS", "LIPAS", "LIPES", 
-    "LIPIN", "LIPOS", "LIRAS", "LIROT", "LISLE", "LISPS", "LISTS", "LITAI", "LITAS", 
-    "LITES", "LITHO", "LITHS", "LITRE", "LLANO", "LOACH", "LOANS", "LOAST", "LOCHE", 
-    "LOCHS", "LOCIE", "LOCIS", "LOCOS", "LOESS", "LOHAN", "LOINS", "LOIPE", "LOIRS", 
-    "LOLLS", "LONER", "LOOIE", "LOONS", "LOOPS", "LOOTS", "LOPER", "LOPES", "LORAL", 
-    "LORAN", "LOREL", "LORES", "LORIC", "LORIS", "LOSEL", "LOSEN", "LOSES", "LOTAH", 
-    "LOTAS", "LOTES", "LOTIC", "LOTOS", "LOTSA", "LOTTA", "LOTTE", "LOTTO", "NAANS", 
-    "NACHE", "NACHO", "NACRE", "NAHAL", "NAILS", "NAIRA", "NALAS", "NALLA", "NANAS", 
-    "NANCE", "NANNA", "NANOS", "NAPAS", "NAPES", "NAPOO", "NAPPA", "NAPPE", "NARAS", 
-    "NARCO", "NARCS", "NARES", "NARIC", "NARIS", "NARRE", "NASHI", "NATCH", "NATES", 
-    "NATIS", "NEALS", "NEAPS", "NEARS", "NEATH", "NEATS", "NEELE", "NEEPS", "NEESE", 
-    "NEIST", "NELIS", "NENES", "NEONS", "NEPER", "NEPIT", "NERAL", "NEROL", "NERTS", 
-    "NESTS", "NETES", "NETOP", "NETTS", "NICHT", "NICOL", "NIHIL", "NILLS", "NINER", 
-    "NINES", "NINON", "NIPAS", "NIRLS", "NISEI", "NISSE", "NITER", "NITES", "NITON", 
-    "NITRE", "NITRO", "NOAHS", "NOELS", "NOILS", "NOINT", "NOIRS", "NOLES", "NOLLS", 
-    "NOLOS", "NONAS", "NONCE", "NONES", "NONET", "NONIS", "NOOIT", "NOONS", "NOOPS", 
-    "NOPAL", "NORIA", "NORIS", "NOSER", "NOSES", "NOTAL", "NOTER", "NOTES", "OASES", 
-    "OASIS", "OASTS", "OATEN", "OATER", "OATHS", "OCHER", "OCHES", "OCHRE", "OCREA", 
-    "OCTAN", "OCTAS", "OHIAS", "OHONE", "OILER", "OINTS", "OLEIC", "OLEIN", "OLENT", 
-    "OLEOS", "OLIOS", "OLLAS", "OLLER", "OLLIE", "OLPAE", "OLPES", "ONCER", "ONCES", 
-    "ONCET", "ONERS", "ONTIC", "OONTS", "OORIE", "OOSES", "OPAHS", "OPALS", "OPENS", 
-    "OPEPE", "OPPOS", "OPSIN", "OPTER", "ORACH", "ORALS", "ORANT", "ORATE", "ORCAS", 
-    "ORCIN", "ORIEL", "ORLES", "ORLON", "ORLOP", "ORNIS", "ORPIN", "ORRIS", "ORTHO", 
-    "OSCAR", "OSHAC", "OSIER", "OSSIA", "OSTIA", "OTTAR", "OTTOS", "PAALS", "PAANS", 
-    "PACAS", "PACER", "PACES", "PACHA", "PACOS", "PACTA", "PACTS", "PAEAN", "PAEON", 
-    "PAILS", "PAINS", "PAIRE", "PAIRS", "PAISA", "PAISE", "PALAS", "PALEA", "PALES", 
-    "PALET", "PALIS", "PALLA", "PALLS", "PALPI", "PALPS", "PALSA", "PANCE", "PANES", 
-    "PANNE", "PANNI", "PANTO", "PANTS", "PAOLI", "PAOLO", "PAPAS", "PAPES", "PAPPI", 
-    "PARAE", "PARAS", "PARCH", "PAREN", "PAREO", "PARES", "PARIS", "PARLE", "PAROL", 
-    "PARPS", "PARRA", "PARRS", "PARTI", "PARTS", "PASEO", "PASES", "PASHA", "PASSE", 
-    "PASTS", "PATEN", "PATER", "PATES", "PATHS", "PATIN", "PATTE", "PEALS", "PEANS", 
-    "PEARE", "PEARS", "PEART", "PEASE", "PEATS", "PECHS", "PEECE", "PEELS", "PEENS", 
-    "PEEPE", "PEEPS", "PEERS", "PEINS", "PEISE", "PELAS", "PELES", "PELLS", "PELON", 
-    "PELTA", "PELTS", "PENES", "PENIE", "PENIS", "PENNA", "PENNI", "PENTS", "PEONS", 
-    "PEPLA", "PEPOS", "PEPSI", "PERAI", "PERCE", "PERCS", "PEREA", "PERES", "PERIS", 
-    "PERNS", "PERPS", "PERSE", "PERST", "PERTS", "PESOS", "PESTS", "PETAR", "PETER", 
-    "PETIT", "PETRE", "PETRI", "PETTI", "PETTO", "PHARE", "PHEER", "PHENE", "PHEON", 
-    "PHESE", "PHIAL", "PHISH", "PHOCA", "PHONO", "PHONS", "PHOTS", "PHPHT", "PIANI", 
-    "PIANS", "PICAL", "PICAS", "PICOT", "PICRA", "PIERS", "PIERT", "PIETA", "PIETS", 
-    "PILAE", "PILAO", "PILAR", "PILCH", "PILEA", "PILEI", "PILER", "PILES", "PILIS", 
-    "PILLS", "PINAS", "PINES", "PINNA", "PINON", "PINOT", "PINTA", "PINTS", "PIONS", 
-    "PIPAL", "PIPAS", "PIPES", "PIPET", "PIPIS", "PIPIT", "PIRAI", "PIRLS", "PIRNS", 
-    "PISCO", "PISES", "PISOS", "PISTE", "PITAS", "PITHS", "PITON", "PITOT", "PITTA", 
-    "PLAAS", "PLANS", "PLAPS", "PLASH", "PLAST", "PLATS", "PLATT", "PLEAS", "PLENA", 
-    "PLEON", "PLESH", "PLICA", "PLIES", "PLOAT", "PLOPS", "PLOTS", "POACH", "POEPS", 
-    "POETS", "POLER", "POLES", "POLIO", "POLIS", "POLLS", "POLOS", "POLTS", "PONCE", 
-    "PONES", "PONTS", "POOHS", "POOLS", "POONS", "POOPS", "POORI", "POORT", "POOTS", 
-    "POPES", "POPPA", "PORAE", "PORAL", "PORER", "PORES", "PORIN", "PORNO", "PORNS", 
-    "PORTA", "PORTS", "POSES", "POSHO", "POSTS", "POTAE", "POTCH", "POTES", "POTIN", 
-    "POTOO", "POTTO", "POTTS", "PRANA", "PRAOS", "PRASE", "PRATE", "PRATS", "PRATT", 
-    "PREES", "PRENT", "PREON", "PREOP", "PREPS", "PRESA", "PRESE", "PREST", "PRIAL", 
-    "PRIER", "PRIES", "PRILL", "PRION", "PRISE", "PRISS", "PROAS", "PROIN", "PROLE", 
-    "PROLL", "PROPS", "PRORE", "PROSO", "PROSS", "PROST", "PROTO", "PSION", "PSOAE", 
-    "PSOAI", "PSOAS", "PSORA", "RACES", "RACHE", "RACON", "RAIAS", "RAILE", "RAILS", 
-    "RAINE", "RAINS", "RAITA", "RAITS", "RALES", "RANAS", "RANCE", "RANEE", "RANIS", 
-    "RANTS", "RAPER", "RAPES", "RAPHE", "RAPPE", "RAREE", "RARES", "RASER", "RASES", 
-    "RASPS", "RASSE", "RASTA", "RATAL", "RATAN", "RATAS", "RATCH", "RATEL", "RATER", 
-    "RATES", "RATHA", "RATHE", "RATHS", "RATOO", "RATOS", "REAIS", "REALO", "REALS", 
-    "REANS", "REAPS", "REARS", "REAST", "REATA", "REATE", "RECAL", "RECCE", "RECCO", 
-    "RECIT", "RECON", "RECTA", "RECTI", "RECTO", "REECH", "REELS", "REENS", "REEST", 
-    "REINS", "REIST", "RELET", "RELIE", "RELIT", "RELLO", "RENIN", "RENNE", "RENOS", 
-    "RENTE", "RENTS", "REOIL", "REPIN", "REPLA", "REPOS", "REPOT", "REPPS", "REPRO", 
-    "RERAN", "RESAT", "RESEE", "RESES", "RESIT", "RESTO", "RESTS", "RETIA", "RETIE", 
-    "RHEAS", "RHIES", "RHINE", "RHONE", "RIALS", "RIANT", "RIATA", "RICER", "RICES", 
-    "RICHT", "RICIN", "RIELS", "RILES", "RILLE", "RILLS", "RINES", "RIOTS", "RIPES", 
-    "RIPPS", "RISES", "RISHI", "RISPS", "RITES", "RITTS", "ROANS", "ROARS", "ROATE", 
-    "ROHES", "ROILS", "ROINS", "ROIST", "ROLES", "ROLLS", "RONEO", "RONES", "RONIN", 
-    "RONNE", "RONTE", "RONTS", "ROONS", "ROOPS", "ROOSA", "ROOSE", "ROOTS", "ROPER", 
-    "ROPES", "RORAL", "RORES", "RORIC", "RORIE", "RORTS", "ROSES", "ROSET", "ROSHI", 
-    "ROSIN", "ROSIT", "ROSTI", "ROSTS", "ROTAL", "ROTAN", "ROTAS", "ROTCH", "ROTES", 
-    "ROTIS", "ROTLS", "ROTON", "ROTOS", "ROTTE", "SACRA", "SAICE", "SAICS", "SAILS", 
-    "SAINE", "SAINS", "SAIRS", "SAIST", "SAITH", "SALAL", "SALAT", "SALEP", "SALES", 
-    "SALET", "SALIC", "SALLE", "SALOL", "SALOP", "SALPA", "SALPS", "SALSE", "SALTO", 
-    "SALTS", "SANES", "SANSA", "SANTO", "SANTS", "SAOLA", "SAPAN", "SAPOR", "SARAN", 
-    "SAREE", "SARIN", "SARIS", "SAROS", "SASER", "SASIN", "SASSE", "SATAI", "SATES", 
-    "SATIS", "SCAIL", "SCALA", "SCALL", "SCANS", "SCAPA", "SCAPE", "SCAPI", "SCARP", 
-    "SCARS", "SCART", "SCATH", "SCATS", "SCATT", "SCEAT", "SCENA", "SCOOT", "SCOPA", 
-    "SCOPS", "SCOTS", "SCRAE", "SCRAN", "SCRAT", "SCRIP", "SEALS", "SEANS", "SEARE", 
-    "SEARS", "SEASE", "SEATS", "SECCO", "SECHS", "SECTS", "SEELS", "SEEPS", "SEERS", 
-    "SEHRI", "SEILS", "SEINE", "SEIRS", "SEISE", "SELAH", "SELES", "SELLA", "SELLE", 
-    "SELLS", "SENAS", "SENES", "SENNA", "SENOR", "SENSA", "SENSI", "SENTE", "SENTI", 
-    "SENTS", "SEPAL", "SEPIC", "SEPTA", "SEPTS", "SERAC", "SERAI", "SERAL", "SERER", 
-    "SERES", "SERIC", "SERIN", "SERON", "SERRA", "SERRE", "SERRS", "SESSA", "SETAE", 
-    "SETAL", "SETON", "SETTS", "SHAHS", "SHANS", "SHAPS", "SHARN", "SHASH", "SHCHI", 
-    "SHEAL", "SHEAS", "SHEEL", "SHENT", "SHEOL", "SHERE", "SHERO", "SHETS", "SHIAI", 
-    "SHIEL", "SHIER", "SHIES", "SHILL", "SHINS", "SHIPS", "SHIRR", "SHIRS", "SHISH", 
-    "SHISO", "SHIST", "SHITE", "SHITS", "SHLEP", "SHOAT", "SHOER", "SHOES", "SHOLA", 
-    "SHOOL", "SHOON", "SHOOS", "SHOPE", "SHOPS", "SHORL", "SHOTE", "SHOTS", "SHOTT", 
-    "SHRIS", "SIALS", "SICES", "SICHT", "SIENS", "SIENT", "SIETH", "SILEN", "SILER", 
-    "SILES", "SILLS", "SILOS", "SILTS", "SINES", "SINHS", "SIPES", "SIREE", "SIRES", 
-    "SIRIH", "SIRIS", "SIROC", "SIRRA", "SISAL", "SISES", "SISTA", "SISTS", "SITAR", 
-    "SITES", "SITHE", "SLAES", "SLANE", "SLAPS", "SLART", "SLATS", "SLEER", "SLIER", 
-    "SLIPE", "SLIPS", "SLIPT", "SLISH", "SLITS", "SLOAN", "SLOES", "SLOOT", "SLOPS", 
-    "SLOTS", "SNAPS", "SNARS", "SNASH", "SNATH", "SNEAP", "SNEES", "SNELL", "SNIES", 
-    "SNIPS", "SNIRT", "SNITS", "SNOEP", "SNOOL", "SNOOT", "SNOTS", "SOAPS", "SOARE", 
-    "SOARS", "SOCAS", "SOCES", "SOCLE", "SOILS", "SOLAH", "SOLAN", "SOLAS", "SOLEI", 
-    "SOLER", "SOLES", "SOLON", "SOLOS", "SONCE", "SONES", "SONNE", "SONSE", "SOOLE", 
-    "SOOLS", "SOOPS", "SOOTE", "SOOTS", "SOPHS", "SOPOR", "SOPRA", "SORAL", "SORAS", 
-    "SOREE", "SOREL", "SORER", "SORES", "SORNS", "SORRA", "SORTA", "SORTS", "SOTHS", 
-    "SOTOL", "SPAER", "SPAES", "SPAHI", "SPAIL", "SPAIN", "SPAIT", "SPALE", "SPALL", 
-    "SPALT", "SPANE", "SPANS", "SPARS", "SPART", "SPATE", "SPATS", "SPEAL", "SPEAN", 
-    "SPEAT", "SPECS", "SPECT", "SPEEL", "SPEER", "SPEIL", "SPEIR", "SPEOS", "SPETS", 
-    "SPIAL", "SPICA", "SPICS", "SPIER", "SPIES", "SPILE", "SPINA", "SPINS", "SPIRT", 
-    "SPITS", "SPOOR", "SPOOT", "SPOSH", "SPOTS", "SPRAT", "SPRIT", "STANE", "STAPH", 
-    "STAPS", "STARN", "STARR", "STARS", "STATS", "STEAN", "STEAR", "STEEN", "STEIL", 
-    "STELA", "STELE", "STELL", "STENO", "STENS", "STENT", "STEPS", "STEPT", "STERE", 
-    "STETS", "STICH", "STIES", "STILE", "STIPA", "STIPE", "STIRE", "STIRP", "STIRS", 
-    "STOAE", "STOAI", "STOAS", "STOAT", "STOEP", "STOIT", "STOLN", "STONN", "STOOR", 
-    "STOPE", "STOPS", "STOPT", "STOSS", "STOTS", "STOTT", "STRAE", "STREP", "STRIA", 
-    "STROP", "TAALS", "TAATA", "TACAN", "TACES", "TACET", "TACHE", "TACHO", "TACHS", 
-    "TACOS", "TACTS", "TAELS", "TAHAS", "TAHRS", "TAILS", "TAINS", "TAIRA", "TAISH", 
-    "TAITS", "TALAR", "TALAS", "TALCS", "TALEA", "TALER", "TALES", "TALLS", "TALPA", 
-    "TANAS", "TANHS", "TANNA", "TANTI", "TANTO", "TAPAS", "TAPEN", "TAPES", "TAPET", 
-    "TAPIS", "TAPPA", "TARAS", "TARES", "TARNS", "TAROC", "TAROS", "TARPS", "TARRE", 
-    "TARSI", "TARTS", "TASAR", "TASER", "TASES", "TASSA", "TASSE", "TASSO", "TATAR", 
-    "TATER", "TATES", "TATHS", "TATIE", "TATTS", "TEALS", "TEARS", "TEATS", "TECHS", 
-    "TECTA", "TEELS", "TEENE", "TEENS", "TEERS", "TEHRS", "TEILS", "TEINS", "TELAE", 
-    "TELCO", "TELES", "TELIA", "TELIC", "TELLS", "TELOI", "TELOS", "TENCH", "TENES", 
-    "TENIA", "TENNE", "TENNO", "TENON", "TENTS", "TEPAL", "TEPAS", "TERAI", "TERAS", 
-    "TERCE", "TERES", "TERNE", "TERNS", "TERTS", "TESLA", "TESTA", "TESTE", "TESTS", 
-    "TETES", "TETHS", "TETRA", "TETRI", "THALE", "THALI", "THANA", "THANE", "THANS", 
-    "THARS", "THECA", "THEES", "THEIC", "THEIN", "THENS", "THESP", "THETE", "THILL", 
-    "THINE", "THINS", "THIOL", "THIRL", "THOLE", "THOLI", "THORO", "THORP", "THRAE", 
-    "THRIP", "THROE", "TIANS", "TIARS", "TICAL", "TICCA", "TICES", "TIERS", "TILER", 
-    "TILES", "TILLS", "TILTH", "TILTS", "TINAS", "TINCT", "TINEA", "TINES", "TINTS", 
-    "TIPIS", "TIRES", "TIRLS", "TIROS", "TIRRS", "TITCH", "TITER", "TITIS", "TITRE", 
-    "TOCOS", "TOEAS", "TOHOS", "TOILE", "TOILS", "TOISE", "TOITS", "TOLAN", "TOLAR", 
-    "TOLAS", "TOLES", "TOLLS", "TOLTS", "TONER", "TONES", "TONNE", "TOOLS", "TOONS", 
-    "TOOTS", "TOPEE", "TOPER", "TOPES", "TOPHE", "TOPHI", "TOPHS", "TOPIS", "TOPOI", 
-    "TOPOS", "TORAH", "TORAN", "TORAS", "TORCS", "TORES", "TORIC", "TORII", "TOROS", 
-    "TOROT", "TORRS", "TORSE", "TORSI", "TORTA", "TORTE", "TORTS", "TOSAS", "TOSES", 
-    "TOTER", "TOTES", "TRANS", "TRANT", "TRAPE", "TRAPS", "TRAPT", "TRASS", "TRATS", 
-    "TRATT", "TREEN", "TREES", "TRESS", "TREST", "TRETS", "TRIAC", "TRIER", "TRIES", 
-    "TRILL", "TRINE", "TRINS", "TRIOL", "TRIOR", "TRIOS", "TRIPS", "TRIST", "TROAT", 
-    "TROIS", "TRONA", "TRONC", "TRONE", "TRONS", "TROTH", "TROTS", "TSARS", 
-#endif
+// Every word that's accepted as a guess: the words above, and words that'll never be used as answers, sorted by code.
+// Number of words found: 2330
+static const uint8_t _dict_words[] = {
+    0x00, 0x54, 0x40, 0x09, 0xB4, 0x01, 0x04, 0xA0, 0x10, 0x94,  // AALII AARTI ACAIS ACARI
+    0x01, 0x10, 0xA0, 0x12, 0x9A, 0x01, 0x2B, 0x00, 0x13, 0x09,  // ACCAS ACERS ACETA ACHAR
+    0x01, 0x32, 0xA0, 0x13, 0x77, 0x01, 0x46, 0x40, 0x16, 0x2A,  // ACHES ACHOO ACINI ACNES
+    0x01, 0x79, 0x60, 0x19, 0x2A, 0x01, 0x97, 0xA0, 0x1B, 0x46,  // ACORN ACRES ACROS ACTIN
+    0x01, 0xB7, 0x60, 0x1B, 0x79, 0x02, 0x14, 0x00, 0x27, 0x6A,  // ACTON ACTOR AECIA AEONS
+    0x02, 0x94, 0x20, 0x29, 0x7A, 0x02, 0xA4, 0x90, 0x32, 0x08,  // AERIE AEROS AESIR AHEAP
+    0x03, 0x26, 0xB0, 0x34, 0x6B, 0x04, 0x62, 0x20, 0x47, 0x54,  // AHENT AHINT AINEE AIOLI
+    0x04, 0x92, 0x90, 0x49, 0x6A, 0x04, 0x9B, 0x30, 0x49, 0xBA,  // AIRER AIRNS AIRTH AIRTS
+    0x04, 0xA5, 0x20, 0x4B, 0x13, 0x05, 0x00, 0x80, 0x50, 0x62,  // AISLE AITCH ALAAP ALANE
+    0x05, 0x06, 0xA0, 0x50, 0x6B, 0x05, 0x08, 0x00, 0x50, 0x8A,  // ALANS ALANT ALAPA ALAPS
+    0x05, 0x0B, 0x20, 0x51, 0x7A, 0x05, 0x21, 0xA0, 0x52, 0x83,  // ALATE ALCOS ALECS ALEPH
+    0x05, 0x29, 0xB0, 0x54, 0x0A, 0x05, 0x42, 0x60, 0x54, 0x62,  // ALERT ALIAS ALIEN ALINE
+    0x05, 0x4A, 0xB0, 0x55, 0x22, 0x05, 0x52, 0x50, 0x55, 0x4A,  // ALIST ALLEE ALLEL ALLIS
+    0x05, 0x57, 0xB0, 0x57, 0x2A, 0x05, 0x73, 0x00, 0x57, 0x46,  // ALLOT ALOES ALOHA ALOIN
+    0x05, 0x76, 0x20, 0x57, 0x7A, 0x05, 0x83, 0x00, 0x5B, 0x09,  // ALONE ALOOS ALPHA ALTAR
+    0x05, 0xB2, 0x90, 0x5B, 0x37, 0x05, 0xB7, 0xA0, 0x60, 0x60,  // ALTER ALTHO ALTOS ANANA
+    0x06, 0x0B, 0x00, 0x61, 0x37, 0x06, 0x15, 0x20, 0x61, 0x76,  // ANATA ANCHO ANCLE ANCON
+    0x06, 0x20, 0x90, 0x62, 0x52, 0x06, 0x26, 0xB0, 0x64, 0x52,  // ANEAR ANELE ANENT ANILE
+    0x06, 0x45, 0xA0, 0x64, 0x76, 0x06, 0x4A, 0x20, 0x65, 0x0A,  // ANILS ANION ANISE ANLAS
+    0x06, 0x60, 0x50, 0x66, 0x0A, 0x06, 0x60, 0xB0, 0x67, 0x0A,  // ANNAL ANNAS ANNAT ANOAS
+    0x06, 0x75, 0x20, 0x6A, 0x02, 0x06, 0xB0, 0x20, 0x6B, 0x09,  // ANOLE ANSAE ANTAE ANTAR
+    0x06, 0xB0, 0xA0, 0x6B, 0x2A, 0x06, 0xB4, 0x10, 0x6B, 0x4A,  // ANTAS ANTES ANTIC ANTIS
+    0x06, 0xB9, 0x00, 0x6B, 0x92, 0x07, 0x9B, 0x00, 0x80, 0x12,  // ANTRA ANTRE AORTA APACE
+    0x08, 0x09, 0xB0, 0x82, 0x9A, 0x08, 0x29, 0xB0, 0x83, 0x4A,  // APART APERS APERT APHIS
+    0x08, 0x40, 0x60, 0x84, 0x75, 0x08, 0x4A, 0x30, 0x86, 0x20,  // APIAN APIOL APISH APNEA
+    0x08, 0x77, 0x80, 0x87, 0x9B, 0x08, 0x80, 0x50, 0x88, 0x25,  // APOOP APORT APPAL APPEL
+    0x08, 0x85, 0x20, 0x88, 0x97, 0x08, 0x92, 0xA0, 0x89, 0x76,  // APPLE APPRO APRES APRON
+    0x08, 0xA2, 0xA0, 0x8A, 0x4A, 0x08, 0xA7, 0xA0, 0x8B, 0x29,  // APSES APSIS APSOS APTER
+    0x09, 0x09, 0xA0, 0x91, 0x34, 0x09, 0x17, 0xA0, 0x92, 0x02,  // ARARS ARCHI ARCOS AREAE
+    0x09, 0x20, 0x50, 0x92, 0x09, 0x09, 0x20, 0xA0, 0x92, 0x10,  // AREAL AREAR AREAS ARECA
+    0x09, 0x24, 0x10, 0x92, 0x60, 0x09, 0x26, 0x20, 0x92, 0x80,  // AREIC ARENA ARENE AREPA
+    0x09, 0x29, 0x20, 0x92, 0xB2, 0x09, 0x2B, 0xA0, 0x92, 0xBB,  // ARERE ARETE ARETS ARETT
+    0x09, 0x30, 0xB0, 0x94, 0x0A, 0x09, 0x42, 0x50, 0x94, 0x5A,  // ARHAT ARIAS ARIEL ARILS
+    0x09, 0x47, 0xB0, 0x94, 0xA2, 0x09, 0x4A, 0x30, 0x95, 0x2A,  // ARIOT ARISE ARISH ARLES
+    0x09, 0x60, 0xA0, 0x97, 0x30, 0x09, 0x7A, 0x20, 0x98, 0x0A,  // ARNAS AROHA AROSE ARPAS
+    0x09, 0x82, 0x60, 0x99, 0x03, 0x09, 0x90, 0xA0, 0x99, 0x2B,  // ARPEN ARRAH ARRAS ARRET
+    0x09, 0x94, 0xA0, 0x9A, 0x2A, 0x09, 0xA4, 0xA0, 0x9A, 0x76,  // ARRIS ARSES ARSIS ARSON
+    0x09, 0xB0, 0x50, 0x9B, 0x25, 0x09, 0xB4, 0x10, 0x9B, 0x4A,  // ARTAL ARTEL ARTIC ARTIS
+    0x0A, 0x06, 0x00, 0xA1, 0x76, 0x0A, 0x17, 0xB0, 0xA3, 0x26,  // ASANA ASCON ASCOT ASHEN
+    0x0A, 0x32, 0xA0, 0xA3, 0x2B, 0x0A, 0x82, 0x60, 0xA8, 0x29,  // ASHES ASHET ASPEN ASPER
+    0x0A, 0x84, 0x10, 0xA8, 0x42, 0x0A, 0x84, 0xA0, 0xA8, 0x97,  // ASPIC ASPIE ASPIS ASPRO
+    0x0A, 0xA0, 0x40, 0xAA, 0x2A, 0x0A, 0xA2, 0xB0, 0xAA, 0x7B,  // ASSAI ASSES ASSET ASSOT
+    0x0A, 0xB2, 0x90, 0xAB, 0x49, 0x0B, 0x08, 0xA0, 0xB4, 0x5B,  // ASTER ASTIR ATAPS ATILT
+    0x0B, 0x50, 0xA0, 0xB7, 0x1A, 0x0B, 0x75, 0x50, 0xB7, 0x62,  // ATLAS ATOCS ATOLL ATONE
+    0x0B, 0x94, 0x00, 0xB9, 0x48, 0x0B, 0xB0, 0x80, 0xBB, 0x09,  // ATRIA ATRIP ATTAP ATTAR
+    0x0B, 0xB4, 0x11, 0x01, 0x07, 0x10, 0x10, 0xA1, 0x01, 0x32,  // ATTIC CACAO CACAS CACHE
+    0x10, 0x1B, 0x41, 0x02, 0x10, 0x10, 0x2A, 0x21, 0x04, 0x6A,  // CACTI CAECA CAESE CAINS
+    0x10, 0x49, 0x61, 0x05, 0x50, 0x10, 0x55, 0xA1, 0x05, 0x7A,  // CAIRN CALLA CALLS CALOS
+    0x10, 0x58, 0x01, 0x05, 0x8A, 0x10, 0x60, 0x51, 0x06, 0x23,  // CALPA CALPS CANAL CANEH
+    0x10, 0x62, 0x91, 0x06, 0x2A, 0x10, 0x66, 0x01, 0x06, 0x6A,  // CANER CANES CANNA CANNS
+    0x10, 0x67, 0x21, 0x06, 0x76, 0x10, 0x6A, 0x71, 0x06, 0xAB,  // CANOE CANON CANSO CANST
+    0x10, 0x6B, 0x71, 0x06, 0xBA, 0x10, 0x80, 0xA1, 0x08, 0x29,  // CANTO CANTS CAPAS CAPER
+    0x10, 0x82, 0xA1, 0x08, 0x3A, 0x10, 0x85, 0x21, 0x08, 0x76,  // CAPES CAPHS CAPLE CAPON
+    0x10, 0x87, 0xA1, 0x08, 0x7B, 0x10, 0x89, 0x41, 0x09, 0x08,  // CAPOS CAPOT CAPRI CARAP
+    0x10, 0x90, 0xB1, 0x09, 0x29, 0x10, 0x92, 0xA1, 0x09, 0x2B,  // CARAT CARER CARES CARET
+    0x10, 0x95, 0x21, 0x09, 0x5A, 0x10, 0x96, 0xA1, 0x09, 0x75,  // CARLE CARLS CARNS CAROL
+    0x10, 0x97, 0x61, 0x09, 0x84, 0x10, 0x98, 0xA1, 0x09, 0x9A,  // CARON CARPI CARPS CARRS
+    0x10, 0x9A, 0x21, 0x09, 0xB0, 0x10, 0x9B, 0x21, 0x09, 0xBA,  // CARSE CARTA CARTE CARTS
+    0x10, 0xA0, 0xA1, 0x0A, 0x17, 0x10, 0xA2, 0xA1, 0x0A, 0xB2,  // CASAS CASCO CASES CASTE
+    0x10, 0xAB, 0xA1, 0x0B, 0x13, 0x10, 0xB2, 0x91, 0x0B, 0x2A,  // CASTS CATCH CATER CATES
+    0x12, 0x0A, 0x21, 0x21, 0x05, 0x12, 0x45, 0x41, 0x24, 0x5A,  // CEASE CECAL CEILI CEILS
+    0x12, 0x55, 0x01, 0x25, 0x54, 0x12, 0x55, 0x71, 0x25, 0x5A,  // CELLA CELLI CELLO CELLS
+    0x12, 0x5B, 0xA1, 0x26, 0xA2, 0x12, 0x6B, 0x71, 0x26, 0xBA,  // CELTS CENSE CENTO CENTS
+    0x12, 0x79, 0x51, 0x28, 0x2A, 0x12, 0x91, 0x41, 0x29, 0x2A,  // CEORL CEPES CERCI CERES
+    0x12, 0x94, 0x01, 0x29, 0x41, 0x12, 0x96, 0x21, 0x29, 0x71,  // CERIA CERIC CERNE CEROC
+    0x12, 0x97, 0xA1, 0x29, 0xBA, 0x12, 0xAA, 0x21, 0x2A, 0xB0,  // CEROS CERTS CESSE CESTA
+    0x12, 0xAB, 0x41, 0x2B, 0x2A, 0x13, 0x01, 0x21, 0x30, 0x17,  // CESTI CETES CHACE CHACO
+    0x13, 0x04, 0x61, 0x30, 0x49, 0x13, 0x04, 0xA1, 0x30, 0x5A,  // CHAIN CHAIR CHAIS CHALS
+    0x13, 0x06, 0x01, 0x30, 0x6B, 0x13, 0x07, 0xA1, 0x30, 0x82,  // CHANA CHANT CHAOS CHAPE
+    0x13, 0x08, 0xA1, 0x30, 0x8B, 0x13, 0x09, 0x01, 0x30, 0x92,  // CHAPS CHAPT CHARA CHARE
+    0x13, 0x09, 0x91, 0x30, 0x9A, 0x13, 0x09, 0xB1, 0x30, 0xA2,  // CHARR CHARS CHART CHASE
+    0x13, 0x0B, 0xA1, 0x32, 0x08, 0x13, 0x20, 0xB1, 0x32, 0x28,  // CHATS CHEAP CHEAT CHEEP
+    0x13, 0x22, 0x91, 0x32, 0x50, 0x13, 0x25, 0x81, 0x32, 0x92,  // CHEER CHELA CHELP CHERE
+    0x13, 0x29, 0xB1, 0x32, 0xAA, 0x13, 0x2A, 0xB1, 0x32, 0xB3,  // CHERT CHESS CHEST CHETH
+    0x13, 0x40, 0x71, 0x34, 0x0A, 0x13, 0x41, 0x01, 0x34, 0x13,  // CHIAO CHIAS CHICA CHICH
+    0x13, 0x41, 0x71, 0x34, 0x1A, 0x13, 0x42, 0x51, 0x34, 0x52,  // CHICO CHICS CHIEL CHILE
+    0x13, 0x45, 0x41, 0x34, 0x55, 0x13, 0x46, 0x01, 0x34, 0x62,  // CHILI CHILL CHINA CHINE
+    0x13, 0x46, 0x71, 0x34, 0x6A, 0x13, 0x48, 0xA1, 0x34, 0x95,  // CHINO CHINS CHIPS CHIRL
+    0x13, 0x49, 0x71, 0x34, 0x98, 0x13, 0x49, 0x91, 0x34, 0x9B,  // CHIRO CHIRP CHIRR CHIRT
+    0x13, 0x4B, 0xA1, 0x37, 0x17, 0x13, 0x71, 0xA1, 0x37, 0x45,  // CHITS CHOCO CHOCS CHOIL
+    0x13, 0x74, 0x91, 0x37, 0x50, 0x13, 0x75, 0x41, 0x37, 0x57,  // CHOIR CHOLA CHOLI CHOLO
+    0x13, 0x76, 0xA1, 0x37, 0x76, 0x13, 0x78, 0xA1, 0x37, 0x92,  // CHONS CHOON CHOPS CHORE
+    0x13, 0x7A, 0x21, 0x37, 0xB0, 0x13, 0x7B, 0xB1, 0x42, 0x5A,  // CHOSE CHOTA CHOTT CIELS
+    0x14, 0x54, 0x01, 0x45, 0x5A, 0x14, 0x61, 0x31, 0x46, 0x1B,  // CILIA CILLS CINCH CINCT
+    0x14, 0x62, 0xA1, 0x47, 0x6A, 0x14, 0x88, 0x41, 0x49, 0x10,  // CINES CIONS CIPPI CIRCA
+    0x14, 0x91, 0xA1, 0x49, 0x2A, 0x14, 0x95, 0xA1, 0x49, 0x94,  // CIRCS CIRES CIRLS CIRRI
+    0x14, 0xA1, 0x71, 0x4A, 0xBA, 0x14, 0xB0, 0x51, 0x4B, 0x29,  // CISCO CISTS CITAL CITER
+    0x14, 0xB2, 0xA1, 0x50, 0x13, 0x15, 0x02, 0xA1, 0x50, 0x6A,  // CITES CLACH CLAES CLANS
+    0x15, 0x08, 0xA1, 0x50, 0x8B, 0x15, 0x09, 0x71, 0x50, 0x9B,  // CLAPS CLAPT CLARO CLART
+    0x15, 0x0A, 0x31, 0x50, 0xA8, 0x15, 0x0A, 0xA1, 0x50, 0xAB,  // CLASH CLASP CLASS CLAST
+    0x15, 0x0B, 0xA1, 0x52, 0x06, 0x15, 0x20, 0x91, 0x52, 0x0B,  // CLATS CLEAN CLEAR CLEAT
+    0x15, 0x22, 0x81, 0x52, 0x82, 0x15, 0x28, 0xB1, 0x54, 0x2A,  // CLEEP CLEPE CLEPT CLIES
+    0x15, 0x46, 0x21, 0x54, 0x6B, 0x15, 0x48, 0x21, 0x54, 0x8A,  // CLINE CLINT CLIPE CLIPS
+    0x15, 0x48, 0xB1, 0x54, 0xBA, 0x15, 0x76, 0x21, 0x57, 0x6A,  // CLIPT CLITS CLONE CLONS
+    0x15, 0x77, 0x81, 0x57, 0x7B, 0x15, 0x78, 0xA1, 0x57, 0xA2,  // CLOOP CLOOT CLOPS CLOSE
+    0x15, 0x7B, 0x21, 0x57, 0xB3, 0x15, 0x7B, 0xA1, 0x70, 0x13,  // CLOTE CLOTH CLOTS COACH
+    0x17, 0x01, 0xB1, 0x70, 0x50, 0x17, 0x05, 0xA1, 0x70, 0x8B,  // COACT COALA COALS COAPT
+    0x17, 0x0A, 0xB1, 0x70, 0xB2, 0x17, 0x0B, 0x41, 0x70, 0xBA,  // COAST COATE COATI COATS
+    0x17, 0x10, 0xA1, 0x71, 0x14, 0x17, 0x11, 0x71, 0x71, 0x70,  // COCAS COCCI COCCO COCOA
+    0x17, 0x17, 0xA1, 0x73, 0x26, 0x17, 0x37, 0x21, 0x73, 0x7A,  // COCOS COHEN COHOE COHOS
+    0x17, 0x45, 0xA1, 0x74, 0x6A, 0x17, 0x49, 0xA1, 0x74, 0xBA,  // COILS COINS COIRS COITS
+    0x17, 0x50, 0xA1, 0x75, 0x2A, 0x17, 0x54, 0x11, 0x75, 0x46,  // COLAS COLES COLIC COLIN
+    0x17, 0x55, 0xA1, 0x75, 0x76, 0x17, 0x57, 0x91, 0x75, 0xBA,  // COLLS COLON COLOR COLTS
+    0x17, 0x61, 0x31, 0x76, 0x2A, 0x17, 0x64, 0x01, 0x76, 0x41,  // CONCH CONES CONIA CONIC
+    0x17, 0x64, 0x61, 0x76, 0x62, 0x17, 0x66, 0xA1, 0x76, 0xB2,  // CONIN CONNE CONNS CONTE
+    0x17, 0x6B, 0x71, 0x77, 0x13, 0x17, 0x72, 0x21, 0x77, 0x29,  // CONTO COOCH COOEE COOER
+    0x17, 0x75, 0xA1, 0x77, 0x6A, 0x17, 0x78, 0xA1, 0x77, 0x8B,  // COOLS COONS COOPS COOPT
+    0x17, 0x7A, 0xB1, 0x77, 0xBA, 0x17, 0x80, 0x51, 0x78, 0x26,  // COOST COOTS COPAL COPEN
+    0x17, 0x82, 0x91, 0x78, 0x2A, 0x17, 0x89, 0x01, 0x78, 0xA2,  // COPER COPES COPRA COPSE
+    0x17, 0x90, 0x51, 0x79, 0x29, 0x17, 0x92, 0xA1, 0x79, 0x40,  // CORAL CORER CORES CORIA
+    0x17, 0x96, 0x41, 0x79, 0x67, 0x17, 0x96, 0xA1, 0x79, 0x8A,  // CORNI CORNO CORNS CORPS
+    0x17, 0x9A, 0x21, 0x79, 0xA7, 0x17, 0xA2, 0x11, 0x7A, 0x2A,  // CORSE CORSO COSEC COSES
+    0x17, 0xA2, 0xB1, 0x7A, 0x42, 0x17, 0xAB, 0x01, 0x7A, 0xB2,  // COSET COSIE COSTA COSTE
+    0x17, 0xAB, 0xA1, 0x7B, 0x06, 0x17, 0xB2, 0xA1, 0x7B, 0x3A,  // COSTS COTAN COTES COTHS
+    0x17, 0xBB, 0x01, 0x7B, 0xBA, 0x19, 0x00, 0x51, 0x90, 0x41,  // COTTA COTTS CRAAL CRAIC
+    0x19, 0x06, 0x21, 0x90, 0x6A, 0x19, 0x08, 0x21, 0x90, 0x8A,  // CRANE CRANS CRAPE CRAPS
+    0x19, 0x09, 0x21, 0x90, 0xA3, 0x19, 0x0A, 0xA1, 0x90, 0xB2,  // CRARE CRASH CRASS CRATE
+    0x19, 0x22, 0x51, 0x92, 0x28, 0x19, 0x22, 0xA1, 0x92, 0x60,  // CREEL CREEP CREES CRENA
+    0x19, 0x28, 0x21, 0x92, 0x8A, 0x19, 0x28, 0xB1, 0x92, 0xAA,  // CREPE CREPS CREPT CRESS
+    0x19, 0x2A, 0xB1, 0x94, 0x0A, 0x19, 0x42, 0x91, 0x94, 0x2A,  // CREST CRIAS CRIER CRIES
+    0x19, 0x46, 0x21, 0x94, 0x7A, 0x19, 0x48, 0x21, 0x94, 0x8A,  // CRINE CRIOS CRIPE CRIPS
+    0x19, 0x4A, 0x21, 0x94, 0xA8, 0x19, 0x4B, 0x31, 0x94, 0xBA,  // CRISE CRISP CRITH CRITS
+    0x19, 0x71, 0x41, 0x97, 0x1A, 0x19, 0x76, 0x21, 0x97, 0x6A,  // CROCI CROCS CRONE CRONS
+    0x19, 0x77, 0x51, 0x97, 0x76, 0x19, 0x78, 0xA1, 0x97, 0x92,  // CROOL CROON CROPS CRORE
+    0x19, 0x7A, 0xA1, 0x97, 0xAB, 0x1B, 0x26, 0x22, 0x05, 0x2A,  // CROSS CROST CTENE EALES
+    0x20, 0x95, 0xA2, 0x09, 0x6A, 0x20, 0x96, 0xB2, 0x09, 0xAB,  // EARLS EARNS EARNT EARST
+    0x20, 0x9B, 0x32, 0x0A, 0x25, 0x20, 0xA2, 0x92, 0x0A, 0x2A,  // EARTH EASEL EASER EASES
+    0x20, 0xA5, 0x22, 0x0A, 0xBA, 0x20, 0xB2, 0x62, 0x0B, 0x29,  // EASLE EASTS EATEN EATER
+    0x20, 0xB3, 0x22, 0x13, 0x2A, 0x21, 0x37, 0xA2, 0x15, 0x0B,  // EATHE ECHES ECHOS ECLAT
+    0x22, 0x94, 0x22, 0x4A, 0x25, 0x25, 0x04, 0x62, 0x50, 0x6A,  // EERIE EISEL ELAIN ELANS
+    0x25, 0x0B, 0x22, 0x51, 0x34, 0x25, 0x21, 0xB2, 0x54, 0x6B,  // ELATE ELCHI ELECT ELINT
+    0x25, 0x4B, 0x22, 0x57, 0x46, 0x25, 0x78, 0x22, 0x57, 0x8A,  // ELITE ELOIN ELOPE ELOPS
+    0x25, 0x82, 0x22, 0x5A, 0x46, 0x26, 0x01, 0xB2, 0x60, 0xB2,  // ELPEE ELSIN ENACT ENATE
+    0x26, 0x40, 0x12, 0x65, 0x4B, 0x26, 0x75, 0xA2, 0x69, 0x75,  // ENIAC ENLIT ENOLS ENROL
+    0x26, 0xB2, 0x92, 0x6B, 0x40, 0x27, 0x95, 0xA2, 0x7A, 0x46,  // ENTER ENTIA EORLS EOSIN
+    0x28, 0x01, 0xB2, 0x82, 0x2A, 0x28, 0x30, 0x32, 0x83, 0x0A,  // EPACT EPEES EPHAH EPHAS
+    0x28, 0x37, 0x92, 0x84, 0x1A, 0x28, 0x71, 0x32, 0x87, 0x8B,  // EPHOR EPICS EPOCH EPOPT
+    0x28, 0x94, 0xA2, 0x90, 0xA2, 0x29, 0x21, 0xB2, 0x94, 0x10,  // EPRIS ERASE ERECT ERICA
+    0x29, 0x41, 0xA2, 0x96, 0x2A, 0x29, 0x7A, 0x22, 0x99, 0x79,  // ERICS ERNES EROSE ERROR
+    0x29, 0xA2, 0xA2, 0xA1, 0x09, 0x2A, 0x17, 0xB2, 0xA4, 0x52,  // ERSES ESCAR ESCOT ESILE
+    0x2A, 0x62, 0xA2, 0xAA, 0x2A, 0x2A, 0xB2, 0x92, 0xAB, 0x71,  // ESNES ESSES ESTER ESTOC
+    0x2A, 0xB7, 0x82, 0xAB, 0x97, 0x2B, 0x08, 0x22, 0xB0, 0xBA,  // ESTOP ESTRO ETAPE ETATS
+    0x2B, 0x26, 0xA2, 0xB3, 0x05, 0x2B, 0x32, 0x92, 0xB3, 0x41,  // ETENS ETHAL ETHER ETHIC
+    0x2B, 0x36, 0x22, 0xB3, 0x7A, 0x2B, 0x41, 0xA2, 0xB6, 0x0A,  // ETHNE ETHOS ETICS ETNAS
+    0x2B, 0xB4, 0x62, 0xBB, 0x52, 0x30, 0x09, 0xA3, 0x02, 0xBA,  // ETTIN ETTLE HAARS HAETS
+    0x30, 0x30, 0xA3, 0x04, 0x5A, 0x30, 0x46, 0xA3, 0x04, 0x6B,  // HAHAS HAILS HAINS HAINT
+    0x30, 0x49, 0xA3, 0x04, 0xB3, 0x30, 0x50, 0x53, 0x05, 0x29,  // HAIRS HAITH HALAL HALER
+    0x30, 0x52, 0xA3, 0x05, 0x57, 0x30, 0x55, 0xA3, 0x05, 0x76,  // HALES HALLO HALLS HALON
+    0x30, 0x57, 0xA3, 0x05, 0xA2, 0x30, 0x5B, 0xA3, 0x06, 0x08,  // HALOS HALSE HALTS HANAP
+    0x30, 0x61, 0x23, 0x06, 0x13, 0x30, 0x6A, 0x03, 0x06, 0xA2,  // HANCE HANCH HANSA HANSE
+    0x30, 0x6B, 0xA3, 0x07, 0x52, 0x30, 0x88, 0x43, 0x09, 0x2A,  // HANTS HAOLE HAPPI HARES
+    0x30, 0x95, 0xA3, 0x09, 0x6A, 0x30, 0x97, 0xA3, 0x09, 0x8A,  // HARLS HARNS HAROS HARPS
+    0x30, 0x9A, 0x33, 0x09, 0xBA, 0x30, 0xA8, 0xA3, 0x0A, 0xB0,  // HARSH HARTS HASPS HASTA
+    0x30, 0xAB, 0x23, 0x0B, 0x13, 0x30, 0xB2, 0x93, 0x0B, 0x2A,  // HASTE HATCH HATER HATES
+    0x30, 0xB3, 0x03, 0x20, 0x5A, 0x32, 0x08, 0xA3, 0x20, 0x92,  // HATHA HEALS HEAPS HEARE
+    0x32, 0x09, 0xA3, 0x20, 0x9B, 0x32, 0x0A, 0xB3, 0x20, 0xB3,  // HEARS HEART HEAST HEATH
+    0x32, 0x0B, 0xA3, 0x21, 0x3B, 0x32, 0x25, 0xA3, 0x24, 0x5A,  // HEATS HECHT HEELS HEILS
+    0x32, 0x49, 0xA3, 0x24, 0xAB, 0x32, 0x52, 0xA3, 0x25, 0x47,  // HEIRS HEIST HELES HELIO
+    0x32, 0x55, 0x73, 0x25, 0x5A, 0x32, 0x57, 0xA3, 0x25, 0x7B,  // HELLO HELLS HELOS HELOT
+    0x32, 0x58, 0xA3, 0x26, 0x12, 0x32, 0x61, 0x33, 0x26, 0x60,  // HELPS HENCE HENCH HENNA
+    0x32, 0x6B, 0xA3, 0x28, 0x09, 0x32, 0x92, 0xA3, 0x29, 0x5A,  // HENTS HEPAR HERES HERLS
+    0x32, 0x96, 0xA3, 0x29, 0x76, 0x32, 0x97, 0xA3, 0x29, 0xA2,  // HERNS HERON HEROS HERSE
+    0x32, 0xA8, 0xA3, 0x2A, 0xBA, 0x32, 0xB2, 0xA3, 0x2B, 0x3A,  // HESPS HESTS HETES HETHS
+    0x34, 0x06, 0xB3, 0x45, 0x09, 0x34, 0x51, 0x33, 0x45, 0x57,  // HIANT HILAR HILCH HILLO
+    0x34, 0x55, 0xA3, 0x45, 0xBA, 0x34, 0x6B, 0xA3, 0x47, 0x4A,  // HILLS HILTS HINTS HIOIS
+    0x34, 0x88, 0x73, 0x49, 0x22, 0x34, 0x92, 0x93, 0x49, 0x2A,  // HIPPO HIREE HIRER HIRES
+    0x34, 0xAB, 0xA3, 0x4B, 0x13, 0x34, 0xB3, 0x23, 0x70, 0x9A,  // HISTS HITCH HITHE HOARS
+    0x37, 0x0A, 0xB3, 0x72, 0x9A, 0x37, 0x4A, 0x23, 0x74, 0xAB,  // HOAST HOERS HOISE HOIST
+    0x37, 0x52, 0xA3, 0x75, 0x50, 0x37, 0x55, 0x73, 0x75, 0x76,  // HOLES HOLLA HOLLO HOLON
+    0x37, 0x57, 0xA3, 0x75, 0xBA, 0x37, 0x60, 0x63, 0x76, 0x29,  // HOLOS HOLTS HONAN HONER
+    0x37, 0x62, 0xA3, 0x76, 0x79, 0x37, 0x71, 0x33, 0x77, 0x6A,  // HONES HONOR HOOCH HOONS
+    0x37, 0x78, 0xA3, 0x77, 0x9A, 0x37, 0x7A, 0x33, 0x77, 0xBA,  // HOOPS HOORS HOOSH HOOTS
+    0x37, 0x82, 0x93, 0x78, 0x2A, 0x37, 0x90, 0x33, 0x79, 0x05,  // HOPER HOPES HORAH HORAL
+    0x37, 0x90, 0xA3, 0x79, 0x4A, 0x37, 0x96, 0xA3, 0x79, 0xA2,  // HORAS HORIS HORNS HORSE
+    0x37, 0x9A, 0xB3, 0x7A, 0x25, 0x37, 0xA2, 0x63, 0x7A, 0x29,  // HORST HOSEL HOSEN HOSER
+    0x37, 0xA2, 0xA3, 0x7A, 0xB0, 0x37, 0xAB, 0xA3, 0x7B, 0x13,  // HOSES HOSTA HOSTS HOTCH
+    0x37, 0xB2, 0x53, 0x7B, 0x26, 0x41, 0x29, 0xA4, 0x13, 0x2A,  // HOTEL HOTEN ICERS ICHES
+    0x41, 0x37, 0x94, 0x14, 0x29, 0x41, 0x76, 0xA4, 0x1B, 0x05,  // ICHOR ICIER ICONS ICTAL
+    0x41, 0xB4, 0x14, 0x52, 0x01, 0x45, 0x20, 0x54, 0x54, 0x01,  // ICTIC ILEAC ILEAL ILIAC
+    0x45, 0x40, 0x54, 0x55, 0x29, 0x45, 0x5B, 0x34, 0x60, 0x62,  // ILIAL ILLER ILLTH INANE
+    0x46, 0x08, 0xB4, 0x61, 0x25, 0x46, 0x15, 0x24, 0x62, 0x8B,  // INAPT INCEL INCLE INEPT
+    0x46, 0x29, 0xB4, 0x64, 0x76, 0x46, 0x52, 0xB4, 0x66, 0x29,  // INERT INION INLET INNER
+    0x46, 0x64, 0xB4, 0x6A, 0x2B, 0x46, 0xA8, 0x74, 0x6B, 0x25,  // INNIT INSET INSPO INTEL
+    0x46, 0xB2, 0x94, 0x6B, 0x45, 0x46, 0xB4, 0xA4, 0x6B, 0x90,  // INTER INTIL INTIS INTRA
+    0x46, 0xB9, 0x74, 0x76, 0x41, 0x47, 0xB0, 0xA4, 0x88, 0x76,  // INTRO IONIC IOTAS IPPON
+    0x49, 0x0B, 0x24, 0x97, 0x62, 0x49, 0x76, 0xA4, 0xA3, 0x2A,  // IRATE IRONE IRONS ISHES
+    0x4A, 0x52, 0xA4, 0xA5, 0x2B, 0x4A, 0x60, 0x24, 0xAA, 0x24,  // ISLES ISLET ISNAE ISSEI
+    0x4A, 0xB5, 0x24, 0xB3, 0x29, 0x50, 0x09, 0x45, 0x01, 0x29,  // ISTLE ITHER LAARI LACER
+    0x50, 0x12, 0xA5, 0x01, 0x2B, 0x50, 0x29, 0xA5, 0x03, 0x05,  // LACES LACET LAERS LAHAL
+    0x50, 0x30, 0x95, 0x04, 0x13, 0x50, 0x41, 0xA5, 0x04, 0x9A,  // LAHAR LAICH LAICS LAIRS
+    0x50, 0x4B, 0x35, 0x05, 0x5A, 0x50, 0x60, 0x45, 0x06, 0x0A,  // LAITH LALLS LANAI LANAS
+    0x50, 0x61, 0x25, 0x06, 0x13, 0x50, 0x62, 0xA5, 0x06, 0xBA,  // LANCE LANCH LANES LANTS
+    0x50, 0x82, 0x55, 0x08, 0x46, 0x50, 0x84, 0xA5, 0x08, 0xA2,  // LAPEL LAPIN LAPIS LAPSE
+    0x50, 0x91, 0x35, 0x09, 0x22, 0x50, 0x92, 0xA5, 0x09, 0x4A,  // LARCH LAREE LARES LARIS
+    0x50, 0x96, 0xA5, 0x09, 0x6B, 0x50, 0xA2, 0x95, 0x0A, 0x2A,  // LARNS LARNT LASER LASES
+    0x50, 0xAA, 0x45, 0x0A, 0xA7, 0x50, 0xAB, 0xA5, 0x0B, 0x03,  // LASSI LASSO LASTS LATAH
+    0x50, 0xB1, 0x35, 0x0B, 0x26, 0x50, 0xB2, 0x95, 0x0B, 0x32,  // LATCH LATEN LATER LATHE
+    0x50, 0xB3, 0x45, 0x0B, 0x3A, 0x50, 0xBB, 0x25, 0x20, 0x13,  // LATHI LATHS LATTE LEACH
+    0x52, 0x06, 0xA5, 0x20, 0x6B, 0x52, 0x08, 0xA5, 0x20, 0x8B,  // LEANS LEANT LEAPS LEAPT
+    0x52, 0x09, 0x25, 0x20, 0x96, 0x52, 0x09, 0xA5, 0x20, 0xA2,  // LEARE LEARN LEARS LEASE
+    0x52, 0x0A, 0x35, 0x20, 0xAB, 0x52, 0x0B, 0xA5, 0x22, 0x09,  // LEASH LEAST LEATS LEEAR
+    0x52, 0x21, 0x35, 0x22, 0x8A, 0x52, 0x29, 0xA5, 0x22, 0xA2,  // LEECH LEEPS LEERS LEESE
+    0x52, 0x2B, 0xA5, 0x23, 0x9A, 0x52, 0x49, 0xA5, 0x24, 0xA3,  // LEETS LEHRS LEIRS LEISH
+    0x52, 0x62, 0xA5, 0x26, 0x4A, 0x52, 0x67, 0xA5, 0x26, 0xA2,  // LENES LENIS LENOS LENSE
+    0x52, 0x6B, 0x45, 0x26, 0xB7, 0x52, 0x76, 0x25, 0x28, 0x29,  // LENTI LENTO LEONE LEPER
+    0x52, 0x89, 0x05, 0x28, 0xB0, 0x52, 0x92, 0xA5, 0x29, 0x8A,  // LEPRA LEPTA LERES LERPS
+    0x52, 0xA2, 0xA5, 0x2A, 0xBA, 0x52, 0xB1, 0x35, 0x2B, 0x32,  // LESES LESTS LETCH LETHE
+    0x54, 0x06, 0x05, 0x40, 0x62, 0x54, 0x09, 0xA5, 0x40, 0x9B,  // LIANA LIANE LIARS LIART
+    0x54, 0x13, 0x45, 0x41, 0x3B, 0x54, 0x14, 0xB5, 0x42, 0x6A,  // LICHI LICHT LICIT LIENS
+    0x54, 0x29, 0xA5, 0x45, 0x01, 0x54, 0x55, 0xA5, 0x45, 0x7A,  // LIERS LILAC LILLS LILOS
+    0x54, 0x5B, 0xA5, 0x46, 0x01, 0x54, 0x61, 0x35, 0x46, 0x26,  // LILTS LINAC LINCH LINEN
+    0x54, 0x62, 0x95, 0x46, 0x2A, 0x54, 0x64, 0x65, 0x46, 0x6A,  // LINER LINES LININ LINNS
+    0x54, 0x67, 0xA5, 0x46, 0xBA, 0x54, 0x76, 0xA5, 0x48, 0x0A,  // LINOS LINTS LIONS LIPAS
+    0x54, 0x82, 0xA5, 0x48, 0x46, 0x54, 0x87, 0xA5, 0x49, 0x0A,  // LIPES LIPIN LIPOS LIRAS
+    0x54, 0x97, 0xB5, 0x4A, 0x52, 0x54, 0xA8, 0xA5, 0x4A, 0xBA,  // LIROT LISLE LISPS LISTS
+    0x54, 0xB0, 0x45, 0x4B, 0x0A, 0x54, 0xB2, 0x95, 0x4B, 0x2A,  // LITAI LITAS LITER LITES
+    0x54, 0xB3, 0x25, 0x4B, 0x37, 0x54, 0xB3, 0xA5, 0x4B, 0x92,  // LITHE LITHO LITHS LITRE
+    0x55, 0x06, 0x75, 0x70, 0x13, 0x57, 0x06, 0xA5, 0x70, 0xAB,  // LLANO LOACH LOANS LOAST
+    0x57, 0x0B, 0x35, 0x71, 0x05, 0x57, 0x13, 0x25, 0x71, 0x3A,  // LOATH LOCAL LOCHE LOCHS
+    0x57, 0x14, 0x25, 0x71, 0x4A, 0x57, 0x17, 0xA5, 0x72, 0xAA,  // LOCIE LOCIS LOCOS LOESS
+    0x57, 0x30, 0x65, 0x74, 0x6A, 0x57, 0x48, 0x25, 0x74, 0x9A,  // LOHAN LOINS LOIPE LOIRS
+    0x57, 0x55, 0xA5, 0x76, 0x29, 0x57, 0x74, 0x25, 0x77, 0x6A,  // LOLLS LONER LOOIE LOONS
+    0x57, 0x78, 0xA5, 0x77, 0xA2, 0x57, 0x7B, 0xA5, 0x78, 0x29,  // LOOPS LOOSE LOOTS LOPER
+    0x57, 0x82, 0xA5, 0x79, 0x05, 0x57, 0x90, 0x65, 0x79, 0x25,  // LOPES LORAL LORAN LOREL
+    0x57, 0x92, 0xA5, 0x79, 0x41, 0x57, 0x94, 0xA5, 0x7A, 0x25,  // LORES LORIC LORIS LOSEL
+    0x57, 0xA2, 0x65, 0x7A, 0x29, 0x57, 0xA2, 0xA5, 0x7B, 0x03,  // LOSEN LOSER LOSES LOTAH
+    0x57, 0xB0, 0xA5, 0x7B, 0x2A, 0x57, 0xB4, 0x15, 0x7B, 0x7A,  // LOTAS LOTES LOTIC LOTOS
+    0x57, 0xBA, 0x05, 0x7B, 0xB0, 0x57, 0xBB, 0x25, 0x7B, 0xB7,  // LOTSA LOTTA LOTTE LOTTO
+    0x60, 0x06, 0xA6, 0x01, 0x32, 0x60, 0x13, 0x76, 0x01, 0x92,  // NAANS NACHE NACHO NACRE
+    0x60, 0x30, 0x56, 0x04, 0x5A, 0x60, 0x49, 0x06, 0x05, 0x0A,  // NAHAL NAILS NAIRA NALAS
+    0x60, 0x55, 0x06, 0x06, 0x0A, 0x60, 0x61, 0x26, 0x06, 0x60,  // NALLA NANAS NANCE NANNA
+    0x60, 0x67, 0xA6, 0x08, 0x0A, 0x60, 0x82, 0xA6, 0x08, 0x77,  // NANOS NAPAS NAPES NAPOO
+    0x60, 0x88, 0x06, 0x08, 0x82, 0x60, 0x90, 0xA6, 0x09, 0x17,  // NAPPA NAPPE NARAS NARCO
+    0x60, 0x91, 0xA6, 0x09, 0x2A, 0x60, 0x94, 0x16, 0x09, 0x4A,  // NARCS NARES NARIC NARIS
+    0x60, 0x99, 0x26, 0x0A, 0x05, 0x60, 0xA3, 0x46, 0x0B, 0x05,  // NARRE NASAL NASHI NATAL
+    0x60, 0xB1, 0x36, 0x0B, 0x2A, 0x60, 0xB4, 0xA6, 0x20, 0x5A,  // NATCH NATES NATIS NEALS
+    0x62, 0x08, 0xA6, 0x20, 0x9A, 0x62, 0x0B, 0x36, 0x20, 0xBA,  // NEAPS NEARS NEATH NEATS
+    0x62, 0x25, 0x26, 0x22, 0x8A, 0x62, 0x2A, 0x26, 0x24, 0xAB,  // NEELE NEEPS NEESE NEIST
+    0x62, 0x54, 0xA6, 0x26, 0x2A, 0x62, 0x76, 0xA6, 0x28, 0x29,  // NELIS NENES NEONS NEPER
+    0x62, 0x84, 0xB6, 0x29, 0x05, 0x62, 0x97, 0x56, 0x29, 0xBA,  // NEPIT NERAL NEROL NERTS
+    0x62, 0xAB, 0xA6, 0x2B, 0x2A, 0x62, 0xB7, 0x86, 0x2B, 0xBA,  // NESTS NETES NETOP NETTS
+    0x64, 0x12, 0x96, 0x41, 0x32, 0x64, 0x13, 0xB6, 0x41, 0x75,  // NICER NICHE NICHT NICOL
+    0x64, 0x21, 0x26, 0x43, 0x45, 0x64, 0x55, 0xA6, 0x46, 0x29,  // NIECE NIHIL NILLS NINER
+    0x64, 0x62, 0xA6, 0x46, 0x76, 0x64, 0x6B, 0x36, 0x48, 0x0A,  // NINES NINON NINTH NIPAS
+    0x64, 0x95, 0xA6, 0x4A, 0x24, 0x64, 0xAA, 0x26, 0x4B, 0x29,  // NIRLS NISEI NISSE NITER
+    0x64, 0xB2, 0xA6, 0x4B, 0x76, 0x64, 0xB9, 0x26, 0x4B, 0x97,  // NITES NITON NITRE NITRO
+    0x67, 0x03, 0xA6, 0x72, 0x5A, 0x67, 0x45, 0xA6, 0x74, 0x6B,  // NOAHS NOELS NOILS NOINT
+    0x67, 0x49, 0xA6, 0x74, 0xA2, 0x67, 0x52, 0xA6, 0x75, 0x5A,  // NOIRS NOISE NOLES NOLLS
+    0x67, 0x57, 0xA6, 0x76, 0x0A, 0x67, 0x61, 0x26, 0x76, 0x2A,  // NOLOS NONAS NONCE NONES
+    0x67, 0x62, 0xB6, 0x76, 0x4A, 0x67, 0x74, 0xB6, 0x77, 0x6A,  // NONET NONIS NOOIT NOONS
+    0x67, 0x78, 0xA6, 0x77, 0xA2, 0x67, 0x80, 0x56, 0x79, 0x40,  // NOOPS NOOSE NOPAL NORIA
+    0x67, 0x94, 0xA6, 0x79, 0xB3, 0x67, 0xA2, 0x96, 0x7A, 0x2A,  // NORIS NORTH NOSER NOSES
+    0x67, 0xB0, 0x56, 0x7B, 0x13, 0x67, 0xB2, 0x96, 0x7B, 0x2A,  // NOTAL NOTCH NOTER NOTES
+    0x70, 0xA2, 0xA7, 0x0A, 0x4A, 0x70, 0xAB, 0xA7, 0x0B, 0x26,  // OASES OASIS OASTS OATEN
+    0x70, 0xB2, 0x97, 0x0B, 0x3A, 0x71, 0x20, 0x67, 0x13, 0x29,  // OATER OATHS OCEAN OCHER
+    0x71, 0x32, 0xA7, 0x13, 0x92, 0x71, 0x92, 0x07, 0x1B, 0x05,  // OCHES OCHRE OCREA OCTAL
+    0x71, 0xB0, 0x67, 0x1B, 0x0A, 0x71, 0xB2, 0xB7, 0x34, 0x0A,  // OCTAN OCTAS OCTET OHIAS
+    0x73, 0x76, 0x27, 0x45, 0x29, 0x74, 0x6B, 0xA7, 0x52, 0x41,  // OHONE OILER OINTS OLEIC
+    0x75, 0x24, 0x67, 0x52, 0x6B, 0x75, 0x27, 0xA7, 0x54, 0x7A,  // OLEIN OLENT OLEOS OLIOS
+    0x75, 0x50, 0xA7, 0x55, 0x29, 0x75, 0x54, 0x27, 0x58, 0x02,  // OLLAS OLLER OLLIE OLPAE
+    0x75, 0x82, 0xA7, 0x61, 0x29, 0x76, 0x12, 0xA7, 0x61, 0x2B,  // OLPES ONCER ONCES ONCET
+    0x76, 0x29, 0xA7, 0x64, 0x76, 0x76, 0xA2, 0xB7, 0x6B, 0x41,  // ONERS ONION ONSET ONTIC
+    0x77, 0x6B, 0xA7, 0x79, 0x42, 0x77, 0xA2, 0xA7, 0x80, 0x3A,  // OONTS OORIE OOSES OPAHS
+    0x78, 0x05, 0xA7, 0x82, 0x6A, 0x78, 0x28, 0x27, 0x82, 0x90,  // OPALS OPENS OPEPE OPERA
+    0x78, 0x46, 0x27, 0x88, 0x7A, 0x78, 0xA4, 0x67, 0x8B, 0x29,  // OPINE OPPOS OPSIN OPTER
+    0x78, 0xB4, 0x17, 0x90, 0x13, 0x79, 0x05, 0xA7, 0x90, 0x6B,  // OPTIC ORACH ORALS ORANT
+    0x79, 0x0B, 0x27, 0x91, 0x0A, 0x79, 0x14, 0x67, 0x94, 0x25,  // ORATE ORCAS ORCIN ORIEL
+    0x79, 0x52, 0xA7, 0x95, 0x76, 0x79, 0x57, 0x87, 0x96, 0x4A,  // ORLES ORLON ORLOP ORNIS
+    0x79, 0x84, 0x67, 0x99, 0x4A, 0x79, 0xB3, 0x77, 0xA1, 0x09,  // ORPIN ORRIS ORTHO OSCAR
+    0x7A, 0x30, 0x17, 0xA4, 0x29, 0x7A, 0xA4, 0x07, 0xAB, 0x40,  // OSHAC OSIER OSSIA OSTIA
+    0x7B, 0x32, 0x97, 0xBB, 0x09, 0x7B, 0xB2, 0x97, 0xBB, 0x7A,  // OTHER OTTAR OTTER OTTOS
+    0x80, 0x05, 0xA8, 0x00, 0x6A, 0x80, 0x10, 0xA8, 0x01, 0x29,  // PAALS PAANS PACAS PACER
+    0x80, 0x12, 0xA8, 0x01, 0x30, 0x80, 0x17, 0xA8, 0x01, 0xB0,  // PACES PACHA PACOS PACTA
+    0x80, 0x1B, 0xA8, 0x02, 0x06, 0x80, 0x27, 0x68, 0x04, 0x5A,  // PACTS PAEAN PAEON PAILS
+    0x80, 0x46, 0xA8, 0x04, 0x6B, 0x80, 0x49, 0x28, 0x04, 0x9A,  // PAINS PAINT PAIRE PAIRS
+    0x80, 0x4A, 0x08, 0x04, 0xA2, 0x80, 0x50, 0xA8, 0x05, 0x20,  // PAISA PAISE PALAS PALEA
+    0x80, 0x52, 0x98, 0x05, 0x2A, 0x80, 0x52, 0xB8, 0x05, 0x4A,  // PALER PALES PALET PALIS
+    0x80, 0x55, 0x08, 0x05, 0x5A, 0x80, 0x58, 0x48, 0x05, 0x8A,  // PALLA PALLS PALPI PALPS
+    0x80, 0x5A, 0x08, 0x06, 0x12, 0x80, 0x62, 0x58, 0x06, 0x2A,  // PALSA PANCE PANEL PANES
+    0x80, 0x64, 0x18, 0x06, 0x62, 0x80, 0x66, 0x48, 0x06, 0xB7,  // PANIC PANNE PANNI PANTO
+    0x80, 0x6B, 0xA8, 0x07, 0x54, 0x80, 0x75, 0x78, 0x08, 0x05,  // PANTS PAOLI PAOLO PAPAL
+    0x80, 0x80, 0xA8, 0x08, 0x29, 0x80, 0x82, 0xA8, 0x08, 0x84,  // PAPAS PAPER PAPES PAPPI
+    0x80, 0x90, 0x28, 0x09, 0x0A, 0x80, 0x91, 0x38, 0x09, 0x26,  // PARAE PARAS PARCH PAREN
+    0x80, 0x92, 0x78, 0x09, 0x29, 0x80, 0x92, 0xA8, 0x09, 0x4A,  // PAREO PARER PARES PARIS
+    0x80, 0x95, 0x28, 0x09, 0x75, 0x80, 0x98, 0xA8, 0x09, 0x90,  // PARLE PAROL PARPS PARRA
+    0x80, 0x99, 0xA8, 0x09, 0xA2, 0x80, 0x9B, 0x48, 0x09, 0xBA,  // PARRS PARSE PARTI PARTS
+    0x80, 0xA2, 0x78, 0x0A, 0x2A, 0x80, 0xA3, 0x08, 0x0A, 0xA2,  // PASEO PASES PASHA PASSE
+    0x80, 0xAB, 0x08, 0x0A, 0xB2, 0x80, 0xAB, 0xA8, 0x0B, 0x13,  // PASTA PASTE PASTS PATCH
+    0x80, 0xB2, 0x68, 0x0B, 0x29, 0x80, 0xB2, 0xA8, 0x0B, 0x3A,  // PATEN PATER PATES PATHS
+    0x80, 0xB4, 0x68, 0x0B, 0x47, 0x80, 0xBB, 0x28, 0x20, 0x12,  // PATIN PATIO PATTE PEACE
+    0x82, 0x01, 0x38, 0x20, 0x5A, 0x82, 0x06, 0xA8, 0x20, 0x92,  // PEACH PEALS PEANS PEARE
+    0x82, 0x09, 0x58, 0x20, 0x9A, 0x82, 0x09, 0xB8, 0x20, 0xA2,  // PEARL PEARS PEART PEASE
+    0x82, 0x0B, 0xA8, 0x21, 0x06, 0x82, 0x13, 0xA8, 0x22, 0x12,  // PEATS PECAN PECHS PEECE
+    0x82, 0x25, 0xA8, 0x22, 0x6A, 0x82, 0x28, 0x28, 0x22, 0x8A,  // PEELS PEENS PEEPE PEEPS
+    0x82, 0x29, 0xA8, 0x24, 0x6A, 0x82, 0x4A, 0x28, 0x25, 0x0A,  // PEERS PEINS PEISE PELAS
+    0x82, 0x52, 0xA8, 0x25, 0x5A, 0x82, 0x57, 0x68, 0x25, 0xB0,  // PELES PELLS PELON PELTA
+    0x82, 0x5B, 0xA8, 0x26, 0x05, 0x82, 0x61, 0x28, 0x26, 0x2A,  // PELTS PENAL PENCE PENES
+    0x82, 0x64, 0x28, 0x26, 0x4A, 0x82, 0x66, 0x08, 0x26, 0x62,  // PENIE PENIS PENNA PENNE
+    0x82, 0x66, 0x48, 0x26, 0xBA, 0x82, 0x76, 0xA8, 0x28, 0x50,  // PENNI PENTS PEONS PEPLA
+    0x82, 0x87, 0xA8, 0x28, 0xA4, 0x82, 0x90, 0x48, 0x29, 0x12,  // PEPOS PEPSI PERAI PERCE
+    0x82, 0x91, 0x38, 0x29, 0x1A, 0x82, 0x92, 0x08, 0x29, 0x2A,  // PERCH PERCS PEREA PERES
+    0x82, 0x94, 0x58, 0x29, 0x4A, 0x82, 0x96, 0xA8, 0x29, 0x8A,  // PERIL PERIS PERNS PERPS
+    0x82, 0x9A, 0x28, 0x29, 0xAB, 0x82, 0x9B, 0xA8, 0x2A, 0x7A,  // PERSE PERST PERTS PESOS
+    0x82, 0xAB, 0x78, 0x2A, 0xBA, 0x82, 0xB0, 0x58, 0x2B, 0x09,  // PESTO PESTS PETAL PETAR
+    0x82, 0xB2, 0x98, 0x2B, 0x4B, 0x82, 0xB9, 0x28, 0x2B, 0x94,  // PETER PETIT PETRE PETRI
+    0x82, 0xBB, 0x48, 0x2B, 0xB7, 0x83, 0x09, 0x28, 0x30, 0xA2,  // PETTI PETTO PHARE PHASE
+    0x83, 0x22, 0x98, 0x32, 0x62, 0x83, 0x27, 0x68, 0x32, 0xA2,  // PHEER PHENE PHEON PHESE
+    0x83, 0x40, 0x58, 0x34, 0xA3, 0x83, 0x71, 0x08, 0x37, 0x62,  // PHIAL PHISH PHOCA PHONE
+    0x83, 0x76, 0x78, 0x37, 0x6A, 0x83, 0x7B, 0x78, 0x37, 0xBA,  // PHONO PHONS PHOTO PHOTS
+    0x83, 0x83, 0xB8, 0x40, 0x64, 0x84, 0x06, 0x78, 0x40, 0x6A,  // PHPHT PIANI PIANO PIANS
+    0x84, 0x10, 0x58, 0x41, 0x0A, 0x84, 0x17, 0xB8, 0x41, 0x90,  // PICAL PICAS PICOT PICRA
+    0x84, 0x21, 0x28, 0x42, 0x9A, 0x84, 0x29, 0xB8, 0x42, 0xB0,  // PIECE PIERS PIERT PIETA
+    0x84, 0x2B, 0xA8, 0x45, 0x02, 0x84, 0x50, 0x78, 0x45, 0x09,  // PIETS PILAE PILAO PILAR
+    0x84, 0x51, 0x38, 0x45, 0x20, 0x84, 0x52, 0x48, 0x45, 0x29,  // PILCH PILEA PILEI PILER
+    0x84, 0x52, 0xA8, 0x45, 0x4A, 0x84, 0x55, 0xA8, 0x45, 0x7B,  // PILES PILIS PILLS PILOT
+    0x84, 0x60, 0xA8, 0x46, 0x13, 0x84, 0x62, 0xA8, 0x46, 0x60,  // PINAS PINCH PINES PINNA
+    0x84, 0x67, 0x68, 0x46, 0x7B, 0x84, 0x6B, 0x08, 0x46, 0xB7,  // PINON PINOT PINTA PINTO
+    0x84, 0x6B, 0xA8, 0x47, 0x6A, 0x84, 0x80, 0x58, 0x48, 0x0A,  // PINTS PIONS PIPAL PIPAS
+    0x84, 0x82, 0x98, 0x48, 0x2A, 0x84, 0x82, 0xB8, 0x48, 0x4A,  // PIPER PIPES PIPET PIPIS
+    0x84, 0x84, 0xB8, 0x49, 0x04, 0x84, 0x95, 0xA8, 0x49, 0x6A,  // PIPIT PIRAI PIRLS PIRNS
+    0x84, 0xA1, 0x78, 0x4A, 0x2A, 0x84, 0xA7, 0xA8, 0x4A, 0xB2,  // PISCO PISES PISOS PISTE
+    0x84, 0xB0, 0xA8, 0x4B, 0x13, 0x84, 0xB3, 0xA8, 0x4B, 0x76,  // PITAS PITCH PITHS PITON
+    0x84, 0xB7, 0xB8, 0x4B, 0xB0, 0x85, 0x00, 0xA8, 0x50, 0x12,  // PITOT PITTA PLAAS PLACE
+    0x85, 0x04, 0x68, 0x50, 0x4B, 0x85, 0x06, 0x28, 0x50, 0x6A,  // PLAIN PLAIT PLANE PLANS
+    0x85, 0x06, 0xB8, 0x50, 0x8A, 0x85, 0x0A, 0x38, 0x50, 0xAB,  // PLANT PLAPS PLASH PLAST
+    0x85, 0x0B, 0x28, 0x50, 0xBA, 0x85, 0x0B, 0xB8, 0x52, 0x0A,  // PLATE PLATS PLATT PLEAS
+    0x85, 0x20, 0xB8, 0x52, 0x60, 0x85, 0x27, 0x68, 0x52, 0xA3,  // PLEAT PLENA PLEON PLESH
+    0x85, 0x41, 0x08, 0x54, 0x29, 0x85, 0x42, 0xA8, 0x57, 0x0B,  // PLICA PLIER PLIES PLOAT
+    0x85, 0x78, 0xA8, 0x57, 0xBA, 0x87, 0x01, 0x38, 0x72, 0x8A,  // PLOPS PLOTS POACH POEPS
+    0x87, 0x2B, 0xA8, 0x74, 0x6B, 0x87, 0x4A, 0x28, 0x75, 0x09,  // POETS POINT POISE POLAR
+    0x87, 0x52, 0x98, 0x75, 0x2A, 0x87, 0x54, 0x78, 0x75, 0x4A,  // POLER POLES POLIO POLIS
+    0x87, 0x55, 0xA8, 0x75, 0x7A, 0x87, 0x5B, 0xA8, 0x76, 0x12,  // POLLS POLOS POLTS PONCE
+    0x87, 0x62, 0xA8, 0x76, 0xBA, 0x87, 0x71, 0x38, 0x77, 0x3A,  // PONES PONTS POOCH POOHS
+    0x87, 0x75, 0xA8, 0x77, 0x6A, 0x87, 0x78, 0xA8, 0x77, 0x94,  // POOLS POONS POOPS POORI
+    0x87, 0x79, 0xB8, 0x77, 0xBA, 0x87, 0x82, 0xA8, 0x78, 0x80,  // POORT POOTS POPES POPPA
+    0x87, 0x90, 0x28, 0x79, 0x05, 0x87, 0x91, 0x38, 0x79, 0x29,  // PORAE PORAL PORCH PORER
+    0x87, 0x92, 0xA8, 0x79, 0x46, 0x87, 0x96, 0x78, 0x79, 0x6A,  // PORES PORIN PORNO PORNS
+    0x87, 0x9B, 0x08, 0x79, 0xBA, 0x87, 0xA2, 0x98, 0x7A, 0x2A,  // PORTA PORTS POSER POSES
+    0x87, 0xA3, 0x78, 0x7A, 0x4B, 0x87, 0xAA, 0x28, 0x7A, 0xBA,  // POSHO POSIT POSSE POSTS
+    0x87, 0xB0, 0x28, 0x7B, 0x13, 0x87, 0xB2, 0xA8, 0x7B, 0x46,  // POTAE POTCH POTES POTIN
+    0x87, 0xB7, 0x78, 0x7B, 0xB7, 0x87, 0xBB, 0xA8, 0x90, 0x60,  // POTOO POTTO POTTS PRANA
+    0x89, 0x07, 0xA8, 0x90, 0xA2, 0x89, 0x0B, 0x28, 0x90, 0xBA,  // PRAOS PRASE PRATE PRATS
+    0x89, 0x0B, 0xB8, 0x92, 0x26, 0x89, 0x22, 0xA8, 0x92, 0x6B,  // PRATT PREEN PREES PRENT
+    0x89, 0x27, 0x68, 0x92, 0x78, 0x89, 0x28, 0xA8, 0x92, 0xA0,  // PREON PREOP PREPS PRESA
+    0x89, 0x2A, 0x28, 0x92, 0xAA, 0x89, 0x2A, 0xB8, 0x94, 0x05,  // PRESE PRESS PREST PRIAL
+    0x89, 0x41, 0x28, 0x94, 0x29, 0x89, 0x42, 0xA8, 0x94, 0x55,  // PRICE PRIER PRIES PRILL
+    0x89, 0x46, 0xB8, 0x94, 0x76, 0x89, 0x47, 0x98, 0x94, 0xA2,  // PRINT PRION PRIOR PRISE
+    0x89, 0x4A, 0xA8, 0x97, 0x0A, 0x89, 0x74, 0x68, 0x97, 0x52,  // PRISS PROAS PROIN PROLE
+    0x89, 0x75, 0x58, 0x97, 0x62, 0x89, 0x78, 0xA8, 0x97, 0x92,  // PROLL PRONE PROPS PRORE
+    0x89, 0x7A, 0x28, 0x97, 0xA7, 0x89, 0x7A, 0xA8, 0x97, 0xAB,  // PROSE PROSO PROSS PROST
+    0x89, 0x7B, 0x78, 0xA4, 0x76, 0x8A, 0x70, 0x28, 0xA7, 0x04,  // PROTO PSION PSOAE PSOAI
+    0x8A, 0x70, 0xA8, 0xA7, 0x90, 0x90, 0x12, 0x99, 0x01, 0x2A,  // PSOAS PSORA RACER RACES
+    0x90, 0x13, 0x29, 0x01, 0x76, 0x90, 0x40, 0xA9, 0x04, 0x52,  // RACHE RACON RAIAS RAILE
+    0x90, 0x45, 0xA9, 0x04, 0x62, 0x90, 0x46, 0xA9, 0x04, 0xA2,  // RAILS RAINE RAINS RAISE
+    0x90, 0x4B, 0x09, 0x04, 0xBA, 0x90, 0x52, 0xA9, 0x05, 0x83,  // RAITA RAITS RALES RALPH
+    0x90, 0x60, 0xA9, 0x06, 0x12, 0x90, 0x61, 0x39, 0x06, 0x22,  // RANAS RANCE RANCH RANEE
+    0x90, 0x64, 0xA9, 0x06, 0xBA, 0x90, 0x82, 0x99, 0x08, 0x2A,  // RANIS RANTS RAPER RAPES
+    0x90, 0x83, 0x29, 0x08, 0x82, 0x90, 0x92, 0x29, 0x09, 0x29,  // RAPHE RAPPE RAREE RARER
+    0x90, 0x92, 0xA9, 0x0A, 0x29, 0x90, 0xA2, 0xA9, 0x0A, 0x8A,  // RARES RASER RASES RASPS
+    0x90, 0xAA, 0x29, 0x0A, 0xB0, 0x90, 0xB0, 0x59, 0x0B, 0x06,  // RASSE RASTA RATAL RATAN
+    0x90, 0xB0, 0xA9, 0x0B, 0x13, 0x90, 0xB2, 0x59, 0x0B, 0x29,  // RATAS RATCH RATEL RATER
+    0x90, 0xB2, 0xA9, 0x0B, 0x30, 0x90, 0xB3, 0x29, 0x0B, 0x3A,  // RATES RATHA RATHE RATHS
+    0x90, 0xB4, 0x79, 0x0B, 0x77, 0x90, 0xB7, 0xA9, 0x20, 0x13,  // RATIO RATOO RATOS REACH
+    0x92, 0x01, 0xB9, 0x20, 0x4A, 0x92, 0x05, 0x79, 0x20, 0x5A,  // REACT REAIS REALO REALS
+    0x92, 0x06, 0xA9, 0x20, 0x8A, 0x92, 0x09, 0xA9, 0x20, 0xAB,  // REANS REAPS REARS REAST
+    0x92, 0x0B, 0x09, 0x20, 0xB2, 0x92, 0x10, 0x59, 0x21, 0x08,  // REATA REATE RECAL RECAP
+    0x92, 0x11, 0x29, 0x21, 0x17, 0x92, 0x14, 0xB9, 0x21, 0x76,  // RECCE RECCO RECIT RECON
+    0x92, 0x1B, 0x09, 0x21, 0xB4, 0x92, 0x1B, 0x79, 0x22, 0x13,  // RECTA RECTI RECTO REECH
+    0x92, 0x25, 0xA9, 0x22, 0x6A, 0x92, 0x2A, 0xB9, 0x24, 0x6A,  // REELS REENS REEST REINS
+    0x92, 0x4A, 0xB9, 0x25, 0x2B, 0x92, 0x54, 0x19, 0x25, 0x42,  // REIST RELET RELIC RELIE
+    0x92, 0x54, 0xB9, 0x25, 0x57, 0x92, 0x60, 0x59, 0x26, 0x46,  // RELIT RELLO RENAL RENIN
+    0x92, 0x66, 0x29, 0x26, 0x7A, 0x92, 0x6B, 0x29, 0x26, 0xBA,  // RENNE RENOS RENTE RENTS
+    0x92, 0x74, 0x59, 0x28, 0x25, 0x92, 0x84, 0x69, 0x28, 0x50,  // REOIL REPEL REPIN REPLA
+    0x92, 0x87, 0xA9, 0x28, 0x7B, 0x92, 0x88, 0xA9, 0x28, 0x97,  // REPOS REPOT REPPS REPRO
+    0x92, 0x90, 0x69, 0x2A, 0x0B, 0x92, 0xA2, 0x29, 0x2A, 0x2A,  // RERAN RESAT RESEE RESES
+    0x92, 0xA2, 0xB9, 0x2A, 0x46, 0x92, 0xA4, 0xB9, 0x2A, 0xB7,  // RESET RESIN RESIT RESTO
+    0x92, 0xAB, 0xA9, 0x2B, 0x13, 0x92, 0xB4, 0x09, 0x2B, 0x42,  // RESTS RETCH RETIA RETIE
+    0x92, 0xB9, 0x79, 0x32, 0x0A, 0x93, 0x42, 0xA9, 0x34, 0x62,  // RETRO RHEAS RHIES RHINE
+    0x93, 0x46, 0x79, 0x37, 0x62, 0x94, 0x05, 0xA9, 0x40, 0x6B,  // RHINO RHONE RIALS RIANT
+    0x94, 0x0B, 0x09, 0x41, 0x29, 0x94, 0x12, 0xA9, 0x41, 0x3B,  // RIATA RICER RICES RICHT
+    0x94, 0x14, 0x69, 0x42, 0x5A, 0x94, 0x52, 0xA9, 0x45, 0x52,  // RICIN RIELS RILES RILLE
+    0x94, 0x55, 0xA9, 0x46, 0x2A, 0x94, 0x6A, 0x29, 0x47, 0xBA,  // RILLS RINES RINSE RIOTS
+    0x94, 0x82, 0x69, 0x48, 0x29, 0x94, 0x82, 0xA9, 0x48, 0x8A,  // RIPEN RIPER RIPES RIPPS
+    0x94, 0xA2, 0x69, 0x4A, 0x29, 0x94, 0xA2, 0xA9, 0x4A, 0x34,  // RISEN RISER RISES RISHI
+    0x94, 0xA8, 0xA9, 0x4B, 0x2A, 0x94, 0xBB, 0xA9, 0x70, 0x13,  // RISPS RITES RITTS ROACH
+    0x97, 0x06, 0xA9, 0x70, 0x9A, 0x97, 0x0A, 0xB9, 0x70, 0xB2,  // ROANS ROARS ROAST ROATE
+    0x97, 0x32, 0xA9, 0x74, 0x5A, 0x97, 0x46, 0xA9, 0x74, 0xAB,  // ROHES ROILS ROINS ROIST
+    0x97, 0x52, 0xA9, 0x75, 0x5A, 0x97, 0x62, 0x79, 0x76, 0x2A,  // ROLES ROLLS RONEO RONES
+    0x97, 0x64, 0x69, 0x76, 0x62, 0x97, 0x6B, 0x29, 0x76, 0xBA,  // RONIN RONNE RONTE RONTS
+    0x97, 0x76, 0xA9, 0x77, 0x8A, 0x97, 0x7A, 0x09, 0x77, 0xA2,  // ROONS ROOPS ROOSA ROOSE
+    0x97, 0x7A, 0xB9, 0x77, 0xBA, 0x97, 0x82, 0x99, 0x78, 0x2A,  // ROOST ROOTS ROPER ROPES
+    0x97, 0x90, 0x59, 0x79, 0x2A, 0x97, 0x94, 0x19, 0x79, 0x42,  // RORAL RORES RORIC RORIE
+    0x97, 0x9B, 0xA9, 0x7A, 0x2A, 0x97, 0xA2, 0xB9, 0x7A, 0x34,  // RORTS ROSES ROSET ROSHI
+    0x97, 0xA4, 0x69, 0x7A, 0x4B, 0x97, 0xAB, 0x49, 0x7A, 0xBA,  // ROSIN ROSIT ROSTI ROSTS
+    0x97, 0xB0, 0x59, 0x7B, 0x06, 0x97, 0xB0, 0xA9, 0x7B, 0x13,  // ROTAL ROTAN ROTAS ROTCH
+    0x97, 0xB2, 0xA9, 0x7B, 0x4A, 0x97, 0xB5, 0xA9, 0x7B, 0x76,  // ROTES ROTIS ROTLS ROTON
+    0x97, 0xB7, 0x99, 0x7B, 0x7A, 0x97, 0xBB, 0x2A, 0x01, 0x90,  // ROTOR ROTOS ROTTE SACRA
+    0xA0, 0x41, 0x2A, 0x04, 0x1A, 0xA0, 0x45, 0xAA, 0x04, 0x62,  // SAICE SAICS SAILS SAINE
+    0xA0, 0x46, 0xAA, 0x04, 0x6B, 0xA0, 0x49, 0xAA, 0x04, 0xAB,  // SAINS SAINT SAIRS SAIST
+    0xA0, 0x4B, 0x3A, 0x05, 0x05, 0xA0, 0x50, 0xBA, 0x05, 0x28,  // SAITH SALAL SALAT SALEP
+    0xA0, 0x52, 0xAA, 0x05, 0x2B, 0xA0, 0x54, 0x1A, 0x05, 0x52,  // SALES SALET SALIC SALLE
+    0xA0, 0x57, 0x5A, 0x05, 0x76, 0xA0, 0x57, 0x8A, 0x05, 0x80,  // SALOL SALON SALOP SALPA
+    0xA0, 0x58, 0xAA, 0x05, 0xA0, 0xA0, 0x5A, 0x2A, 0x05, 0xB7,  // SALPS SALSA SALSE SALTO
+    0xA0, 0x5B, 0xAA, 0x06, 0x29, 0xA0, 0x62, 0xAA, 0x06, 0xA0,  // SALTS SANER SANES SANSA
+    0xA0, 0x6B, 0x7A, 0x06, 0xBA, 0xA0, 0x75, 0x0A, 0x08, 0x06,  // SANTO SANTS SAOLA SAPAN
+    0xA0, 0x87, 0x9A, 0x09, 0x06, 0xA0, 0x92, 0x2A, 0x09, 0x46,  // SAPOR SARAN SAREE SARIN
+    0xA0, 0x94, 0xAA, 0x09, 0x7A, 0xA0, 0xA2, 0x9A, 0x0A, 0x46,  // SARIS SAROS SASER SASIN
+    0xA0, 0xAA, 0x2A, 0x0B, 0x04, 0xA0, 0xB2, 0xAA, 0x0B, 0x46,  // SASSE SATAI SATES SATIN
+    0xA0, 0xB4, 0xAA, 0x10, 0x45, 0xA1, 0x05, 0x0A, 0x10, 0x52,  // SATIS SCAIL SCALA SCALE
+    0xA1, 0x05, 0x5A, 0x10, 0x58, 0xA1, 0x06, 0xAA, 0x10, 0x6B,  // SCALL SCALP SCANS SCANT
+    0xA1, 0x08, 0x0A, 0x10, 0x82, 0xA1, 0x08, 0x4A, 0x10, 0x92,  // SCAPA SCAPE SCAPI SCARE
+    0xA1, 0x09, 0x8A, 0x10, 0x9A, 0xA1, 0x09, 0xBA, 0x10, 0xB3,  // SCARP SCARS SCART SCATH
+    0xA1, 0x0B, 0xAA, 0x10, 0xBB, 0xA1, 0x20, 0xBA, 0x12, 0x60,  // SCATS SCATT SCEAT SCENA
+    0xA1, 0x26, 0x2A, 0x12, 0x6B, 0xA1, 0x47, 0x6A, 0x17, 0x62,  // SCENE SCENT SCION SCONE
+    0xA1, 0x77, 0x8A, 0x17, 0x7B, 0xA1, 0x78, 0x0A, 0x17, 0x82,  // SCOOP SCOOT SCOPA SCOPE
+    0xA1, 0x78, 0xAA, 0x17, 0x92, 0xA1, 0x79, 0x6A, 0x17, 0xBA,  // SCOPS SCORE SCORN SCOTS
+    0xA1, 0x90, 0x2A, 0x19, 0x06, 0xA1, 0x90, 0x8A, 0x19, 0x0B,  // SCRAE SCRAN SCRAP SCRAT
+    0xA1, 0x92, 0x2A, 0x19, 0x48, 0xA2, 0x05, 0xAA, 0x20, 0x6A,  // SCREE SCRIP SEALS SEANS
+    0xA2, 0x09, 0x2A, 0x20, 0x9A, 0xA2, 0x0A, 0x2A, 0x20, 0xBA,  // SEARE SEARS SEASE SEATS
+    0xA2, 0x11, 0x7A, 0x21, 0x3A, 0xA2, 0x1B, 0xAA, 0x22, 0x5A,  // SECCO SECHS SECTS SEELS
+    0xA2, 0x28, 0xAA, 0x22, 0x9A, 0xA2, 0x39, 0x4A, 0x24, 0x5A,  // SEEPS SEERS SEHRI SEILS
+    0xA2, 0x46, 0x2A, 0x24, 0x9A, 0xA2, 0x4A, 0x2A, 0x25, 0x03,  // SEINE SEIRS SEISE SELAH
+    0xA2, 0x52, 0xAA, 0x25, 0x50, 0xA2, 0x55, 0x2A, 0x25, 0x5A,  // SELES SELLA SELLE SELLS
+    0xA2, 0x60, 0xAA, 0x26, 0x2A, 0xA2, 0x66, 0x0A, 0x26, 0x79,  // SENAS SENES SENNA SENOR
+    0xA2, 0x6A, 0x0A, 0x26, 0xA2, 0xA2, 0x6A, 0x4A, 0x26, 0xB2,  // SENSA SENSE SENSI SENTE
+    0xA2, 0x6B, 0x4A, 0x26, 0xBA, 0xA2, 0x80, 0x5A, 0x28, 0x40,  // SENTI SENTS SEPAL SEPIA
+    0xA2, 0x84, 0x1A, 0x28, 0xB0, 0xA2, 0x8B, 0xAA, 0x29, 0x01,  // SEPIC SEPTA SEPTS SERAC
+    0xA2, 0x90, 0x4A, 0x29, 0x05, 0xA2, 0x92, 0x9A, 0x29, 0x2A,  // SERAI SERAL SERER SERES
+    0xA2, 0x94, 0x1A, 0x29, 0x46, 0xA2, 0x97, 0x6A, 0x29, 0x90,  // SERIC SERIN SERON SERRA
+    0xA2, 0x99, 0x2A, 0x29, 0x9A, 0xA2, 0xAA, 0x0A, 0x2B, 0x02,  // SERRE SERRS SESSA SETAE
+    0xA2, 0xB0, 0x5A, 0x2B, 0x76, 0xA2, 0xBB, 0xAA, 0x30, 0x3A,  // SETAL SETON SETTS SHAHS
+    0xA3, 0x05, 0x2A, 0x30, 0x55, 0xA3, 0x05, 0xBA, 0x30, 0x6A,  // SHALE SHALL SHALT SHANS
+    0xA3, 0x08, 0x2A, 0x30, 0x8A, 0xA3, 0x09, 0x2A, 0x30, 0x96,  // SHAPE SHAPS SHARE SHARN
+    0xA3, 0x09, 0x8A, 0x30, 0xA3, 0xA3, 0x13, 0x4A, 0x32, 0x05,  // SHARP SHASH SHCHI SHEAL
+    0xA3, 0x20, 0x9A, 0x32, 0x0A, 0xA3, 0x22, 0x5A, 0x32, 0x26,  // SHEAR SHEAS SHEEL SHEEN
+    0xA3, 0x22, 0x8A, 0x32, 0x29, 0xA3, 0x22, 0xBA, 0x32, 0x55,  // SHEEP SHEER SHEET SHELL
+    0xA3, 0x26, 0xBA, 0x32, 0x75, 0xA3, 0x29, 0x2A, 0x32, 0x97,  // SHENT SHEOL SHERE SHERO
+    0xA3, 0x2B, 0xAA, 0x34, 0x04, 0xA3, 0x42, 0x5A, 0x34, 0x29,  // SHETS SHIAI SHIEL SHIER
+    0xA3, 0x42, 0xAA, 0x34, 0x55, 0xA3, 0x46, 0x2A, 0x34, 0x6A,  // SHIES SHILL SHINE SHINS
+    0xA3, 0x48, 0xAA, 0x34, 0x92, 0xA3, 0x49, 0x9A, 0x34, 0x9A,  // SHIPS SHIRE SHIRR SHIRS
+    0xA3, 0x49, 0xBA, 0x34, 0xA3, 0xA3, 0x4A, 0x7A, 0x34, 0xAB,  // SHIRT SHISH SHISO SHIST
+    0xA3, 0x4B, 0x2A, 0x34, 0xBA, 0xA3, 0x52, 0x8A, 0x37, 0x05,  // SHITE SHITS SHLEP SHOAL
+    0xA3, 0x70, 0xBA, 0x37, 0x29, 0xA3, 0x72, 0xAA, 0x37, 0x50,  // SHOAT SHOER SHOES SHOLA
+    0xA3, 0x76, 0x2A, 0x37, 0x75, 0xA3, 0x77, 0x6A, 0x37, 0x7A,  // SHONE SHOOL SHOON SHOOS
+    0xA3, 0x77, 0xBA, 0x37, 0x82, 0xA3, 0x78, 0xAA, 0x37, 0x92,  // SHOOT SHOPE SHOPS SHORE
+    0xA3, 0x79, 0x5A, 0x37, 0x96, 0xA3, 0x79, 0xBA, 0x37, 0xB2,  // SHORL SHORN SHORT SHOTE
+    0xA3, 0x7B, 0xAA, 0x37, 0xBB, 0xA3, 0x94, 0xAA, 0x40, 0x5A,  // SHOTS SHOTT SHRIS SIALS
+    0xA4, 0x12, 0xAA, 0x41, 0x3B, 0xA4, 0x26, 0xAA, 0x42, 0x6B,  // SICES SICHT SIENS SIENT
+    0xA4, 0x2B, 0x3A, 0x45, 0x26, 0xA4, 0x52, 0x9A, 0x45, 0x2A,  // SIETH SILEN SILER SILES
+    0xA4, 0x55, 0xAA, 0x45, 0x7A, 0xA4, 0x5B, 0xAA, 0x46, 0x12,  // SILLS SILOS SILTS SINCE
+    0xA4, 0x62, 0xAA, 0x46, 0x3A, 0xA4, 0x82, 0xAA, 0x49, 0x22,  // SINES SINHS SIPES SIREE
+    0xA4, 0x92, 0x6A, 0x49, 0x2A, 0xA4, 0x94, 0x3A, 0x49, 0x4A,  // SIREN SIRES SIRIH SIRIS
+    0xA4, 0x97, 0x1A, 0x49, 0x90, 0xA4, 0xA0, 0x5A, 0x4A, 0x2A,  // SIROC SIRRA SISAL SISES
+    0xA4, 0xAB, 0x0A, 0x4A, 0xBA, 0xA4, 0xB0, 0x9A, 0x4B, 0x2A,  // SISTA SISTS SITAR SITES
+    0xA4, 0xB3, 0x2A, 0x50, 0x2A, 0xA5, 0x04, 0x6A, 0x50, 0x62,  // SITHE SLAES SLAIN SLANE
+    0xA5, 0x06, 0xBA, 0x50, 0x8A, 0xA5, 0x09, 0xBA, 0x50, 0xA3,  // SLANT SLAPS SLART SLASH
+    0xA5, 0x0B, 0x2A, 0x50, 0xBA, 0xA5, 0x22, 0x8A, 0x52, 0x29,  // SLATE SLATS SLEEP SLEER
+    0xA5, 0x22, 0xBA, 0x52, 0x8B, 0xA5, 0x41, 0x2A, 0x54, 0x29,  // SLEET SLEPT SLICE SLIER
+    0xA5, 0x48, 0x2A, 0x54, 0x8A, 0xA5, 0x48, 0xBA, 0x54, 0xA3,  // SLIPE SLIPS SLIPT SLISH
+    0xA5, 0x4B, 0xAA, 0x57, 0x06, 0xA5, 0x72, 0xAA, 0x57, 0x78,  // SLITS SLOAN SLOES SLOOP
+    0xA5, 0x77, 0xBA, 0x57, 0x82, 0xA5, 0x78, 0xAA, 0x57, 0xA3,  // SLOOT SLOPE SLOPS SLOSH
+    0xA5, 0x7B, 0x3A, 0x57, 0xBA, 0xA6, 0x04, 0x5A, 0x60, 0x8A,  // SLOTH SLOTS SNAIL SNAPS
+    0xA6, 0x09, 0x2A, 0x60, 0x95, 0xA6, 0x09, 0xAA, 0x60, 0xA3,  // SNARE SNARL SNARS SNASH
+    0xA6, 0x0B, 0x3A, 0x62, 0x08, 0xA6, 0x22, 0x9A, 0x62, 0x2A,  // SNATH SNEAP SNEER SNEES
+    0xA6, 0x25, 0x5A, 0x64, 0x2A, 0xA6, 0x48, 0x2A, 0x64, 0x8A,  // SNELL SNIES SNIPE SNIPS
+    0xA6, 0x49, 0xBA, 0x64, 0xBA, 0xA6, 0x72, 0x8A, 0x67, 0x75,  // SNIRT SNITS SNOEP SNOOL
+    0xA6, 0x77, 0x8A, 0x67, 0x7B, 0xA6, 0x79, 0x2A, 0x67, 0x9B,  // SNOOP SNOOT SNORE SNORT
+    0xA6, 0x7B, 0xAA, 0x70, 0x8A, 0xA7, 0x09, 0x2A, 0x70, 0x9A,  // SNOTS SOAPS SOARE SOARS
+    0xA7, 0x10, 0xAA, 0x71, 0x2A, 0xA7, 0x15, 0x2A, 0x74, 0x5A,  // SOCAS SOCES SOCLE SOILS
+    0xA7, 0x50, 0x3A, 0x75, 0x06, 0xA7, 0x50, 0x9A, 0x75, 0x0A,  // SOLAH SOLAN SOLAR SOLAS
+    0xA7, 0x52, 0x4A, 0x75, 0x29, 0xA7, 0x52, 0xAA, 0x75, 0x76,  // SOLEI SOLER SOLES SOLON
+    0xA7, 0x57, 0xAA, 0x76, 0x09, 0xA7, 0x61, 0x2A, 0x76, 0x2A,  // SOLOS SONAR SONCE SONES
+    0xA7, 0x64, 0x1A, 0x76, 0x62, 0xA7, 0x6A, 0x2A, 0x77, 0x52,  // SONIC SONNE SONSE SOOLE
+    0xA7, 0x75, 0xAA, 0x77, 0x8A, 0xA7, 0x7B, 0x2A, 0x77, 0xB3,  // SOOLS SOOPS SOOTE SOOTH
+    0xA7, 0x7B, 0xAA, 0x78, 0x3A, 0xA7, 0x87, 0x9A, 0x78, 0x90,  // SOOTS SOPHS SOPOR SOPRA
+    0xA7, 0x90, 0x5A, 0x79, 0x0A, 0xA7, 0x92, 0x2A, 0x79, 0x25,  // SORAL SORAS SOREE SOREL
+    0xA7, 0x92, 0x9A, 0x79, 0x2A, 0xA7, 0x96, 0xAA, 0x79, 0x90,  // SORER SORES SORNS SORRA
+    0xA7, 0x9B, 0x0A, 0x79, 0xBA, 0xA7, 0xB3, 0xAA, 0x7B, 0x75,  // SORTA SORTS SOTHS SOTOL
+    0xA8, 0x01, 0x2A, 0x80, 0x29, 0xA8, 0x02, 0xAA, 0x80, 0x34,  // SPACE SPAER SPAES SPAHI
+    0xA8, 0x04, 0x5A, 0x80, 0x46, 0xA8, 0x04, 0xBA, 0x80, 0x52,  // SPAIL SPAIN SPAIT SPALE
+    0xA8, 0x05, 0x5A, 0x80, 0x5B, 0xA8, 0x06, 0x2A, 0x80, 0x6A,  // SPALL SPALT SPANE SPANS
+    0xA8, 0x09, 0x2A, 0x80, 0x9A, 0xA8, 0x09, 0xBA, 0x80, 0xB2,  // SPARE SPARS SPART SPATE
+    0xA8, 0x0B, 0xAA, 0x82, 0x05, 0xA8, 0x20, 0x6A, 0x82, 0x09,  // SPATS SPEAL SPEAN SPEAR
+    0xA8, 0x20, 0xBA, 0x82, 0x1A, 0xA8, 0x21, 0xBA, 0x82, 0x25,  // SPEAT SPECS SPECT SPEEL
+    0xA8, 0x22, 0x9A, 0x82, 0x45, 0xA8, 0x24, 0x9A, 0x82, 0x55,  // SPEER SPEIL SPEIR SPELL
+    0xA8, 0x25, 0xBA, 0x82, 0x6B, 0xA8, 0x27, 0xAA, 0x82, 0xBA,  // SPELT SPENT SPEOS SPETS
+    0xA8, 0x40, 0x5A, 0x84, 0x10, 0xA8, 0x41, 0x2A, 0x84, 0x1A,  // SPIAL SPICA SPICE SPICS
+    0xA8, 0x42, 0x5A, 0x84, 0x29, 0xA8, 0x42, 0xAA, 0x84, 0x52,  // SPIEL SPIER SPIES SPILE
+    0xA8, 0x45, 0x5A, 0x84, 0x5B, 0xA8, 0x46, 0x0A, 0x84, 0x62,  // SPILL SPILT SPINA SPINE
+    0xA8, 0x46, 0xAA, 0x84, 0x92, 0xA8, 0x49, 0xBA, 0x84, 0xB2,  // SPINS SPIRE SPIRT SPITE
+    0xA8, 0x4B, 0xAA, 0x85, 0x0B, 0xA8, 0x54, 0xBA, 0x87, 0x45,  // SPITS SPLAT SPLIT SPOIL
+    0xA8, 0x77, 0x5A, 0x87, 0x76, 0xA8, 0x77, 0x9A, 0x87, 0x7B,  // SPOOL SPOON SPOOR SPOOT
+    0xA8, 0x79, 0x2A, 0x87, 0x9B, 0xA8, 0x7A, 0x3A, 0x87, 0xBA,  // SPORE SPORT SPOSH SPOTS
+    0xA8, 0x90, 0xBA, 0x89, 0x22, 0xA8, 0x94, 0xBA, 0xB0, 0x46,  // SPRAT SPREE SPRIT STAIN
+    0xAB, 0x04, 0x9A, 0xB0, 0x52, 0xAB, 0x05, 0x5A, 0xB0, 0x62,  // STAIR STALE STALL STANE
+    0xAB, 0x08, 0x3A, 0xB0, 0x8A, 0xAB, 0x09, 0x2A, 0xB0, 0x96,  // STAPH STAPS STARE STARN
+    0xAB, 0x09, 0x9A, 0xB0, 0x9A, 0xAB, 0x09, 0xBA, 0xB0, 0xA3,  // STARR STARS START STASH
+    0xAB, 0x0B, 0x2A, 0xB0, 0xBA, 0xAB, 0x20, 0x5A, 0xB2, 0x06,  // STATE STATS STEAL STEAN
+    0xAB, 0x20, 0x9A, 0xB2, 0x25, 0xAB, 0x22, 0x6A, 0xB2, 0x28,  // STEAR STEEL STEEN STEEP
+    0xAB, 0x22, 0x9A, 0xB2, 0x45, 0xAB, 0x24, 0x6A, 0xB2, 0x50,  // STEER STEIL STEIN STELA
+    0xAB, 0x25, 0x2A, 0xB2, 0x55, 0xAB, 0x26, 0x7A, 0xB2, 0x6A,  // STELE STELL STENO STENS
+    0xAB, 0x26, 0xBA, 0xB2, 0x8A, 0xAB, 0x28, 0xBA, 0xB2, 0x92,  // STENT STEPS STEPT STERE
+    0xAB, 0x29, 0x6A, 0xB2, 0xBA, 0xAB, 0x41, 0x3A, 0xB4, 0x2A,  // STERN STETS STICH STIES
+    0xAB, 0x45, 0x2A, 0xB4, 0x55, 0xAB, 0x45, 0xBA, 0xB4, 0x6B,  // STILE STILL STILT STINT
+    0xAB, 0x48, 0x0A, 0xB4, 0x82, 0xAB, 0x49, 0x2A, 0xB4, 0x98,  // STIPA STIPE STIRE STIRP
+    0xAB, 0x49, 0xAA, 0xB7, 0x02, 0xAB, 0x70, 0x4A, 0xB7, 0x0A,  // STIRS STOAE STOAI STOAS
+    0xAB, 0x70, 0xBA, 0xB7, 0x28, 0xAB, 0x74, 0x1A, 0xB7, 0x4B,  // STOAT STOEP STOIC STOIT
+    0xAB, 0x75, 0x2A, 0xB7, 0x56, 0xAB, 0x76, 0x2A, 0xB7, 0x66,  // STOLE STOLN STONE STONN
+    0xAB, 0x77, 0x5A, 0xB7, 0x78, 0xAB, 0x77, 0x9A, 0xB7, 0x82,  // STOOL STOOP STOOR STOPE
+    0xAB, 0x78, 0xAA, 0xB7, 0x8B, 0xAB, 0x79, 0x2A, 0xB7, 0xAA,  // STOPS STOPT STORE STOSS
+    0xAB, 0x7B, 0xAA, 0xB7, 0xBB, 0xAB, 0x90, 0x2A, 0xB9, 0x08,  // STOTS STOTT STRAE STRAP
+    0xAB, 0x92, 0x8A, 0xB9, 0x40, 0xAB, 0x94, 0x8A, 0xB9, 0x78,  // STREP STRIA STRIP STROP
+    0xB0, 0x05, 0xAB, 0x00, 0xB0, 0xB0, 0x10, 0x6B, 0x01, 0x2A,  // TAALS TAATA TACAN TACES
+    0xB0, 0x12, 0xBB, 0x01, 0x32, 0xB0, 0x13, 0x7B, 0x01, 0x3A,  // TACET TACHE TACHO TACHS
+    0xB0, 0x14, 0xBB, 0x01, 0x7A, 0xB0, 0x1B, 0xAB, 0x02, 0x5A,  // TACIT TACOS TACTS TAELS
+    0xB0, 0x30, 0xAB, 0x03, 0x9A, 0xB0, 0x45, 0xAB, 0x04, 0x6A,  // TAHAS TAHRS TAILS TAINS
+    0xB0, 0x46, 0xBB, 0x04, 0x90, 0xB0, 0x4A, 0x3B, 0x04, 0xBA,  // TAINT TAIRA TAISH TAITS
+    0xB0, 0x50, 0x9B, 0x05, 0x0A, 0xB0, 0x51, 0xAB, 0x05, 0x20,  // TALAR TALAS TALCS TALEA
+    0xB0, 0x52, 0x9B, 0x05, 0x2A, 0xB0, 0x55, 0xAB, 0x05, 0x76,  // TALER TALES TALLS TALON
+    0xB0, 0x58, 0x0B, 0x06, 0x0A, 0xB0, 0x63, 0xAB, 0x06, 0x60,  // TALPA TANAS TANHS TANNA
+    0xB0, 0x6B, 0x4B, 0x06, 0xB7, 0xB0, 0x80, 0xAB, 0x08, 0x26,  // TANTI TANTO TAPAS TAPEN
+    0xB0, 0x82, 0x9B, 0x08, 0x2A, 0xB0, 0x82, 0xBB, 0x08, 0x49,  // TAPER TAPES TAPET TAPIR
+    0xB0, 0x84, 0xAB, 0x08, 0x80, 0xB0, 0x90, 0xAB, 0x09, 0x2A,  // TAPIS TAPPA TARAS TARES
+    0xB0, 0x96, 0xAB, 0x09, 0x71, 0xB0, 0x97, 0xAB, 0x09, 0x7B,  // TARNS TAROC TAROS TAROT
+    0xB0, 0x98, 0xAB, 0x09, 0x92, 0xB0, 0x9A, 0x4B, 0x09, 0xBA,  // TARPS TARRE TARSI TARTS
+    0xB0, 0xA0, 0x9B, 0x0A, 0x29, 0xB0, 0xA2, 0xAB, 0x0A, 0xA0,  // TASAR TASER TASES TASSA
+    0xB0, 0xAA, 0x2B, 0x0A, 0xA7, 0xB0, 0xAB, 0x2B, 0x0B, 0x09,  // TASSE TASSO TASTE TATAR
+    0xB0, 0xB2, 0x9B, 0x0B, 0x2A, 0xB0, 0xB3, 0xAB, 0x0B, 0x42,  // TATER TATES TATHS TATIE
+    0xB0, 0xBB, 0xAB, 0x20, 0x13, 0xB2, 0x05, 0xAB, 0x20, 0x9A,  // TATTS TEACH TEALS TEARS
+    0xB2, 0x0A, 0x2B, 0x20, 0xBA, 0xB2, 0x13, 0xAB, 0x21, 0xB0,  // TEASE TEATS TECHS TECTA
+    0xB2, 0x25, 0xAB, 0x22, 0x62, 0xB2, 0x26, 0xAB, 0x22, 0x9A,  // TEELS TEENE TEENS TEERS
+    0xB2, 0x2B, 0x3B, 0x23, 0x9A, 0xB2, 0x45, 0xAB, 0x24, 0x6A,  // TEETH TEHRS TEILS TEINS
+    0xB2, 0x50, 0x2B, 0x25, 0x17, 0xB2, 0x52, 0xAB, 0x25, 0x40,  // TELAE TELCO TELES TELIA
+    0xB2, 0x54, 0x1B, 0x25, 0x5A, 0xB2, 0x57, 0x4B, 0x25, 0x7A,  // TELIC TELLS TELOI TELOS
+    0xB2, 0x61, 0x3B, 0x26, 0x2A, 0xB2, 0x62, 0xBB, 0x26, 0x40,  // TENCH TENES TENET TENIA
+    0xB2, 0x66, 0x2B, 0x26, 0x67, 0xB2, 0x67, 0x6B, 0x26, 0x79,  // TENNE TENNO TENON TENOR
+    0xB2, 0x6A, 0x2B, 0x26, 0xB3, 0xB2, 0x6B, 0xAB, 0x28, 0x05,  // TENSE TENTH TENTS TEPAL
+    0xB2, 0x80, 0xAB, 0x28, 0x22, 0xB2, 0x90, 0x4B, 0x29, 0x0A,  // TEPAS TEPEE TERAI TERAS
+    0xB2, 0x91, 0x2B, 0x29, 0x2A, 0xB2, 0x96, 0x2B, 0x29, 0x6A,  // TERCE TERES TERNE TERNS
+    0xB2, 0x99, 0x0B, 0x29, 0xA2, 0xB2, 0x9B, 0xAB, 0x2A, 0x50,  // TERRA TERSE TERTS TESLA
+    0xB2, 0xAB, 0x0B, 0x2A, 0xB2, 0xB2, 0xAB, 0xAB, 0x2B, 0x2A,  // TESTA TESTE TESTS TETES
+    0xB2, 0xB3, 0xAB, 0x2B, 0x90, 0xB2, 0xB9, 0x4B, 0x30, 0x52,  // TETHS TETRA TETRI THALE
+    0xB3, 0x05, 0x4B, 0x30, 0x60, 0xB3, 0x06, 0x2B, 0x30, 0x6A,  // THALI THANA THANE THANS
+    0xB3, 0x09, 0xAB, 0x32, 0x10, 0xB3, 0x22, 0xAB, 0x32, 0x41,  // THARS THECA THEES THEIC
+    0xB3, 0x24, 0x6B, 0x32, 0x49, 0xB3, 0x26, 0xAB, 0x32, 0x92,  // THEIN THEIR THENS THERE
+    0xB3, 0x2A, 0x2B, 0x32, 0xA8, 0xB3, 0x2B, 0x0B, 0x32, 0xB2,  // THESE THESP THETA THETE
+    0xB3, 0x45, 0x5B, 0x34, 0x62, 0xB3, 0x46, 0xAB, 0x34, 0x75,  // THILL THINE THINS THIOL
+    0xB3, 0x49, 0x5B, 0x37, 0x52, 0xB3, 0x75, 0x4B, 0x37, 0x96,  // THIRL THOLE THOLI THORN
+    0xB3, 0x79, 0x7B, 0x37, 0x98, 0xB3, 0x7A, 0x2B, 0x39, 0x02,  // THORO THORP THOSE THRAE
+    0xB3, 0x92, 0x2B, 0x39, 0x48, 0xB3, 0x97, 0x2B, 0x40, 0x6A,  // THREE THRIP THROE TIANS
+    0xB4, 0x09, 0x0B, 0x40, 0x9A, 0xB4, 0x10, 0x5B, 0x41, 0x10,  // TIARA TIARS TICAL TICCA
+    0xB4, 0x12, 0xAB, 0x42, 0x9A, 0xB4, 0x52, 0x9B, 0x45, 0x2A,  // TICES TIERS TILER TILES
+    0xB4, 0x55, 0xAB, 0x45, 0xB3, 0xB4, 0x5B, 0xAB, 0x46, 0x0A,  // TILLS TILTH TILTS TINAS
+    0xB4, 0x61, 0xBB, 0x46, 0x20, 0xB4, 0x62, 0xAB, 0x46, 0xBA,  // TINCT TINEA TINES TINTS
+    0xB4, 0x84, 0xAB, 0x49, 0x2A, 0xB4, 0x95, 0xAB, 0x49, 0x7A,  // TIPIS TIRES TIRLS TIROS
+    0xB4, 0x99, 0xAB, 0x4B, 0x06, 0xB4, 0xB1, 0x3B, 0x4B, 0x29,  // TIRRS TITAN TITCH TITER
+    0xB4, 0xB3, 0x2B, 0x4B, 0x4A, 0xB4, 0xB5, 0x2B, 0x4B, 0x92,  // TITHE TITIS TITLE TITRE
+    0xB7, 0x0A, 0xBB, 0x71, 0x7A, 0xB7, 0x20, 0xAB, 0x73, 0x7A,  // TOAST TOCOS TOEAS TOHOS
+    0xB7, 0x45, 0x2B, 0x74, 0x5A, 0xB7, 0x4A, 0x2B, 0x74, 0xBA,  // TOILE TOILS TOISE TOITS
+    0xB7, 0x50, 0x6B, 0x75, 0x09, 0xB7, 0x50, 0xAB, 0x75, 0x2A,  // TOLAN TOLAR TOLAS TOLES
+    0xB7, 0x55, 0xAB, 0x75, 0xBA, 0xB7, 0x60, 0x5B, 0x76, 0x29,  // TOLLS TOLTS TONAL TONER
+    0xB7, 0x62, 0xAB, 0x76, 0x41, 0xB7, 0x66, 0x2B, 0x77, 0x5A,  // TONES TONIC TONNE TOOLS
+    0xB7, 0x76, 0xAB, 0x77, 0xB3, 0xB7, 0x7B, 0xAB, 0x78, 0x22,  // TOONS TOOTH TOOTS TOPEE
+    0xB7, 0x82, 0x9B, 0x78, 0x2A, 0xB7, 0x83, 0x2B, 0x78, 0x34,  // TOPER TOPES TOPHE TOPHI
+    0xB7, 0x83, 0xAB, 0x78, 0x41, 0xB7, 0x84, 0xAB, 0x78, 0x74,  // TOPHS TOPIC TOPIS TOPOI
+    0xB7, 0x87, 0xAB, 0x79, 0x03, 0xB7, 0x90, 0x6B, 0x79, 0x0A,  // TOPOS TORAH TORAN TORAS
+    0xB7, 0x91, 0x3B, 0x79, 0x1A, 0xB7, 0x92, 0xAB, 0x79, 0x41,  // TORCH TORCS TORES TORIC
+    0xB7, 0x94, 0x4B, 0x79, 0x7A, 0xB7, 0x97, 0xBB, 0x79, 0x9A,  // TORII TOROS TOROT TORRS
+    0xB7, 0x9A, 0x2B, 0x79, 0xA4, 0xB7, 0x9A, 0x7B, 0x79, 0xB0,  // TORSE TORSI TORSO TORTA
+    0xB7, 0x9B, 0x2B, 0x79, 0xBA, 0xB7, 0xA0, 0xAB, 0x7A, 0x2A,  // TORTE TORTS TOSAS TOSES
+    0xB7, 0xB0, 0x5B, 0x7B, 0x29, 0xB7, 0xB2, 0xAB, 0x90, 0x12,  // TOTAL TOTER TOTES TRACE
+    0xB9, 0x01, 0xBB, 0x90, 0x45, 0xB9, 0x04, 0x6B, 0x90, 0x4B,  // TRACT TRAIL TRAIN TRAIT
+    0xB9, 0x06, 0xAB, 0x90, 0x6B, 0xB9, 0x08, 0x2B, 0x90, 0x8A,  // TRANS TRANT TRAPE TRAPS
+    0xB9, 0x08, 0xBB, 0x90, 0xA3, 0xB9, 0x0A, 0xAB, 0x90, 0xBA,  // TRAPT TRASH TRASS TRATS
+    0xB9, 0x0B, 0xBB, 0x92, 0x0B, 0xB9, 0x22, 0x6B, 0x92, 0x2A,  // TRATT TREAT TREEN TREES
+    0xB9, 0x2A, 0xAB, 0x92, 0xAB, 0xB9, 0x2B, 0xAB, 0x94, 0x01,  // TRESS TREST TRETS TRIAC
+    0xB9, 0x40, 0x5B, 0x94, 0x12, 0xB9, 0x42, 0x9B, 0x94, 0x2A,  // TRIAL TRICE TRIER TRIES
+    0xB9, 0x45, 0x5B, 0x94, 0x62, 0xB9, 0x46, 0xAB, 0x94, 0x75,  // TRILL TRINE TRINS TRIOL
+    0xB9, 0x47, 0x9B, 0x94, 0x7A, 0xB9, 0x48, 0x2B, 0x94, 0x8A,  // TRIOR TRIOS TRIPE TRIPS
+    0xB9, 0x4A, 0xBB, 0x94, 0xB2, 0xB9, 0x70, 0xBB, 0x97, 0x4A,  // TRIST TRITE TROAT TROIS
+    0xB9, 0x75, 0x5B, 0x97, 0x60, 0xB9, 0x76, 0x1B, 0x97, 0x62,  // TROLL TRONA TRONC TRONE
+    0xB9, 0x76, 0xAB, 0x97, 0x78, 0xB9, 0x78, 0x2B, 0x97, 0xB3,  // TRONS TROOP TROPE TROTH
+    0xB9, 0x7B, 0xAB, 0xA0, 0x9A,  // TROTS TSARS
 };
+#endif
+
+static inline uint32_t _wordle_code_at(const uint8_t *packed, uint16_t index) {
+    uint32_t nibble = (uint32_t)index * WORDLE_LENGTH;
+    const uint8_t *bytes = packed + nibble / 2;
+    // a word spans three bytes, starting on either half of the first one.
+    uint32_t bits = ((uint32_t)bytes[0] << 16) | ((uint32_t)bytes[1] << 8) | bytes[2];
+    return (nibble & 1) ? (bits & 0xFFFFF) : (bits >> 4);
+}
+
+static inline uint8_t _wordle_letter_of(uint32_t code, uint8_t position) {
+    return (code >> (4 * (WORDLE_LENGTH - 1 - position))) & 0xF;
+}
+
+#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
+// Returns the word's index in _dict_words, or WORDLE_NUM_DICT_WORDS if it isn't a word.
+static inline uint16_t _wordle_dict_find(uint32_t code) {
+    uint16_t low = 0;
+    uint16_t high = WORDLE_NUM_DICT_WORDS;
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        uint32_t mid_code = _wordle_code_at(_dict_words, mid);
+        if (mid_code == code) return mid;
+        if (mid_code < code) low = mid + 1;
+        else high = mid;
+    }
+    return WORDLE_NUM_DICT_WORDS;
+}
+#endif
 
 #if (WORDLE_USE_RANDOM_GUESS == 3)
 static const uint16_t _num_random_guess_words = 13;  // The valid_words array begins with this many words that are considered the top 3% best options.
 #elif (WORDLE_USE_RANDOM_GUESS == 2)
 static const uint16_t _num_random_guess_words = 257;  // The valid_words array begins with this many words where each letter is different.
 #elif (WORDLE_USE_RANDOM_GUESS == 1)
-static const uint16_t _num_random_guess_words = _num_words;
+static const uint16_t _num_random_guess_words = WORDLE_NUM_WORDS;
 #endif
 
-#endif // WORDLE_FACE_DICT_H_
\ No newline at end of file
+#endif // WORDLE_FACE_DICT_H_
@@ -371,6 +371,8 @@ static void _lis2dw_get_state(lis2dw_device_state_t *ds)
 
 static void _lis2dw_set_state(lis2dw_device_state_t *ds)
 {
+    /* Write CTRL1 and CTRL6 in one burst instead of seven read-modify-writes. */
+    lis2dw_begin_configuration();
     lis2dw_set_mode(ds->mode);
     lis2dw_set_data_rate(ds->data_rate);
     lis2dw_set_low_power_mode(ds->low_power);
@@ -378,6 +380,7 @@ static void _lis2dw_set_state(lis2dw_device_state_t *ds)
     lis2dw_set_range(ds->range);
     lis2dw_set_filter_type(ds->filter);
     lis2dw_set_low_noise_mode(ds->low_noise);
+    lis2dw_commit_configuration();
 
     /* Additionally, set the background rate to the data rate. */
     movement_set_accelerometer_background_rate(ds->data_rate);
@@ -569,6 +572,9 @@ void lis2dw_monitor_face_activate(void *context)
 {
     lis2dw_monitor_state_t *state = (lis2dw_monitor_state_t *) context;
 
+    /* Keep the I2C bus powered while we're on screen; we read the fifo every tick. */
+    watch_enable_i2c();
+
     /* Setup lis2dw to run in background at 12.5 Hz sampling rate. */
     movement_set_accelerometer_background_rate(LIS2DW_DATA_RATE_12_5_HZ);
 
@@ -602,6 +608,7 @@ void lis2dw_monitor_face_resign(void *context)
     (void) context;
     lis2dw_clear_fifo();
     lis2dw_disable_fifo();
+    watch_disable_i2c();
 }
 
 movement_watch_face_advisory_t lis2dw_monitor_face_advise(void *context)
@@ -22,10 +22,12 @@
  * SOFTWARE.
  */
 
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include "temperature_logging_face.h"
 #include "watch.h"
+#include "watch_utility.h"
 
 static bool skip = false;
 
@@ -36,6 +38,24 @@ static void _temperature_logging_face_log_data(temperature_logging_state_t *logg
     logger_state->data[pos].timestamp.reg = date_time.reg;
     logger_state->data[pos].temperature_c = movement_get_temperature();
     logger_state->data_points++;
+
+    filesystem_log_append(&logger_state->log, watch_utility_date_time_to_unix_time(date_time, 0), lroundf(logger_state->data[pos].temperature_c * 10));
+    if (logger_state->data_points % TEMPERATURE_LOGGING_FLUSH_INTERVAL == 0) filesystem_log_flush(&logger_state->log);
+}
+
+static void _temperature_logging_face_load_log(temperature_logging_state_t *logger_state) {
+    filesystem_log_reader_t reader;
+    uint32_t timestamp;
+    int32_t tenths;
+
+    // the log holds more than the ring does; only the newest readings are left once it's read through.
+    filesystem_log_reader_init(&reader, TEMPERATURE_LOGGING_FILENAME);
+    while (filesystem_log_read(&reader, &timestamp, &tenths)) {
+        size_t pos = logger_state->data_points % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
+        logger_state->data[pos].timestamp = watch_utility_date_time_from_unix_time(timestamp, 0);
+        logger_state->data[pos].temperature_c = tenths / 10.0f;
+        logger_state->data_points++;
+    }
 }
 
 static void _temperature_logging_face_update_display(temperature_logging_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h) {
@@ -88,8 +108,11 @@ void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_pt
     if (movement_get_temperature() == 0xFFFFFFFF) skip = true;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(temperature_logging_state_t));
-        memset(*context_ptr, 0, sizeof(temperature_logging_state_t));
+        temperature_logging_state_t *logger_state = malloc(sizeof(temperature_logging_state_t));
+        memset(logger_state, 0, sizeof(temperature_logging_state_t));
+        filesystem_log_writer_init(&logger_state->log, TEMPERATURE_LOGGING_FILENAME, TEMPERATURE_LOGGING_MAX_LOG_SIZE);
+        if (!skip) _temperature_logging_face_load_log(logger_state);
+        *context_ptr = logger_state;
     }
 }
 
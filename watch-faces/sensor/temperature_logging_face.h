@@ -52,12 +52,21 @@
  *
  * If you need to illuminate the LED to read the data point, long press the
  * Light button and release it.
+ *
+ * Readings are also kept in a compact log on the filesystem, templog.log, in
+ * tenths of a degree Celsius, so the last 36 hours survive a reset. The log
+ * is written every six readings, and `logcat templog.log` prints it.
  */
 
 #include "movement.h"
 #include "watch.h"
+#include "filesystem_log.h"
 
 #define TEMPERATURE_LOGGING_NUM_DATA_POINTS (36)
+#define TEMPERATURE_LOGGING_FILENAME "templog.log"
+// enough for about 60 hours of readings at one block every six hours.
+#define TEMPERATURE_LOGGING_MAX_LOG_SIZE (256)
+#define TEMPERATURE_LOGGING_FLUSH_INTERVAL (6)
 
 typedef struct {
     watch_date_time_t timestamp;
@@ -69,6 +78,7 @@ typedef struct {
     uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
     int32_t data_points;    // the absolute number of data points logged
     thermistor_logger_data_point_t data[TEMPERATURE_LOGGING_NUM_DATA_POINTS];
+    filesystem_log_writer_t log;
 } temperature_logging_state_t;
 
 void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_ptr);
@@ -28,9 +28,15 @@
 #include "watch.h"
 
 static void _voltage_face_update_display(void) {
-    float voltage = (float)watch_get_vcc_voltage() / 1000.0;
+    uint16_t millivolts = watch_get_vcc_voltage();
+    float voltage = (float)millivolts / 1000.0;
 
-    watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "BAT", "BA");
+    // tell the wearer if the power governor is limiting the LED and buzzer.
+    if (movement_get_power_level() == MOVEMENT_POWER_LEVEL_NORMAL) {
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "BAT", "BA");
+    } else {
+        watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOW", "LO");
+    }
     watch_display_float_with_best_effort(voltage, " V");
 }
 
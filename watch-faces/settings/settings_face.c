@@ -161,6 +161,25 @@ static void led_duration_setting_advance(void) {
     }
 }
 
+// LED calibration steps, as the PWM level (out of 255) at which a channel is fully lit: 100%, 80%, 60%, 45%, 30%, 20%.
+static const uint8_t led_calibration_steps[] = {255, 204, 153, 115, 77, 51};
+
+static uint8_t next_led_calibration(uint8_t calibration) {
+    for (size_t i = 0; i < sizeof(led_calibration_steps) - 1; i++) {
+        if (calibration >= led_calibration_steps[i]) return led_calibration_steps[i + 1];
+    }
+    return led_calibration_steps[0];
+}
+
+static void display_led_calibration(uint8_t calibration) {
+    // blank at full brightness, otherwise the percentage of full scale.
+    if (calibration < 255) {
+        char buf[4];
+        sprintf(buf, "%2d", (calibration * 100 + 127) / 255);
+        watch_display_text(WATCH_POSITION_SECONDS, buf);
+    }
+}
+
 static void red_led_setting_display(uint8_t subsecond) {
     char buf[8];
     movement_color_t color = movement_backlight_color();
@@ -171,6 +190,7 @@ static void red_led_setting_display(uint8_t subsecond) {
         sprintf(buf, "%2d", color.red);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     }
+    display_led_calibration(movement_get_led_calibration().bit.red);
 }
 
 static void red_led_setting_advance(void) {
@@ -179,6 +199,12 @@ static void red_led_setting_advance(void) {
     movement_set_backlight_color(color);
 }
 
+static void red_led_setting_calibrate(void) {
+    movement_led_calibration_t calibration = movement_get_led_calibration();
+    calibration.bit.red = next_led_calibration(calibration.bit.red);
+    movement_set_led_calibration(calibration);
+}
+
 static void green_led_setting_display(uint8_t subsecond) {
     char buf[8];
     movement_color_t color = movement_backlight_color();
@@ -189,6 +215,7 @@ static void green_led_setting_display(uint8_t subsecond) {
         sprintf(buf, "%2d", color.green);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     }
+    display_led_calibration(movement_get_led_calibration().bit.green);
 }
 
 static void green_led_setting_advance(void) {
@@ -197,6 +224,12 @@ static void green_led_setting_advance(void) {
     movement_set_backlight_color(color);
 }
 
+static void green_led_setting_calibrate(void) {
+    movement_led_calibration_t calibration = movement_get_led_calibration();
+    calibration.bit.green = next_led_calibration(calibration.bit.green);
+    movement_set_led_calibration(calibration);
+}
+
 static void blue_led_setting_display(uint8_t subsecond) {
     char buf[8];
     movement_color_t color = movement_backlight_color();
@@ -207,6 +240,7 @@ static void blue_led_setting_display(uint8_t subsecond) {
         sprintf(buf, "%2d", color.blue);
         watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
     }
+    display_led_calibration(movement_get_led_calibration().bit.blue);
 }
 
 static void blue_led_setting_advance(void) {
@@ -215,6 +249,12 @@ static void blue_led_setting_advance(void) {
     movement_set_backlight_color(color);
 }
 
+static void blue_led_setting_calibrate(void) {
+    movement_led_calibration_t calibration = movement_get_led_calibration();
+    calibration.bit.blue = next_led_calibration(calibration.bit.blue);
+    movement_set_led_calibration(calibration);
+}
+
 static void  git_hash_setting_display(uint8_t subsecond) {
     (void) subsecond;
     char buf[8];
@@ -249,7 +289,7 @@ void settings_face_setup(uint8_t watch_face_index, void ** context_ptr) {
         state->num_settings++;
 #endif
 
-        state->settings_screens = malloc(state->num_settings * sizeof(settings_screen_t));
+        state->settings_screens = calloc(state->num_settings, sizeof(settings_screen_t));
         state->settings_screens[current_setting].display = clock_setting_display;
         state->settings_screens[current_setting].advance = clock_setting_advance;
         current_setting++;
@@ -271,26 +311,32 @@ void settings_face_setup(uint8_t watch_face_index, void ** context_ptr) {
 #ifdef WATCH_RED_TCC_CHANNEL
         state->settings_screens[current_setting].display = red_led_setting_display;
         state->settings_screens[current_setting].advance = red_led_setting_advance;
+        state->settings_screens[current_setting].calibrate = red_led_setting_calibrate;
         current_setting++;
 #else
         (void)red_led_setting_display;
         (void)red_led_setting_advance;
+        (void)red_led_setting_calibrate;
 #endif
 #ifdef WATCH_GREEN_TCC_CHANNEL
         state->settings_screens[current_setting].display = green_led_setting_display;
         state->settings_screens[current_setting].advance = green_led_setting_advance;
+        state->settings_screens[current_setting].calibrate = green_led_setting_calibrate;
         current_setting++;
 #else
         (void)green_led_setting_display;
         (void)green_led_setting_advance;
+        (void)green_led_setting_calibrate;
 #endif
 #ifdef WATCH_BLUE_TCC_CHANNEL
         state->settings_screens[current_setting].display = blue_led_setting_display;
         state->settings_screens[current_setting].advance = blue_led_setting_advance;
+        state->settings_screens[current_setting].calibrate = blue_led_setting_calibrate;
         current_setting++;
 #else
         (void)blue_led_setting_display;
         (void)blue_led_setting_advance;
+        (void)blue_led_setting_calibrate;
 #endif
     state->led_color_end = current_setting;
 #ifdef BUILD_GIT_HASH
@@ -326,6 +372,13 @@ bool settings_face_loop(movement_event_t event, void *context) {
         case EVENT_ALARM_BUTTON_UP:
             state->settings_screens[state->current_page].advance();
             break;
+        case EVENT_ALARM_LONG_PRESS:
+            if (state->settings_screens[state->current_page].calibrate != NULL) {
+                state->settings_screens[state->current_page].calibrate();
+                watch_clear_display();
+                state->settings_screens[state->current_page].display(event.subsecond);
+            }
+            break;
         case EVENT_TIMEOUT:
             movement_move_to_face(0);
             break;
@@ -334,11 +387,10 @@ bool settings_face_loop(movement_event_t event, void *context) {
     }
 
     if (state->current_page >= state->led_color_start && state->current_page < state->led_color_end) {
-        movement_color_t color = movement_backlight_color();
-        // this bitwise math turns #000 into #000000, #111 into #111111, etc.
-        movement_force_led_on(color.red | color.red << 4,
-                              color.green | color.green << 4,
-                              color.blue | color.blue << 4);
+        uint8_t red, green, blue;
+        // show the color exactly as the light button will, with gamma correction and calibration applied.
+        movement_get_led_pwm_levels(movement_backlight_color(), &red, &green, &blue);
+        movement_force_led_on(red, green, blue);
         return false;
     } else {
         movement_force_led_off();
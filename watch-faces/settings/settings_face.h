@@ -68,6 +68,10 @@
  *       blend. Values range from 0 (off) to 15 (full intensity).
  *      On the LED color screens, the LED remains on so that you can see the
  *      effect of mixing the LED colors.
+ *      Long-pressing Alarm on a color screen calibrates that LED: each press
+ *       steps its full-scale brightness down (80, 60, 45, 30, 20 percent, shown
+ *       in the seconds digits) and back up to 100 (blank). Use this to balance
+ *       a channel that looks too bright, which also saves battery.
  */
 
 #include "movement.h"
@@ -75,6 +79,7 @@
 typedef struct {
     void (*display)(uint8_t subsecond);
     void (*advance)();
+    void (*calibrate)(void);    // optional, called on a long press of the Alarm button
 } settings_screen_t;
 
 typedef struct {
@@ -33,7 +33,17 @@ void irq_handler_system(void) {
         SUPC->VREG.bit.LPEFF = 0;
         // clear the interrupt condition
         SUPC->INTENCLR.bit.BOD33DET = 1;
-        // and disable the brownout detector (TODO: add a second, "power critical" brownout condition?)
+        // and disable the brownout detector; the supply manager re-arms it if the battery recovers.
         SUPC->INTFLAG.reg &= ~SUPC_INTFLAG_BOD33DET;
     }
 }
+
+uint32_t watch_critical_enter(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+void watch_critical_exit(uint32_t state) {
+    __set_PRIMASK(state);
+}
@@ -26,8 +26,7 @@
 #include "adc.h"
 
 void watch_enable_adc(void) {
-    adc_init();
-    adc_enable();
+    watch_peripheral_acquire(WATCH_PERIPHERAL_ADC);
 }
 
 void watch_enable_analog_input(const uint16_t port_pin) {
@@ -65,13 +64,11 @@ void _watch_set_analog_reference_voltage(uint8_t reference) {
 }
 
 uint16_t watch_get_vcc_voltage(void) {
+    // power the ADC up if nobody else is using it.
+    watch_enable_adc();
+
     // stash the previous reference so we can restore it when we're done.
     uint8_t oldref = ADC->REFCTRL.bit.REFSEL;
-    // same with the previous state of the ADC
-    bool adc_was_disabled = !adc_is_enabled();
-
-    // enable the ADC if needed
-    if (adc_was_disabled) watch_enable_adc();
 
     // if we weren't already using the internal reference voltage, select it now.
     if (oldref != ADC_REFCTRL_REFSEL_INTREF_Val) _watch_set_analog_reference_voltage(ADC_REFCTRL_REFSEL_INTREF_Val);
@@ -82,10 +79,12 @@ uint16_t watch_get_vcc_voltage(void) {
     // restore the old reference, if needed.
     if (oldref != ADC_REFCTRL_REFSEL_INTREF_Val) _watch_set_analog_reference_voltage(oldref);
 
-    // and restore the ADC to its previous state
-    if (adc_was_disabled) watch_disable_adc();
+    uint16_t millivolts = (uint16_t)((raw_val * 1000) / (1024 * 1 << ADC->AVGCTRL.bit.SAMPLENUM));
+
+    // and power it back down if we were the only user.
+    watch_disable_adc();
 
-    return (uint16_t)((raw_val * 1000) / (1024 * 1 << ADC->AVGCTRL.bit.SAMPLENUM));
+    return millivolts;
 }
 
 inline void watch_disable_analog_input(const uint16_t port_pin) {
@@ -97,6 +96,6 @@ inline void watch_disable_analog_input(const uint16_t port_pin) {
     PORT->Group[port].PINCFG[pin].reg &= ~PORT_PINCFG_PMUXEN;	\
 }
 
-inline void watch_disable_adc(void) {
-    adc_disable();
+void watch_disable_adc(void) {
+    watch_peripheral_release(WATCH_PERIPHERAL_ADC);
 }
@@ -151,14 +151,15 @@ static void _watch_disable_all_pins_except_rtc(void) {
 }
 
 static void _watch_disable_all_peripherals_except_slcd(void) {
-    _watch_disable_tcc();
-    watch_disable_adc();
+    // power down everything that has users (TCC, ADC, SERCOMs, TRNG); they come back up when we wake.
+    _watch_suspend_peripherals();
     watch_disable_external_interrupts();
+}
+
+static uint32_t _sleep_wake_count = 0;
 
-    /// TODO: Actually disable all these peripherals? Disabling I2C seems to have no impact fwiw.
-    // watch_disable_i2c();
-    // SERCOM3->USART.CTRLA.reg &= ~SERCOM_USART_CTRLA_ENABLE;
-    // MCLK->APBCMASK.reg &= ~MCLK_APBCMASK_SERCOM3;
+uint32_t watch_get_sleep_wake_count(void) {
+    return _sleep_wake_count;
 }
 
 void watch_enter_sleep_mode(void) {
@@ -168,17 +169,18 @@ void watch_enter_sleep_mode(void) {
     // disable tick interrupt
     watch_rtc_disable_all_periodic_callbacks();
 
-    // disable brownout detector interrupt, which could inadvertently wake us up.
-    SUPC->INTENCLR.bit.BOD33DET = 1;
+    // leave the brownout detector armed: if the battery sags below the guard while we sleep, waking up to turn
+    // LPEFF off is exactly what we want.
 
     // disable all pins
     _watch_disable_all_pins_except_rtc();
 
     // enter standby (4); we basically hang out here until an interrupt wakes us.
     sleep(4);
+    _sleep_wake_count++;
 
-    // and we awake! re-enable the brownout detector
-    SUPC->INTENSET.bit.BOD33DET = 1;
+    // and we awake! power the peripherals that were in use back up.
+    _watch_resume_peripherals();
 
     // call app_setup so the app can re-enable everything we disabled.
     app_setup();
@@ -28,14 +28,11 @@
 #ifdef I2C_SERCOM
 
 void watch_enable_i2c(void) {
-    HAL_GPIO_SDA_pmuxen(HAL_GPIO_PMUX_SERCOM);
-    HAL_GPIO_SCL_pmuxen(HAL_GPIO_PMUX_SERCOM);
-    i2c_init();
-    i2c_enable();
+    watch_peripheral_acquire(WATCH_PERIPHERAL_I2C);
 }
 
 void watch_disable_i2c(void) {
-    i2c_disable();
+    watch_peripheral_release(WATCH_PERIPHERAL_I2C);
 }
 
 void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
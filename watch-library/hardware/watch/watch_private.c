@@ -28,8 +28,13 @@
 #include "tc.h"
 #include "usb.h"
 #include "system.h"
+#include "i2c.h"
+#include "spi.h"
 
 void _watch_init(void) {
+    // before anything else runs, paint the stack so we can see how deep it gets.
+    watch_memory_paint_stack();
+
     // set frequency to 4 MHz
     set_cpu_frequency(4000000);
 
@@ -50,16 +55,6 @@ void _watch_init(void) {
     SUPC->VREG.bit.STDBYPL0 = 1;
     while(!SUPC->STATUS.bit.VREGRDY); // wait for voltage regulator to become ready
 
-    // check the battery voltage...
-    uint16_t battery_voltage = watch_get_vcc_voltage();
-    // ...because we can enable the more efficient low power regulator if the system voltage is > 2.5V
-    // still, enable LPEFF only if the battery voltage is comfortably above this threshold.
-    if (battery_voltage >= 2700) {
-        SUPC->VREG.bit.LPEFF = 1;
-    } else {
-        SUPC->VREG.bit.LPEFF = 0;
-    }
-
     // set up the brownout detector (low battery warning)
     NVIC_DisableIRQ(SYSTEM_IRQn);
     NVIC_ClearPendingIRQ(SYSTEM_IRQn);
@@ -70,8 +65,8 @@ void _watch_init(void) {
     SUPC->BOD33.bit.RUNSTDBY = 1;   // Enable sampling mode in standby
     SUPC->BOD33.bit.STDBYCFG = 1;   // Run in standby
     SUPC->BOD33.bit.RUNBKUP = 0;    // Don't run in backup mode
-    SUPC->BOD33.bit.PSEL = 0x9;     // Check battery level every second (we'll change this before entering sleep)
-    SUPC->BOD33.bit.LEVEL = 34;     // Detect brownout at 2.6V (1.445V + level * 34mV)
+    SUPC->BOD33.bit.PSEL = 0x9;     // Check battery level every second (the supply manager adjusts this)
+    SUPC->BOD33.bit.LEVEL = 34;     // Detect brownout at 2.6V (1.445V + level * 34mV; the supply manager adjusts this)
     SUPC->BOD33.bit.ACTION = 0x2;   // Generate an interrupt when BOD33 is triggered
     SUPC->BOD33.bit.HYST = 0;       // Disable hysteresis
     while(!SUPC->STATUS.bit.B33SRDY); // wait for BOD33 to sync
@@ -80,6 +75,11 @@ void _watch_init(void) {
     SUPC->INTENSET.bit.BOD33DET = 1;
     SUPC->BOD33.bit.ENABLE = 1;
 
+    // we can enable the more efficient low power regulator if the system voltage is > 2.5V.
+    // the supply manager decides from the battery voltage, and revisits it every time Movement samples the battery.
+    SUPC->VREG.bit.LPEFF = 0;
+    watch_update_supply(watch_get_vcc_voltage());
+
     // External wake depends on RTC; calendar is a required module.
     _watch_rtc_init();
 
@@ -106,8 +106,7 @@ int getentropy(void *buf, size_t buflen);
 
 // let's use the SAM L22's true random number generator to seed the PRNG!
 int getentropy(void *buf, size_t buflen) {
-    MCLK->APBCMASK.bit.TRNG_ = 1;
-    TRNG->CTRLA.bit.ENABLE = 1;
+    watch_peripheral_acquire(WATCH_PERIPHERAL_TRNG);
 
     size_t i = 0;
     while(i < buflen / 4) {
@@ -125,12 +124,124 @@ int getentropy(void *buf, size_t buflen) {
         }
     }
 
-    watch_disable_TRNG();
-    MCLK->APBCMASK.bit.TRNG_ = 0;
+    watch_peripheral_release(WATCH_PERIPHERAL_TRNG);
 
     return 0;
 }
 
+bool _watch_supply_lpeff_enabled(void) {
+    return SUPC->VREG.bit.LPEFF;
+}
+
+void _watch_apply_supply_config(const watch_supply_config_t *config) {
+    // never leave the guard armed without LPEFF, or LPEFF on without the guard: disarm first, arm last.
+    if (!config->guard_armed) SUPC->INTENCLR.bit.BOD33DET = 1;
+
+    if (SUPC->VREG.bit.LPEFF != config->lpeff) {
+        SUPC->VREG.bit.LPEFF = config->lpeff;
+        while(!SUPC->STATUS.bit.VREGRDY);
+    }
+
+    if (SUPC->BOD33.bit.PSEL != config->prescaler || SUPC->BOD33.bit.LEVEL != config->guard_level) {
+        // BOD33 must be disabled to change its configuration, and it may report a spurious detection while it
+        // settles, so keep its interrupt masked and clear the flag before arming it again.
+        SUPC->INTENCLR.bit.BOD33DET = 1;
+        SUPC->BOD33.bit.ENABLE = 0;
+        while(!SUPC->STATUS.bit.B33SRDY);
+        SUPC->BOD33.bit.PSEL = config->prescaler;
+        SUPC->BOD33.bit.LEVEL = config->guard_level;
+        SUPC->BOD33.bit.ENABLE = 1;
+        while(!SUPC->STATUS.bit.B33SRDY);
+        SUPC->INTFLAG.reg = SUPC_INTFLAG_BOD33DET;
+    }
+
+    if (config->guard_armed) SUPC->INTENSET.bit.BOD33DET = 1;
+}
+
+// the SERCOM used for each bus is a board setting, so build its clock names from the number.
+#define _WATCH_SERCOM_APBCMASK(n) _WATCH_SERCOM_APBCMASK_(n)
+#define _WATCH_SERCOM_APBCMASK_(n) MCLK_APBCMASK_SERCOM ## n
+#define _WATCH_SERCOM_GCLK_ID(n) _WATCH_SERCOM_GCLK_ID_(n)
+#define _WATCH_SERCOM_GCLK_ID_(n) SERCOM ## n ## _GCLK_ID_CORE
+
+static void _watch_gate_generic_clock(uint8_t gclk_id) {
+    GCLK->PCHCTRL[gclk_id].bit.CHEN = 0;
+    while (GCLK->PCHCTRL[gclk_id].bit.CHEN);
+}
+
+void _watch_peripheral_power_on(watch_peripheral_t peripheral) {
+    // unmask the bus clock first, then let the driver set up its generic clock and registers.
+    switch (peripheral) {
+        case WATCH_PERIPHERAL_I2C:
+#ifdef I2C_SERCOM
+            MCLK->APBCMASK.reg |= _WATCH_SERCOM_APBCMASK(I2C_SERCOM);
+            HAL_GPIO_SDA_pmuxen(HAL_GPIO_PMUX_SERCOM);
+            HAL_GPIO_SCL_pmuxen(HAL_GPIO_PMUX_SERCOM);
+            i2c_init();
+            i2c_enable();
+#endif
+            break;
+        case WATCH_PERIPHERAL_SPI:
+#ifdef SPI_SERCOM
+            MCLK->APBCMASK.reg |= _WATCH_SERCOM_APBCMASK(SPI_SERCOM);
+#endif
+            spi_init(1000000);
+            spi_enable();
+            break;
+        case WATCH_PERIPHERAL_ADC:
+            MCLK->APBCMASK.reg |= MCLK_APBCMASK_ADC;
+            adc_init();
+            adc_enable();
+            break;
+        case WATCH_PERIPHERAL_TCC:
+            MCLK->APBCMASK.reg |= MCLK_APBCMASK_TCC0;
+            _watch_enable_tcc();
+            break;
+        case WATCH_PERIPHERAL_TRNG:
+            MCLK->APBCMASK.reg |= MCLK_APBCMASK_TRNG;
+            TRNG->CTRLA.bit.ENABLE = 1;
+            break;
+        default:
+            break;
+    }
+}
+
+void _watch_peripheral_power_off(watch_peripheral_t peripheral) {
+    // disable the peripheral while it still has a clock, then gate its clocks.
+    switch (peripheral) {
+        case WATCH_PERIPHERAL_I2C:
+#ifdef I2C_SERCOM
+            i2c_disable();
+            _watch_gate_generic_clock(_WATCH_SERCOM_GCLK_ID(I2C_SERCOM));
+            MCLK->APBCMASK.reg &= ~_WATCH_SERCOM_APBCMASK(I2C_SERCOM);
+#endif
+            break;
+        case WATCH_PERIPHERAL_SPI:
+            spi_disable();
+#ifdef SPI_SERCOM
+            _watch_gate_generic_clock(_WATCH_SERCOM_GCLK_ID(SPI_SERCOM));
+            MCLK->APBCMASK.reg &= ~_WATCH_SERCOM_APBCMASK(SPI_SERCOM);
+#endif
+            break;
+        case WATCH_PERIPHERAL_ADC:
+            adc_disable();
+            _watch_gate_generic_clock(ADC_GCLK_ID);
+            MCLK->APBCMASK.reg &= ~MCLK_APBCMASK_ADC;
+            break;
+        case WATCH_PERIPHERAL_TCC:
+            _watch_disable_tcc();
+            _watch_gate_generic_clock(TCC0_GCLK_ID);
+            MCLK->APBCMASK.reg &= ~MCLK_APBCMASK_TCC0;
+            break;
+        case WATCH_PERIPHERAL_TRNG:
+            watch_disable_TRNG();
+            MCLK->APBCMASK.reg &= ~MCLK_APBCMASK_TRNG;
+            break;
+        default:
+            break;
+    }
+}
+
 
 void _watch_enable_usb(void) {
     set_cpu_frequency(8000000);
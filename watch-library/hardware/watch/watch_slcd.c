@@ -205,7 +205,8 @@ void watch_enable_display(void) {
     /// TODO: Wrap this in a gossamer call.
     if (SLCD->CTRLA.bit.ENABLE) return;
 
-    watch_discover_lcd_type();
+    // only detect the LCD once; we may be coming back from watch_disable_display.
+    if (_installed_display == WATCH_LCD_TYPE_UNKNOWN) watch_discover_lcd_type();
 
     HAL_GPIO_SLCD0_pmuxen(HAL_GPIO_PMUX_B);
     HAL_GPIO_SLCD1_pmuxen(HAL_GPIO_PMUX_B);
@@ -260,6 +261,13 @@ void watch_enable_display(void) {
     slcd_enable();
 }
 
+void watch_disable_display(void) {
+    if (!SLCD->CTRLA.bit.ENABLE) return;
+
+    slcd_clear();
+    slcd_disable();
+}
+
 inline void watch_set_pixel(uint8_t com, uint8_t seg) {
     slcd_set_segment(com, seg);
 }
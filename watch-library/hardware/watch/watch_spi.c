@@ -26,12 +26,11 @@
 #include "spi.h"
 
 void watch_enable_spi(void) {
-    spi_init(1000000);
-    spi_enable();
+    watch_peripheral_acquire(WATCH_PERIPHERAL_SPI);
 }
 
 void watch_disable_spi(void) {
-    spi_disable();
+    watch_peripheral_release(WATCH_PERIPHERAL_SPI);
 }
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) {
@@ -2,6 +2,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "watch_storage.h"
+#include "watch_private.h"
 
 #define RWWEE_ADDR_START NVMCTRL_RWW_EEPROM_ADDR
 #define RWWEE_ADDR_END (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES)
@@ -68,6 +69,7 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     }
     NVMCTRL->ADDR.reg = address / 2;
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_RWWEEWP | NVMCTRL_CTRLA_CMDEX_KEY;
+    _watch_trace_count_flash_write();
 
     return true;
 }
@@ -79,6 +81,7 @@ bool watch_storage_erase(uint32_t row) {
     watch_storage_sync();
     NVMCTRL->ADDR.reg = address / 2;
     NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY;
+    _watch_trace_count_flash_write();
 
     return true;
 }
@@ -27,7 +27,6 @@
 #include "tcc.h"
 #include "tc.h"
 
-void _watch_enable_tcc(void);
 void cb_watch_buzzer_seq(void);
 
 static uint16_t _seq_position;
@@ -35,6 +34,14 @@ static int8_t _tone_ticks, _repeat_counter;
 static bool _callback_running = false;
 static int8_t *_sequence;
 static void (*_cb_finished)(void);
+static bool _playing_tune = false;
+// the buzzer and the LEDs each hold the TCC while enabled.
+static bool _buzzer_enabled = false;
+static bool _leds_enabled = false;
+static watch_buzzer_tune_state_t _tune_state;
+static uint32_t _tune_ticks_remaining;
+static uint8_t _buzzer_max_duty = 50;
+static uint8_t _led_max_level = 255;
 
 static void _tcc_write_RUNSTDBY(bool value) {
     // enables or disables RUNSTDBY of the tcc
@@ -67,9 +74,67 @@ static void _tc0_initialize() {
     NVIC_EnableIRQ (TC0_IRQn);
 }
 
+static void _tc0_initialize_for_tune() {
+    // setup TC0 as a 16-bit one-shot-per-note timer counting at 1024 Hz; CC0 is the top value.
+    tc_init(0, GENERIC_CLOCK_3, TC_PRESCALER_DIV1);
+    tc_set_counter_mode(0, TC_COUNTER_MODE_16BIT);
+    tc_set_run_in_standby(0, true);
+    /// FIXME: #SecondMovement, gossamer has no wrapper for match frequency mode or the 16-bit compare yet.
+    TC0->COUNT16.WAVE.reg = TC_WAVE_WAVEGEN_MFRQ;
+    TC0->COUNT16.INTENSET.bit.OVF = 1;
+    NVIC_ClearPendingIRQ(TC0_IRQn);
+    NVIC_EnableIRQ (TC0_IRQn);
+}
+
+static void _tc0_set_top(uint32_t ticks) {
+    TC0->COUNT16.CC[0].reg = ticks - 1;
+    while (TC0->COUNT16.SYNCBUSY.bit.CC0);
+}
+
+static void cb_watch_buzzer_tune(void) {
+    // long notes don't fit in 16 bits; if we're in the middle of one, just wait out the next chunk.
+    if (_tune_ticks_remaining == 0) {
+        watch_buzzer_note_t note;
+        uint8_t volume;
+        if (!watch_buzzer_tune_next(&_tune_state, &note, &volume, &_tune_ticks_remaining)) {
+            // end the tune
+            watch_buzzer_abort_sequence();
+            if (_cb_finished) _cb_finished();
+            return;
+        }
+        if (note != BUZZER_NOTE_REST && volume) {
+            watch_set_buzzer_period_and_duty_cycle(NotePeriods[note], volume);
+            watch_set_buzzer_on();
+        } else watch_set_buzzer_off();
+    }
+    uint32_t chunk = _tune_ticks_remaining > 0x10000 ? 0x10000 : _tune_ticks_remaining;
+    _tune_ticks_remaining -= chunk;
+    _tc0_set_top(chunk);
+}
+
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void)) {
+    if (_callback_running) _tc0_stop();
+    watch_set_buzzer_off();
+    watch_buzzer_tune_begin(&_tune_state, tune);
+    _tune_ticks_remaining = 0;
+    _cb_finished = callback_on_end;
+    _playing_tune = true;
+    // prepare buzzer
+    watch_enable_buzzer();
+    // setup TC0 timer
+    _tc0_initialize_for_tune();
+    // TCC should run in standby mode
+    _tcc_write_RUNSTDBY(true);
+    // start the first note now, and program TC0 to interrupt us at the end of it.
+    cb_watch_buzzer_tune();
+    // an empty tune will already have called the end callback.
+    if (_playing_tune) _tc0_start();
+}
+
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
     if (_callback_running) _tc0_stop();
     watch_set_buzzer_off();
+    _playing_tune = false;
     _sequence = note_sequence;
     _cb_finished = callback_on_end;
     _seq_position = 0;
@@ -127,6 +192,7 @@ void cb_watch_buzzer_seq(void) {
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
     if (_callback_running) _tc0_stop();
+    _playing_tune = false;
     watch_set_buzzer_off();
     // disable standby mode for TCC
     _tcc_write_RUNSTDBY(false);
@@ -134,7 +200,8 @@ void watch_buzzer_abort_sequence(void) {
 
 void irq_handler_tc0(void) {
     // interrupt handler for TC0 (globally!)
-    cb_watch_buzzer_seq();
+    if (_playing_tune) cb_watch_buzzer_tune();
+    else cb_watch_buzzer_seq();
     TC0->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
 }
 
@@ -142,19 +209,34 @@ bool watch_is_buzzer_or_led_enabled(void){
     return tcc_is_enabled(0);
 }
 
-inline void watch_enable_buzzer(void) {
-    if (!tcc_is_enabled(0)) {
-        _watch_enable_tcc();
+bool watch_is_buzzer_enabled(void) {
+    return _buzzer_enabled;
+}
+
+void watch_enable_buzzer(void) {
+    if (!_buzzer_enabled) {
+        _buzzer_enabled = true;
+        watch_peripheral_acquire(WATCH_PERIPHERAL_TCC);
     }
 }
 
 void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty) {
+    if (duty > _buzzer_max_duty) duty = _buzzer_max_duty;
     tcc_set_period(0, period, true);
-    tcc_set_cc(0, (WATCH_BUZZER_TCC_CHANNEL) % 4, period / (100 / duty), true);
+    tcc_set_cc(0, (WATCH_BUZZER_TCC_CHANNEL) % 4, duty ? period / (100 / duty) : 0, true);
+}
+
+void watch_set_buzzer_max_duty_cycle(uint8_t max_duty) {
+    _buzzer_max_duty = max_duty > 50 ? 50 : max_duty;
 }
 
 void watch_disable_buzzer(void) {
-    _watch_disable_tcc();
+    if (_buzzer_enabled) {
+        // the LEDs may keep the TCC running, so make sure the buzzer is quiet.
+        watch_set_buzzer_off();
+        _buzzer_enabled = false;
+        watch_peripheral_release(WATCH_PERIPHERAL_TCC);
+    }
 }
 
 inline void watch_set_buzzer_on(void) {
@@ -257,13 +339,19 @@ void _watch_disable_tcc(void) {
 }
 
 void watch_enable_leds(void) {
-    if (!tcc_is_enabled(0)) {
-        _watch_enable_tcc();
+    if (!_leds_enabled) {
+        _leds_enabled = true;
+        watch_peripheral_acquire(WATCH_PERIPHERAL_TCC);
     }
 }
 
 void watch_disable_leds(void) {
-    _watch_disable_tcc();
+    if (_leds_enabled) {
+        // the buzzer may keep the TCC running, so make sure the LEDs are dark.
+        watch_set_led_off();
+        _leds_enabled = false;
+        watch_peripheral_release(WATCH_PERIPHERAL_TCC);
+    }
 }
 
 void watch_set_led_color(uint8_t red, uint8_t green) {
@@ -275,6 +363,11 @@ void watch_set_led_color(uint8_t red, uint8_t green) {
 }
 
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
+    if (_led_max_level != 255) {
+        red = ((uint16_t)red * _led_max_level) / 255;
+        green = ((uint16_t)green * _led_max_level) / 255;
+        blue = ((uint16_t)blue * _led_max_level) / 255;
+    }
     if (tcc_is_enabled(0)) {
         uint32_t period = tcc_get_period(0);
         tcc_set_cc(0, (WATCH_RED_TCC_CHANNEL) % 4, ((period * (uint32_t)red * 1000ull) / 255000ull), true);
@@ -306,3 +399,7 @@ void watch_set_led_yellow(void) {
 void watch_set_led_off(void) {
     watch_set_led_color_rgb(0, 0, 0);
 }
+
+void watch_set_led_max_level(uint8_t max_level) {
+    _led_max_level = max_level;
+}
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_trace.h"
+#include "watch_private.h"
+#include "tc.h"
+
+// TC2 counts the 1024 Hz clock, but only while the CPU is awake: it stops in standby, so its count is time spent
+// awake. Each reading is good to a tick, which comes out even over the many wakes the budget adds up.
+static bool _watch_trace_timer_running = false;
+static volatile uint32_t _watch_trace_timer_overflows = 0;
+
+static void _watch_trace_timer_start(void) {
+    tc_init(2, GENERIC_CLOCK_3, TC_PRESCALER_DIV1);
+    tc_set_counter_mode(2, TC_COUNTER_MODE_16BIT);
+    tc_set_run_in_standby(2, false);
+    /// FIXME: #SecondMovement, we need a gossamer wrapper for interrupts.
+    TC2->COUNT16.INTENSET.bit.OVF = 1;
+    NVIC_ClearPendingIRQ(TC2_IRQn);
+    NVIC_EnableIRQ(TC2_IRQn);
+    tc_enable(2);
+    _watch_trace_timer_running = true;
+}
+
+void irq_handler_tc2(void);
+void irq_handler_tc2(void) {
+    // 64 seconds of awake time have gone by.
+    _watch_trace_timer_overflows++;
+    TC2->COUNT16.INTFLAG.reg = TC_INTFLAG_OVF;
+}
+
+uint32_t _watch_trace_get_us(void) {
+    if (!_watch_trace_timer_running) _watch_trace_timer_start();
+
+    uint32_t state = watch_critical_enter();
+    TC2->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_READSYNC;
+    while (TC2->COUNT16.SYNCBUSY.bit.CTRLB);
+    while (TC2->COUNT16.SYNCBUSY.bit.COUNT);
+    uint16_t count = TC2->COUNT16.COUNT.reg;
+    uint32_t overflows = _watch_trace_timer_overflows;
+    // with interrupts masked, an overflow since we came in is still waiting; a low count means we read after it.
+    if (TC2->COUNT16.INTFLAG.bit.OVF && count < 0x8000) overflows++;
+    watch_critical_exit(state);
+
+    // callers only take differences, so it's fine for this to wrap around.
+    uint64_t ticks = ((uint64_t)overflows << 16) | count;
+    return (uint32_t)(ticks * 15625 / 16);
+}
+
+// replays need the simulator; on the watch, a trace is only recorded.
+bool watch_trace_replay(void) {
+    return false;
+}
+
+bool watch_trace_is_replaying(void) {
+    return false;
+}
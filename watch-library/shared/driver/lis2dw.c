@@ -22,9 +22,79 @@
  * SOFTWARE.
  */
 
+#include <stddef.h>
 #include "lis2dw.h"
 #include "watch.h"
 
+#ifdef I2C_SERCOM
+
+// The driver keeps a copy of the control and interrupt configuration registers, so that setters don't have to read
+// them back over I2C and getters don't touch the bus at all. They sit in three contiguous blocks, which lets a batch
+// of changes go out as (at most) three auto-increment burst writes.
+#define LIS2DW_SHADOW_BASE LIS2DW_REG_CTRL1
+#define LIS2DW_SHADOW_SIZE (LIS2DW_REG_CTRL7 - LIS2DW_SHADOW_BASE + 1)
+
+static const struct {
+    uint8_t first;
+    uint8_t last;
+} _lis2dw_shadow_blocks[] = {
+    { LIS2DW_REG_CTRL1, LIS2DW_REG_CTRL6 },
+    { LIS2DW_REG_TAP_THS_X, LIS2DW_REG_FREE_FALL },
+    { LIS2DW_REG_CTRL7, LIS2DW_REG_CTRL7 },
+};
+
+static uint8_t _lis2dw_shadow[LIS2DW_SHADOW_SIZE];
+static uint32_t _lis2dw_dirty = 0;
+static bool _lis2dw_batching = false;
+
+static void _lis2dw_read_shadow(void) {
+    for (size_t i = 0; i < sizeof(_lis2dw_shadow_blocks) / sizeof(_lis2dw_shadow_blocks[0]); i++) {
+        uint8_t reg = _lis2dw_shadow_blocks[i].first;
+        watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+        watch_i2c_receive(LIS2DW_ADDRESS, &_lis2dw_shadow[reg - LIS2DW_SHADOW_BASE], _lis2dw_shadow_blocks[i].last - reg + 1);
+    }
+    _lis2dw_dirty = 0;
+}
+
+static void _lis2dw_flush_shadow(void) {
+    for (size_t i = 0; i < sizeof(_lis2dw_shadow_blocks) / sizeof(_lis2dw_shadow_blocks[0]); i++) {
+        uint8_t first = _lis2dw_shadow_blocks[i].last + 1;
+        uint8_t last = 0;
+        for (uint8_t reg = _lis2dw_shadow_blocks[i].first; reg <= _lis2dw_shadow_blocks[i].last; reg++) {
+            if (_lis2dw_dirty & (1ul << (reg - LIS2DW_SHADOW_BASE))) {
+                if (reg < first) first = reg;
+                last = reg;
+            }
+        }
+        if (last == 0) continue;
+
+        // rewriting a clean register in the middle of the run costs one byte, where a second transaction costs five.
+        uint8_t buf[1 + LIS2DW_REG_FREE_FALL - LIS2DW_REG_TAP_THS_X + 1];
+        buf[0] = first;
+        for (uint8_t reg = first; reg <= last; reg++) buf[1 + reg - first] = _lis2dw_shadow[reg - LIS2DW_SHADOW_BASE];
+        watch_i2c_send(LIS2DW_ADDRESS, buf, 1 + last - first + 1);
+    }
+    _lis2dw_dirty = 0;
+}
+
+static inline uint8_t _lis2dw_read_register(uint8_t reg) {
+    return _lis2dw_shadow[reg - LIS2DW_SHADOW_BASE];
+}
+
+static void _lis2dw_write_register(uint8_t reg, uint8_t value) {
+    uint8_t *shadow = &_lis2dw_shadow[reg - LIS2DW_SHADOW_BASE];
+    if (*shadow == value) return;
+
+    *shadow = value;
+    if (_lis2dw_batching) {
+        _lis2dw_dirty |= 1ul << (reg - LIS2DW_SHADOW_BASE);
+    } else {
+        watch_i2c_write8(LIS2DW_ADDRESS, reg, value);
+    }
+}
+
+#endif
+
 bool lis2dw_begin(void) {
 #ifdef I2C_SERCOM
     if (lis2dw_get_device_id() != LIS2DW_WHO_AM_I_VAL) {
@@ -35,6 +105,10 @@ bool lis2dw_begin(void) {
     // Enable block data update (output registers not updated until MSB and LSB have been read) and address autoincrement
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_BDU | LIS2DW_CTRL2_VAL_IF_ADD_INC);
 
+    // the reset put every register back to its default, so start the shadow over from what the device reports.
+    _lis2dw_batching = false;
+    _lis2dw_read_shadow();
+
     // Parameters at startup: 
     //  * Data rate 0 (powered down)
     //  * Low power mode enabled
@@ -130,10 +204,10 @@ uint16_t lis2dw_get_temperature(void) {
 
 void lis2dw_set_data_rate(lis2dw_data_rate_t dataRate) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1111 << 4);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL1) & ~(0b1111 << 4);
     uint8_t bits = dataRate << 4;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL1, val | bits);
 #else
     (void)dataRate;
 #endif
@@ -141,7 +215,7 @@ void lis2dw_set_data_rate(lis2dw_data_rate_t dataRate) {
 
 lis2dw_data_rate_t lis2dw_get_data_rate(void) {
 #ifdef I2C_SERCOM
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) >> 4;
+    return _lis2dw_read_register(LIS2DW_REG_CTRL1) >> 4;
 #else
     return 0;
 #endif
@@ -149,10 +223,10 @@ lis2dw_data_rate_t lis2dw_get_data_rate(void) {
 
 void lis2dw_set_mode(lis2dw_mode_t mode) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1100);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL1) & ~(0b1100);
     uint8_t bits = (mode << 2) & 0b1100;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL1, val | bits);
 #else
     (void)mode;
 #endif
@@ -160,7 +234,7 @@ void lis2dw_set_mode(lis2dw_mode_t mode) {
 
 lis2dw_mode_t lis2dw_get_mode(void) {
 #ifdef I2C_SERCOM
-    return (lis2dw_mode_t)(watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b1100) >> 2;
+    return (lis2dw_mode_t)(_lis2dw_read_register(LIS2DW_REG_CTRL1) & 0b1100) >> 2;
 #else
     return 0;
 #endif
@@ -168,10 +242,10 @@ lis2dw_mode_t lis2dw_get_mode(void) {
 
 void lis2dw_set_low_power_mode(lis2dw_low_power_mode_t mode) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b11);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL1) & ~(0b11);
     uint8_t bits = mode & 0b11;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL1, val | bits);
 #else
     (void)mode;
 #endif
@@ -179,7 +253,7 @@ void lis2dw_set_low_power_mode(lis2dw_low_power_mode_t mode) {
 
 lis2dw_low_power_mode_t lis2dw_get_low_power_mode(void) {
 #ifdef I2C_SERCOM
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b11;
+    return _lis2dw_read_register(LIS2DW_REG_CTRL1) & 0b11;
 #else
     return 0;
 #endif
@@ -187,9 +261,9 @@ lis2dw_low_power_mode_t lis2dw_get_low_power_mode(void) {
 
 void lis2dw_set_bandwidth_filtering(lis2dw_bandwidth_filtering_mode_t bwfilter) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
     uint8_t bits = bwfilter << 6;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL6, val | bits);
 #else
     (void)bwfilter;
 #endif
@@ -197,7 +271,7 @@ void lis2dw_set_bandwidth_filtering(lis2dw_bandwidth_filtering_mode_t bwfilter)
 
 lis2dw_bandwidth_filtering_mode_t lis2dw_get_bandwidth_filtering(void) {
 #ifdef I2C_SERCOM
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
+    uint8_t retval = _lis2dw_read_register(LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
     retval >>= 6;
     return (lis2dw_bandwidth_filtering_mode_t)retval;
 #else
@@ -207,10 +281,10 @@ lis2dw_bandwidth_filtering_mode_t lis2dw_get_bandwidth_filtering(void) {
 
 void lis2dw_set_range(lis2dw_range_t range) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_RANGE_16_G << 4);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL6) & ~(LIS2DW_RANGE_16_G << 4);
     uint8_t bits = range << 4;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL6, val | bits);
 #else
     (void)range;
 #endif
@@ -218,7 +292,7 @@ void lis2dw_set_range(lis2dw_range_t range) {
 
 lis2dw_range_t lis2dw_get_range(void) {
 #ifdef I2C_SERCOM
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_RANGE_16_G << 4);
+    uint8_t retval = _lis2dw_read_register(LIS2DW_REG_CTRL6) & (LIS2DW_RANGE_16_G << 4);
     retval >>= 4;
     return (lis2dw_range_t)retval;
 #else
@@ -228,9 +302,9 @@ lis2dw_range_t lis2dw_get_range(void) {
 
 void lis2dw_set_filter_type(lis2dw_filter_t bwfilter) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_FDS_HIGH);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_FDS_HIGH);
     uint8_t bits = bwfilter << 3;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL6, val | bits);
 #else
     (void)bwfilter;
 #endif
@@ -238,7 +312,7 @@ void lis2dw_set_filter_type(lis2dw_filter_t bwfilter) {
 
 lis2dw_filter_t lis2dw_get_filter_type(void) {
 #ifdef I2C_SERCOM
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_FDS_HIGH);
+    uint8_t retval = _lis2dw_read_register(LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_FDS_HIGH);
     retval >>= 3;
     return (lis2dw_filter_t)retval;
 #else
@@ -248,10 +322,10 @@ lis2dw_filter_t lis2dw_get_filter_type(void) {
 
 void lis2dw_set_low_noise_mode(bool on) {
 #ifdef I2C_SERCOM
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_LOW_NOISE);
+    uint8_t val = _lis2dw_read_register(LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_LOW_NOISE);
     uint8_t bits = on ? LIS2DW_CTRL6_VAL_LOW_NOISE : 0;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_write_register(LIS2DW_REG_CTRL6, val | bits);
 #else
     (void)on;
 #endif
@@ -259,7 +333,7 @@ void lis2dw_set_low_noise_mode(bool on) {
 
 bool lis2dw_get_low_noise_mode(void) {
 #ifdef I2C_SERCOM
-    return (watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & LIS2DW_CTRL6_VAL_LOW_NOISE) != 0;
+    return (_lis2dw_read_register(LIS2DW_REG_CTRL6) & LIS2DW_CTRL6_VAL_LOW_NOISE) != 0;
 #else
     return false;
 #endif
@@ -304,36 +378,36 @@ void lis2dw_clear_fifo(void) {
 
 void lis2dw_enable_sleep(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS, configuration | LIS2DW_WAKE_UP_THS_VAL_SLEEP_ON);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_WAKE_UP_THS);
+    _lis2dw_write_register(LIS2DW_REG_WAKE_UP_THS, configuration | LIS2DW_WAKE_UP_THS_VAL_SLEEP_ON);
 #endif
 }
 
 void lis2dw_disable_sleep(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS, configuration & ~LIS2DW_WAKE_UP_THS_VAL_SLEEP_ON);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_WAKE_UP_THS);
+    _lis2dw_write_register(LIS2DW_REG_WAKE_UP_THS, configuration & ~LIS2DW_WAKE_UP_THS_VAL_SLEEP_ON);
 #endif
 }
 
 void lis2dw_enable_stationary_motion_detection(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_DUR);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_DUR, configuration | LIS2DW_WAKE_UP_DUR_STATIONARY);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_WAKE_UP_DUR);
+    _lis2dw_write_register(LIS2DW_REG_WAKE_UP_DUR, configuration | LIS2DW_WAKE_UP_DUR_STATIONARY);
 #endif
 }
 
 void lis2dw_disable_stationary_motion_detection(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_DUR);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_DUR, configuration & ~LIS2DW_WAKE_UP_DUR_STATIONARY);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_WAKE_UP_DUR);
+    _lis2dw_write_register(LIS2DW_REG_WAKE_UP_DUR, configuration & ~LIS2DW_WAKE_UP_DUR_STATIONARY);
 #endif
 }
 
 void lis2dw_configure_wakeup_threshold(uint8_t threshold) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS) & 0b11000000;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS, configuration | threshold);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_WAKE_UP_THS) & 0b11000000;
+    _lis2dw_write_register(LIS2DW_REG_WAKE_UP_THS, configuration | threshold);
 #else
     (void)threshold;
 #endif
@@ -341,8 +415,8 @@ void lis2dw_configure_wakeup_threshold(uint8_t threshold) {
 
 void lis2dw_configure_6d_threshold(uint8_t threshold) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_X) & 0b01100000;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_X, configuration | ((threshold & 0b11) << 5));
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_TAP_THS_X) & 0b01100000;
+    _lis2dw_write_register(LIS2DW_REG_TAP_THS_X, configuration | ((threshold & 0b11) << 5));
 #else
     (void)threshold;
 #endif
@@ -361,7 +435,7 @@ void lis2dw_configure_tap_threshold(uint8_t threshold_x, uint8_t threshold_y, ui
         // mask out high bits if set
         configuration |= (threshold_z & 0b00011111);
     }
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_Z, configuration);
+    _lis2dw_write_register(LIS2DW_REG_TAP_THS_Z, configuration);
 #else
     (void)threshold_x;
     (void)threshold_y;
@@ -373,7 +447,7 @@ void lis2dw_configure_tap_threshold(uint8_t threshold_x, uint8_t threshold_y, ui
 void lis2dw_configure_tap_duration(uint8_t latency, uint8_t quiet, uint8_t shock) {
 #ifdef I2C_SERCOM
     uint8_t configuration = (latency << 4) | ((quiet & 0b11) << 2) | (shock & 0b11);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_INT1_DUR, configuration);
+    _lis2dw_write_register(LIS2DW_REG_INT1_DUR, configuration);
 #else
     (void)latency;
     (void)quiet;
@@ -383,7 +457,7 @@ void lis2dw_configure_tap_duration(uint8_t latency, uint8_t quiet, uint8_t shock
 
 void lis2dw_configure_int1(uint8_t sources) {
 #ifdef I2C_SERCOM
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, sources);
+    _lis2dw_write_register(LIS2DW_REG_CTRL4_INT1, sources);
 #else
     (void)sources;
 #endif
@@ -391,7 +465,7 @@ void lis2dw_configure_int1(uint8_t sources) {
 
 void lis2dw_configure_int2(uint8_t sources) {
 #ifdef I2C_SERCOM
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL5_INT2, sources);
+    _lis2dw_write_register(LIS2DW_REG_CTRL5_INT2, sources);
 #else
     (void)sources;
 #endif
@@ -399,15 +473,15 @@ void lis2dw_configure_int2(uint8_t sources) {
 
 void lis2dw_enable_interrupts(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_CTRL7);
+    _lis2dw_write_register(LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
 #endif
 }
 
 void lis2dw_disable_interrupts(void) {
 #ifdef I2C_SERCOM
-    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration & ~LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+    uint8_t configuration = _lis2dw_read_register(LIS2DW_REG_CTRL7);
+    _lis2dw_write_register(LIS2DW_REG_CTRL7, configuration & ~LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
 #endif
 }
 
@@ -429,8 +503,21 @@ lis2dw_interrupt_source_t lis2dw_get_interrupt_source(void) {
 
 uint8_t lis2dw_get_wakeup_threshold(void) {
 #ifdef I2C_SERCOM
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS) & 0b00111111;
+    return _lis2dw_read_register(LIS2DW_REG_WAKE_UP_THS) & 0b00111111;
 #else
     return 0;
 #endif
 }
+
+void lis2dw_begin_configuration(void) {
+#ifdef I2C_SERCOM
+    _lis2dw_batching = true;
+#endif
+}
+
+void lis2dw_commit_configuration(void) {
+#ifdef I2C_SERCOM
+    _lis2dw_batching = false;
+    _lis2dw_flush_shadow();
+#endif
+}
@@ -297,6 +297,15 @@ typedef enum {
 
 bool lis2dw_begin(void);
 
+/// @brief Starts a batch of configuration changes. Until lis2dw_commit_configuration is called, the setters below
+///        only update the driver's copy of the control and interrupt registers; nothing is sent to the device.
+/// @note Getters return the pending values during a batch.
+void lis2dw_begin_configuration(void);
+
+/// @brief Sends every register changed since lis2dw_begin_configuration to the device, using one auto-increment
+///        burst write per block of contiguous registers (CTRL1-CTRL6, TAP_THS_X-FREE_FALL and CTRL7).
+void lis2dw_commit_configuration(void);
+
 uint8_t lis2dw_get_device_id(void);
 
 bool lis2dw_have_new_data(void);
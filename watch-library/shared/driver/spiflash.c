@@ -30,15 +30,19 @@
 
 #define SPI_FLASH_FAST_READ false
 
+// the SPI bus is powered for each transaction, so that an idle flash chip doesn't hold the SERCOM clock on.
 static void flash_enable(void) {
+    watch_enable_spi();
     HAL_GPIO_A3_clr();
 }
 
 static void flash_disable(void) {
     HAL_GPIO_A3_set();
+    watch_disable_spi();
 }
 
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
+    flash_enable();
     bool status = watch_spi_write(command, command_length);
     if (status) {
         if (data_in != NULL && data_out != NULL) {
@@ -116,5 +120,4 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
 void spi_flash_init(void) {
 	gpio_set_pin_level(A3, true);
 	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
-    watch_enable_spi();
 }
@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Counts the I2C transactions the LIS2DW driver makes, using a register file in place of the accelerometer.
+// Built and run by `make -C test`.
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "watch.h"
+#include "lis2dw.h"
+
+static uint8_t registers[256];
+static uint8_t register_pointer;
+static unsigned int transactions;
+
+void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    (void) addr;
+    transactions++;
+    // first byte sets the register pointer; the rest are written with auto-increment.
+    register_pointer = buf[0];
+    for (uint16_t i = 1; i < length; i++) registers[register_pointer++] = buf[i];
+}
+
+void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    (void) addr;
+    transactions++;
+    for (uint16_t i = 0; i < length; i++) buf[i] = registers[register_pointer++];
+}
+
+void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
+    (void) addr;
+    transactions++;
+    registers[reg] = data;
+}
+
+uint8_t watch_i2c_read8(int16_t addr, uint8_t reg) {
+    (void) addr;
+    transactions++;
+    return registers[reg];
+}
+
+uint16_t watch_i2c_read16(int16_t addr, uint8_t reg) {
+    (void) addr;
+    transactions++;
+    return registers[reg] | registers[reg + 1] << 8;
+}
+
+// the same sequence lis2dw_monitor_face uses to apply its settings.
+static void set_state(void) {
+    lis2dw_set_mode(LIS2DW_MODE_HIGH_PERFORMANCE);
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_100_HZ);
+    lis2dw_set_low_power_mode(LIS2DW_LP_MODE_2);
+    lis2dw_set_bandwidth_filtering(LIS2DW_BANDWIDTH_FILTER_DIV4);
+    lis2dw_set_range(LIS2DW_RANGE_8_G);
+    lis2dw_set_filter_type(LIS2DW_FILTER_HIGH_PASS);
+    lis2dw_set_low_noise_mode(true);
+}
+
+void setUp(void) {
+    memset(registers, 0, sizeof(registers));
+    registers[LIS2DW_REG_WHO_AM_I] = LIS2DW_WHO_AM_I_VAL;
+    TEST_ASSERT_TRUE(lis2dw_begin());
+    transactions = 0;
+}
+
+void tearDown(void) {
+}
+
+static void test_setters_write_once_each(void) {
+    // each setter used to be a read and a write: 7 setters, 14 transactions.
+    set_state();
+    TEST_ASSERT_LESS_OR_EQUAL_UINT(7, transactions);
+    printf("set state: 14 transactions before, %u unbatched\n", transactions);
+}
+
+static void test_getters_use_the_shadow(void) {
+    set_state();
+    transactions = 0;
+    TEST_ASSERT_EQUAL(LIS2DW_MODE_HIGH_PERFORMANCE, lis2dw_get_mode());
+    TEST_ASSERT_EQUAL(LIS2DW_DATA_RATE_100_HZ, lis2dw_get_data_rate());
+    TEST_ASSERT_EQUAL(LIS2DW_RANGE_8_G, lis2dw_get_range());
+    TEST_ASSERT_TRUE(lis2dw_get_low_noise_mode());
+    TEST_ASSERT_EQUAL_UINT(0, transactions);
+}
+
+static void test_unchanged_state_sends_nothing(void) {
+    set_state();
+    transactions = 0;
+    set_state();
+    TEST_ASSERT_EQUAL_UINT(0, transactions);
+}
+
+static void test_batch_is_one_burst(void) {
+    set_state();
+    uint8_t expected_ctrl1 = registers[LIS2DW_REG_CTRL1];
+    uint8_t expected_ctrl6 = registers[LIS2DW_REG_CTRL6];
+
+    // a batch goes out as one burst covering CTRL1 through CTRL6, and leaves the device in the same state.
+    setUp();
+    lis2dw_begin_configuration();
+    set_state();
+    TEST_ASSERT_EQUAL_UINT(0, transactions);
+    lis2dw_commit_configuration();
+    TEST_ASSERT_EQUAL_UINT(1, transactions);
+    TEST_ASSERT_EQUAL_HEX8(expected_ctrl1, registers[LIS2DW_REG_CTRL1]);
+    TEST_ASSERT_EQUAL_HEX8(expected_ctrl6, registers[LIS2DW_REG_CTRL6]);
+    TEST_ASSERT_EQUAL_HEX8(LIS2DW_CTRL2_VAL_BDU | LIS2DW_CTRL2_VAL_IF_ADD_INC, registers[LIS2DW_REG_CTRL2]);
+}
+
+static void test_batch_takes_one_burst_per_block(void) {
+    lis2dw_begin_configuration();
+    lis2dw_configure_tap_threshold(0, 0, 12, LIS2DW_REG_TAP_THS_Z_Z_AXIS_ENABLE);
+    lis2dw_configure_tap_duration(10, 2, 2);
+    lis2dw_configure_wakeup_threshold(32);
+    lis2dw_configure_int1(LIS2DW_CTRL4_INT1_SINGLE_TAP);
+    lis2dw_enable_interrupts();
+    lis2dw_commit_configuration();
+    TEST_ASSERT_EQUAL_UINT(3, transactions);
+    TEST_ASSERT_EQUAL_HEX8(LIS2DW_REG_TAP_THS_Z_Z_AXIS_ENABLE | 12, registers[LIS2DW_REG_TAP_THS_Z]);
+    TEST_ASSERT_EQUAL_HEX8((10 << 4) | (2 << 2) | 2, registers[LIS2DW_REG_INT1_DUR]);
+    TEST_ASSERT_EQUAL_UINT8(32, registers[LIS2DW_REG_WAKE_UP_THS] & 0b00111111);
+    TEST_ASSERT_EQUAL_HEX8(LIS2DW_CTRL4_INT1_SINGLE_TAP, registers[LIS2DW_REG_CTRL4_INT1]);
+    TEST_ASSERT_BITS_HIGH(LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE, registers[LIS2DW_REG_CTRL7]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_setters_write_once_each);
+    RUN_TEST(test_getters_use_the_shadow);
+    RUN_TEST(test_unchanged_state_sends_nothing);
+    RUN_TEST(test_batch_is_one_burst);
+    RUN_TEST(test_batch_takes_one_burst_per_block);
+    return UNITY_END();
+}
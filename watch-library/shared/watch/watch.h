@@ -53,6 +53,13 @@
                          the I2C bus, putting values directly on the bus and reading data from registers on I2C devices.
             - @ref spi - This section covers functions related to the SAM L22's built-in SPI driver.
             - @ref uart - This section covers functions related to the UART peripheral.
+            - @ref power - This section covers the reference counts that decide when the SERCOM, ADC, TCC and TRNG
+                           peripherals are powered and clocked.
+            - @ref supply - This section covers how the voltage regulator and brown-out detector follow the battery
+                            as it drains.
+            - @ref memory - This section covers how much heap and stack the firmware actually uses.
+            - @ref trace - This section covers recording the watch's inputs, replaying them in the simulator, and
+                           the counters used to compare two builds against the same session.
             - @ref deepsleep - This section covers functions related to preparing for and entering BACKUP mode, the
                                deepest sleep mode available on the SAM L22.
  */
@@ -72,6 +79,9 @@ typedef void (*watch_cb_t)(void);
 #include "watch_uart.h"
 #include "watch_storage.h"
 #include "watch_deepsleep.h"
+#include "watch_power.h"
+#include "watch_memory.h"
+#include "watch_trace.h"
 
 /** @brief Interrupt handler for the SYSTEM interrupt, which handles MCLK,
  *         OSC32KCTRL, OSCCTRL, PAC, PM and SUPC.
@@ -85,6 +95,15 @@ void irq_handler_system(void);
   */
 void watch_reset_to_bootloader(void);
 
+/** @brief Masks interrupts, for state that the main loop shares with interrupt handlers.
+  * @return The mask as it was, for watch_critical_exit. Critical sections can nest.
+  */
+uint32_t watch_critical_enter(void);
+
+/** @brief Puts the interrupt mask back the way watch_critical_enter found it.
+  */
+void watch_critical_exit(uint32_t state);
+
 /** @brief Disables the TRNG twice in order to work around silicon erratum 1.16.1.
  *  FIXME: find a better place for this, a couple of watch faces need it.
  */
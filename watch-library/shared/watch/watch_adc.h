@@ -65,6 +65,13 @@ uint16_t watch_get_analog_pin_level(const uint16_t pin);
   */
 uint16_t watch_get_vcc_voltage(void);
 
+#ifdef __EMSCRIPTEN__
+/** @brief Sets the voltage watch_get_vcc_voltage returns from now on, and stops any curve the page was
+  *        playing back. Simulator only.
+  */
+void watch_set_vcc_voltage(uint16_t millivolts);
+#endif
+
 /** @brief Disables the analog circuitry on the selected pin.
   * @param pin One of pins A0-A4.
   */
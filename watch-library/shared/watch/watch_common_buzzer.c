@@ -23,7 +23,88 @@
  */
 
 #include <stdint.h>
+#include "watch_tcc.h"
 
 // note: the buzzer uses a 1 MHz clock. these values were determined by dividing 1,000,000 by the target frequency.
 // i.e. for a 440 Hz tone (A4 on the piano), 1MHz/440Hz = 2273
 const uint16_t NotePeriods[108] = {18182,17161,16197,15288,14430,13620,12857,12134,11453,10811,10204,9631,9091,8581,8099,7645,7216,6811,6428,6068,5727,5405,5102,4816,4545,4290,4050,3822,3608,3405,3214,3034,2863,2703,2551,2408,2273,2145,2025,1911,1804,1703,1607,1517,1432,1351,1276,1204,1136,1073,1012,956,902,851,804,758,716,676,638,602,568,536,506,478,451,426,402,379,358,338,319,301,284,268,253,239,225,213,201,190,179,169,159,150,142,134,127};
+
+static uint32_t _watch_buzzer_tune_read_varint(watch_buzzer_tune_state_t *state) {
+    uint32_t value = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+
+    do {
+        byte = state->tune[state->position++];
+        if (shift < 32) value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return value;
+}
+
+void watch_buzzer_tune_begin(watch_buzzer_tune_state_t *state, const uint8_t *tune) {
+    state->tune = tune;
+    state->position = 0;
+    state->tempo = BUZZER_TUNE_TICKS_PER_SECOND / 64;
+    state->volume = 25;
+    state->repeat_depth = 0;
+}
+
+bool watch_buzzer_tune_next(watch_buzzer_tune_state_t *state, watch_buzzer_note_t *note, uint8_t *volume, uint32_t *ticks) {
+    while (true) {
+        uint8_t opcode = state->tune[state->position++];
+
+        switch (opcode) {
+            case BUZZER_TUNE_END:
+                // leave the position on the end marker, so that calling this again stays at the end.
+                state->position--;
+                return false;
+            case BUZZER_TUNE_TEMPO:
+                state->tempo = _watch_buzzer_tune_read_varint(state);
+                break;
+            case BUZZER_TUNE_VOLUME:
+                state->volume = state->tune[state->position++];
+                if (state->volume > 50) state->volume = 50;
+                break;
+            case BUZZER_TUNE_REPEAT_START:
+                // sections nested too deeply are simply played once.
+                if (state->repeat_depth < BUZZER_TUNE_MAX_REPEAT_DEPTH) {
+                    state->repeat_start[state->repeat_depth] = state->position;
+                    state->repeat_count[state->repeat_depth] = 0xFF;
+                }
+                state->repeat_depth++;
+                break;
+            case BUZZER_TUNE_REPEAT_END:
+            {
+                uint8_t count = state->tune[state->position++];
+                if (state->repeat_depth == 0) break;
+                if (state->repeat_depth > BUZZER_TUNE_MAX_REPEAT_DEPTH) {
+                    state->repeat_depth--;
+                    break;
+                }
+                uint8_t level = state->repeat_depth - 1;
+                // first time we get here: load the repeat counter.
+                if (state->repeat_count[level] == 0xFF) state->repeat_count[level] = count == 0xFF ? 0xFE : count;
+                if (state->repeat_count[level]) {
+                    state->repeat_count[level]--;
+                    state->position = state->repeat_start[level];
+                } else {
+                    state->repeat_depth--;
+                }
+                break;
+            }
+            default:
+            {
+                uint32_t duration = _watch_buzzer_tune_read_varint(state);
+                // unknown opcodes are treated as rests, so that a newer tune degrades gracefully.
+                if (opcode > BUZZER_TUNE_NOTE(BUZZER_NOTE_REST)) opcode = BUZZER_TUNE_NOTE(BUZZER_NOTE_REST);
+                if (duration == 0 || state->tempo == 0) break;
+                *note = (watch_buzzer_note_t)(opcode - 1);
+                *volume = state->volume;
+                *ticks = duration * state->tempo;
+                return true;
+            }
+        }
+    }
+}
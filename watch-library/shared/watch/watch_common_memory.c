@@ -0,0 +1,314 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <malloc.h>
+#include "watch_memory.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/stack.h>
+
+void *emscripten_builtin_malloc(size_t size);
+void emscripten_builtin_free(void *ptr);
+#else
+#include "sam.h"
+
+void *sbrk(ptrdiff_t incr);
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+// newlib-nano keeps its free chunks in this list; with another allocator it's simply not there.
+typedef struct _watch_malloc_chunk {
+    long size;
+    struct _watch_malloc_chunk *next;
+} _watch_malloc_chunk_t;
+extern _watch_malloc_chunk_t *__malloc_free_list __attribute__((weak));
+// the linker script's stack section, if it has one.
+extern uint32_t _sstack __attribute__((weak));
+#endif
+
+#define WATCH_STACK_PAINT 0xA5A5A5A5
+
+static uint32_t _heap_in_use = 0;
+static uint32_t _heap_peak = 0;
+static uint32_t _allocations = 0;
+static uint32_t _failed_allocations = 0;
+static uint32_t _untracked_allocations = 0;
+static uint32_t _owner_bytes[WATCH_MEMORY_NUM_OWNERS];
+static uint32_t _system_bytes = 0;
+static uint8_t _owner = WATCH_MEMORY_OWNER_SYSTEM;
+
+// Who allocated each live block, so a free is debited to the owner that made the allocation rather than whoever
+// happens to be running. A side table rather than a header in front of each block, because the C library can hand us
+// blocks it allocated itself (memalign, for one, doesn't come through us), and those must be left alone.
+static void *_block_ptrs[WATCH_MEMORY_MAX_BLOCKS];
+static uint8_t _block_owners[WATCH_MEMORY_MAX_BLOCKS];
+
+static uint32_t *_stack_bottom = NULL;
+static uint32_t *_stack_top = NULL;
+
+static uint32_t _watch_memory_get_stack_peak(void);
+
+static uint32_t *_watch_memory_owner_slot(uint8_t owner) {
+    return owner < WATCH_MEMORY_NUM_OWNERS ? &_owner_bytes[owner] : &_system_bytes;
+}
+
+static int16_t _watch_memory_find_block(void *ptr) {
+    for (int16_t i = 0; i < WATCH_MEMORY_MAX_BLOCKS; i++) {
+        if (_block_ptrs[i] == ptr) return i;
+    }
+
+    return -1;
+}
+
+static void _watch_memory_charge(void *ptr, uint8_t owner) {
+    int16_t index = _watch_memory_find_block(NULL);
+    if (index < 0) {
+        // out of slots: the block works, but we can't say whose it is, so it isn't counted anywhere.
+        _untracked_allocations++;
+        return;
+    }
+
+    uint32_t size = malloc_usable_size(ptr);
+    _block_ptrs[index] = ptr;
+    _block_owners[index] = owner;
+    _heap_in_use += size;
+    if (_heap_in_use > _heap_peak) _heap_peak = _heap_in_use;
+    *_watch_memory_owner_slot(owner) += size;
+}
+
+/// Forgets a block and debits whoever allocated it. Returns that owner, or the current one for a block we never saw.
+static uint8_t _watch_memory_discharge(void *ptr) {
+    int16_t index = ptr ? _watch_memory_find_block(ptr) : -1;
+    if (index < 0) return _owner;
+
+    uint32_t size = malloc_usable_size(ptr);
+    uint8_t owner = _block_owners[index];
+    _block_ptrs[index] = NULL;
+    _heap_in_use -= size;
+    *_watch_memory_owner_slot(owner) -= size;
+
+    return owner;
+}
+
+static void _watch_memory_did_allocate(void *ptr) {
+    if (ptr == NULL) {
+        _failed_allocations++;
+        return;
+    }
+
+    _allocations++;
+    _watch_memory_charge(ptr, _owner);
+}
+
+static void _watch_memory_will_free(void *ptr) {
+    _watch_memory_discharge(ptr);
+}
+
+#ifdef __EMSCRIPTEN__
+
+// Emscripten lets us replace its allocator, and hands us the original as emscripten_builtin_*.
+void *malloc(size_t size) {
+    void *ptr = emscripten_builtin_malloc(size);
+    _watch_memory_did_allocate(ptr);
+    return ptr;
+}
+
+void free(void *ptr) {
+    _watch_memory_will_free(ptr);
+    emscripten_builtin_free(ptr);
+}
+
+void *calloc(size_t count, size_t size) {
+    if (size && count > SIZE_MAX / size) return NULL;
+    void *ptr = malloc(count * size);
+    if (ptr != NULL) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size) {
+    if (ptr == NULL) return malloc(size);
+    if (size == 0) {
+        free(ptr);
+        return NULL;
+    }
+
+    // the block stays with whoever allocated it in the first place.
+    void *new_ptr = emscripten_builtin_malloc(size);
+    if (new_ptr == NULL) {
+        _failed_allocations++;
+        return NULL;
+    }
+    size_t old_size = malloc_usable_size(ptr);
+    memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+    uint8_t owner = _watch_memory_discharge(ptr);
+    emscripten_builtin_free(ptr);
+    _allocations++;
+    _watch_memory_charge(new_ptr, owner);
+    return new_ptr;
+}
+
+void watch_memory_paint_stack(void) {
+    // the stack grows down from its base towards its end; leave room for the frames we're in.
+    uint32_t *current = (uint32_t *)emscripten_stack_get_current();
+    _stack_bottom = (uint32_t *)emscripten_stack_get_end();
+    _stack_top = (uint32_t *)emscripten_stack_get_base();
+    for (uint32_t *p = _stack_bottom; p < current - 16; p++) *p = WATCH_STACK_PAINT;
+}
+
+static uint32_t *_watch_memory_stack_scan_start(void) {
+    return _stack_bottom;
+}
+
+static void _watch_memory_get_heap_free(watch_memory_stats_t *stats) {
+    // dlmalloc reports what it holds, but not the size of its largest free chunk.
+    stats->heap_free = mallinfo().fordblks;
+    stats->heap_largest_free = 0;
+}
+
+#else
+
+// linked in with -Wl,--wrap so that every call to malloc and friends comes through here first.
+void *__wrap_malloc(size_t size) {
+    void *ptr = __real_malloc(size);
+    _watch_memory_did_allocate(ptr);
+    return ptr;
+}
+
+void __wrap_free(void *ptr) {
+    _watch_memory_will_free(ptr);
+    __real_free(ptr);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    void *ptr = __real_calloc(count, size);
+    _watch_memory_did_allocate(ptr);
+    return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    // the block stays with whoever allocated it in the first place; take it off the books before realloc frees it.
+    bool tracked = ptr && _watch_memory_find_block(ptr) >= 0;
+    uint8_t owner = _watch_memory_discharge(ptr);
+    void *new_ptr = __real_realloc(ptr, size);
+
+    if (new_ptr == NULL && size != 0) {
+        // the old block is untouched, so put it back.
+        if (tracked) _watch_memory_charge(ptr, owner);
+        _failed_allocations++;
+        return NULL;
+    }
+
+    if (new_ptr != NULL) {
+        _allocations++;
+        _watch_memory_charge(new_ptr, owner);
+    }
+
+    return new_ptr;
+}
+
+void watch_memory_paint_stack(void) {
+    uint32_t *current = (uint32_t *)__get_MSP();
+    // the first word of the vector table is the initial stack pointer, i.e. the top of the stack.
+    _stack_top = (uint32_t *)((uint32_t *)SCB->VTOR)[0];
+    if (&_sstack != NULL && &_sstack < current) {
+        _stack_bottom = &_sstack;
+    } else {
+        // no stack section: the stack grows down towards the heap, so paint everything in between.
+        _stack_bottom = (uint32_t *)(((uint32_t)sbrk(0) + 3) & ~3);
+    }
+    // leave room for the frames we're in.
+    for (uint32_t *p = _stack_bottom; p < current - 16; p++) *p = WATCH_STACK_PAINT;
+}
+
+static uint32_t *_watch_memory_stack_scan_start(void) {
+    // if the heap has grown into the painted area since boot, that part isn't the stack's doing.
+    uint32_t *heap_end = (uint32_t *)(((uint32_t)sbrk(0) + 3) & ~3);
+    return (heap_end > _stack_bottom && heap_end < _stack_top) ? heap_end : _stack_bottom;
+}
+
+static void _watch_memory_get_heap_free(watch_memory_stats_t *stats) {
+    uint32_t total = 0;
+    uint32_t largest = 0;
+
+    if (&__malloc_free_list != NULL) {
+        for (_watch_malloc_chunk_t *chunk = __malloc_free_list; chunk != NULL; chunk = chunk->next) {
+            uint32_t size = chunk->size - sizeof(long);
+            total += size;
+            if (size > largest) largest = size;
+        }
+    }
+
+    // then there's the space the allocator hasn't claimed from sbrk yet: up to the stack, or the end of RAM.
+    uint32_t heap_end = (uint32_t)sbrk(0);
+    uint32_t limit = HMCRAMC0_ADDR + HMCRAMC0_SIZE;
+    if ((uint32_t)_stack_top > heap_end) limit = (uint32_t)_stack_top - _watch_memory_get_stack_peak();
+    uint32_t unclaimed = limit > heap_end ? limit - heap_end : 0;
+    total += unclaimed;
+    if (unclaimed > largest) largest = unclaimed;
+
+    stats->heap_free = total;
+    stats->heap_largest_free = largest;
+}
+
+#endif
+
+static uint32_t _watch_memory_get_stack_peak(void) {
+    if (_stack_bottom == NULL) return 0;
+
+    uint32_t *p = _watch_memory_stack_scan_start();
+    while (p < _stack_top && *p == WATCH_STACK_PAINT) p++;
+
+    return (uint32_t)((uint8_t *)_stack_top - (uint8_t *)p);
+}
+
+uint8_t watch_memory_set_owner(uint8_t owner) {
+    uint8_t previous = _owner;
+    _owner = owner;
+    return previous;
+}
+
+uint32_t watch_memory_get_owner_bytes(uint8_t owner) {
+    return owner < WATCH_MEMORY_NUM_OWNERS ? _owner_bytes[owner] : _system_bytes;
+}
+
+void watch_memory_get_stats(watch_memory_stats_t *stats) {
+    stats->heap_in_use = _heap_in_use;
+    stats->heap_peak = _heap_peak;
+    stats->allocations = _allocations;
+    stats->failed_allocations = _failed_allocations;
+    stats->untracked_allocations = _untracked_allocations;
+    stats->stack_peak = _watch_memory_get_stack_peak();
+#ifdef __EMSCRIPTEN__
+    stats->stack_size = (uint32_t)((uint8_t *)_stack_top - (uint8_t *)_stack_bottom);
+#else
+    stats->stack_size = (&_sstack != NULL && _stack_bottom == &_sstack) ? (uint32_t)((uint8_t *)_stack_top - (uint8_t *)_stack_bottom) : 0;
+#endif
+    _watch_memory_get_heap_free(stats);
+}
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_power.h"
+#include "watch_private.h"
+
+static uint8_t _watch_peripheral_users[WATCH_NUM_PERIPHERALS];
+
+static const char *_watch_peripheral_names[WATCH_NUM_PERIPHERALS] = {
+    "i2c",
+    "spi",
+    "adc",
+    "tcc",
+    "trng",
+};
+
+// the buzzer releases the TCC from an interrupt, so counts are changed with interrupts masked.
+void watch_peripheral_acquire(watch_peripheral_t peripheral) {
+    if (peripheral >= WATCH_NUM_PERIPHERALS) return;
+
+    uint32_t state = watch_critical_enter();
+    if (_watch_peripheral_users[peripheral]++ == 0) _watch_peripheral_power_on(peripheral);
+    watch_critical_exit(state);
+}
+
+void watch_peripheral_release(watch_peripheral_t peripheral) {
+    if (peripheral >= WATCH_NUM_PERIPHERALS) return;
+
+    uint32_t state = watch_critical_enter();
+    if (_watch_peripheral_users[peripheral] != 0 && --_watch_peripheral_users[peripheral] == 0) _watch_peripheral_power_off(peripheral);
+    watch_critical_exit(state);
+}
+
+uint8_t watch_peripheral_get_users(watch_peripheral_t peripheral) {
+    if (peripheral >= WATCH_NUM_PERIPHERALS) return 0;
+    return _watch_peripheral_users[peripheral];
+}
+
+const char *watch_peripheral_get_name(watch_peripheral_t peripheral) {
+    if (peripheral >= WATCH_NUM_PERIPHERALS) return "?";
+    return _watch_peripheral_names[peripheral];
+}
+
+void _watch_suspend_peripherals(void) {
+    for (watch_peripheral_t peripheral = 0; peripheral < WATCH_NUM_PERIPHERALS; peripheral++) {
+        if (_watch_peripheral_users[peripheral]) _watch_peripheral_power_off(peripheral);
+    }
+}
+
+void _watch_resume_peripherals(void) {
+    for (watch_peripheral_t peripheral = 0; peripheral < WATCH_NUM_PERIPHERALS; peripheral++) {
+        if (_watch_peripheral_users[peripheral]) _watch_peripheral_power_on(peripheral);
+    }
+}
+
+static watch_supply_config_t _watch_supply_config;
+
+static uint8_t _watch_supply_level_for_millivolts(uint16_t millivolts) {
+    // BOD33 trips at 1445 mV + 34 mV per level step; round up so the threshold is never below what we asked for.
+    if (millivolts <= 1445) return 0;
+    uint16_t level = (millivolts - 1445 + 33) / 34;
+    return level > 63 ? 63 : level;
+}
+
+static uint16_t _watch_supply_guard_millivolts(const watch_supply_config_t *config) {
+    // a cell that is sagging quickly gets a higher guard, so LPEFF goes off before the next sample would catch it.
+    uint16_t guard = WATCH_SUPPLY_LPEFF_GUARD_MV;
+    if (config->slope_millivolts < 0) guard += (-config->slope_millivolts * 2 > 100) ? 100 : -config->slope_millivolts * 2;
+    // and report the threshold BOD33 will actually use.
+    return 1445 + 34 * _watch_supply_level_for_millivolts(guard);
+}
+
+static void _watch_supply_derive(watch_supply_config_t *config) {
+    if (!config->lpeff) {
+        // nothing for the guard to protect, so sample as rarely as the hardware allows.
+        config->guard_armed = false;
+        config->guard_level = _watch_supply_level_for_millivolts(WATCH_SUPPLY_LPEFF_GUARD_MV);
+        config->prescaler = 0xF;
+        return;
+    }
+
+    uint16_t guard = _watch_supply_guard_millivolts(config);
+    config->guard_armed = true;
+    config->guard_level = _watch_supply_level_for_millivolts(guard);
+
+    // likewise, the closer we are to the guard, the more often BOD33 has to look.
+    uint16_t margin = config->trend_millivolts > guard ? config->trend_millivolts - guard : 0;
+    // the rate stays the same across sleep: changing it means disabling BOD33, which would throw away a detection.
+    if (margin >= 400) config->prescaler = 0xC;         // every 8 seconds
+    else if (margin >= 200) config->prescaler = 0xB;    // every 4 seconds
+    else if (margin >= 100) config->prescaler = 0xA;    // every 2 seconds
+    else config->prescaler = 0x9;                       // every second
+}
+
+static void _watch_supply_sync(void) {
+    // the brown-out interrupt switches LPEFF off on its own; catch up with it.
+    if (_watch_supply_config.lpeff && !_watch_supply_lpeff_enabled()) {
+        _watch_supply_config.lpeff = false;
+        _watch_supply_derive(&_watch_supply_config);
+    }
+}
+
+void watch_update_supply(uint16_t millivolts) {
+    _watch_supply_sync();
+    watch_supply_config_t config = _watch_supply_config;
+
+    if (config.trend_millivolts == 0) {
+        // first sample since boot: start the trend here, and take whatever _watch_init left the regulator in.
+        config.trend_millivolts = millivolts;
+        config.slope_millivolts = 0;
+        config.lpeff = _watch_supply_lpeff_enabled();
+    } else {
+        uint16_t trend = (config.trend_millivolts * 3 + millivolts) / 4;
+        config.slope_millivolts = (int16_t)trend - (int16_t)config.trend_millivolts;
+        config.trend_millivolts = trend;
+    }
+
+    // drop LPEFF as soon as one sample is below the guard, but only bring it back once the trend agrees.
+    if (millivolts < _watch_supply_guard_millivolts(&config)) {
+        config.lpeff = false;
+    } else if (millivolts >= WATCH_SUPPLY_LPEFF_ENABLE_MV && config.trend_millivolts >= WATCH_SUPPLY_LPEFF_ENABLE_MV) {
+        config.lpeff = true;
+    }
+
+    _watch_supply_derive(&config);
+    _watch_supply_config = config;
+    _watch_apply_supply_config(&_watch_supply_config);
+}
+
+watch_supply_config_t watch_get_supply_config(void) {
+    _watch_supply_sync();
+    return _watch_supply_config;
+}
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_trace.h"
+#include "watch_private.h"
+
+static watch_trace_record_t _watch_trace[WATCH_TRACE_LENGTH];
+static uint16_t _watch_trace_count;
+static uint32_t _watch_trace_start_time;
+static uint32_t _watch_trace_last_timestamp;
+static uint32_t _watch_trace_last_tick;
+static volatile bool _watch_trace_recording;
+static bool _watch_trace_truncated;
+
+static watch_trace_stats_t _watch_trace_stats;
+static uint32_t _watch_trace_wake_started;
+
+static bool _watch_trace_append(uint16_t delta, watch_trace_event_t event, uint8_t data) {
+    if (_watch_trace_count == WATCH_TRACE_LENGTH) {
+        _watch_trace_recording = false;
+        _watch_trace_truncated = true;
+        return false;
+    }
+    _watch_trace[_watch_trace_count].delta = delta;
+    _watch_trace[_watch_trace_count].event = event;
+    _watch_trace[_watch_trace_count].data = data;
+    _watch_trace_count++;
+    return true;
+}
+
+void watch_trace_start(uint32_t start_time) {
+    _watch_trace_recording = false;
+    _watch_trace_count = 0;
+    _watch_trace_truncated = false;
+    // timestamps count from the whole second the trace starts on, which is all a replay can set the clock to. The UNIX
+    // time in 1/128 s doesn't fit in 32 bits; time since the start only overflows after a year of recording.
+    _watch_trace_start_time = start_time;
+    _watch_trace_last_timestamp = 0;
+    _watch_trace_last_tick = 0;
+    _watch_trace_recording = true;
+}
+
+void watch_trace_stop(void) {
+    _watch_trace_recording = false;
+}
+
+bool watch_trace_is_recording(void) {
+    return _watch_trace_recording;
+}
+
+void watch_trace_record(uint32_t timestamp, watch_trace_event_t event, uint8_t data) {
+    if (!_watch_trace_recording) return;
+
+    // button and RTC callbacks record from their interrupts, so the buffer is changed with interrupts masked.
+    uint32_t state = watch_critical_enter();
+    if (timestamp < _watch_trace_last_timestamp) timestamp = _watch_trace_last_timestamp;
+
+    if (event == WATCH_TRACE_TICK && _watch_trace_count && _watch_trace[_watch_trace_count - 1].event == WATCH_TRACE_TICK &&
+        _watch_trace[_watch_trace_count - 1].data < UINT8_MAX && timestamp - _watch_trace_last_tick <= WATCH_TRACE_TICKS_PER_SECOND) {
+        // a steady run of ticks is one record; a replay regenerates them from the clock anyway.
+        _watch_trace[_watch_trace_count - 1].data++;
+        _watch_trace_last_tick = timestamp;
+        watch_critical_exit(state);
+        return;
+    }
+
+    uint32_t delta = timestamp - _watch_trace_last_timestamp;
+    bool ok = true;
+    while (ok && delta > UINT16_MAX) {
+        ok = _watch_trace_append(UINT16_MAX, WATCH_TRACE_IDLE, 0);
+        delta -= UINT16_MAX;
+    }
+    if (ok && _watch_trace_append(delta, event, data)) {
+        _watch_trace_last_timestamp = timestamp;
+        if (event == WATCH_TRACE_TICK) _watch_trace_last_tick = timestamp;
+    }
+    watch_critical_exit(state);
+}
+
+uint16_t watch_trace_get_records(const watch_trace_record_t **records) {
+    *records = _watch_trace;
+    return _watch_trace_count;
+}
+
+uint32_t watch_trace_get_start_time(void) {
+    return _watch_trace_start_time;
+}
+
+bool watch_trace_is_truncated(void) {
+    return _watch_trace_truncated;
+}
+
+void watch_trace_wake_begin(void) {
+    _watch_trace_stats.wakes++;
+    _watch_trace_wake_started = _watch_trace_get_us();
+}
+
+uint32_t watch_trace_wake_end(void) {
+    uint32_t awake_us = _watch_trace_get_us() - _watch_trace_wake_started;
+    _watch_trace_stats.awake_us += awake_us;
+    return awake_us;
+}
+
+void _watch_trace_count_flash_write(void) {
+    _watch_trace_stats.flash_writes++;
+}
+
+void watch_trace_get_stats(watch_trace_stats_t *stats) {
+    *stats = _watch_trace_stats;
+}
+
+void watch_trace_reset_stats(void) {
+    memset(&_watch_trace_stats, 0, sizeof(_watch_trace_stats));
+}
@@ -116,6 +116,19 @@ uint32_t watch_get_backup_data(uint8_t reg);
   */
 void watch_enter_sleep_mode(void);
 
+/** @brief Returns the number of times the watch has woken from watch_enter_sleep_mode since boot.
+  * @details Every wake costs power, so this is a quick way to compare how often the watch wakes in
+  *          low energy mode, for example with and without the display switched off.
+  */
+uint32_t watch_get_sleep_wake_count(void);
+
+#ifdef __EMSCRIPTEN__
+/** @brief Returns how long the simulator took to resume from watch_enter_sleep_mode after an interrupt, in µs.
+  * @param worst true for the longest since boot, false for the most recent. Simulator only.
+  */
+uint32_t watch_get_sleep_wake_latency_us(bool worst);
+#endif
+
 /** @brief Enters the SAM L22's lowest-power mode, BACKUP.
   * @details This function does some housekeeping before entering BACKUP mode. It first disables all pins
   *          and peripherals except for the RTC, and disables the tick interrupt (since that would wake
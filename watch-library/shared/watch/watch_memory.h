@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _WATCH_MEMORY_H_INCLUDED
+#define _WATCH_MEMORY_H_INCLUDED
+////< @file watch_memory.h
+
+#include "watch.h"
+
+/** @addtogroup memory Heap and Stack Instrumentation
+  * @brief This section covers how much heap and stack the firmware actually uses.
+  * @details malloc, calloc, realloc and free are wrapped (with the linker's --wrap on hardware, by overriding
+  *          Emscripten's allocator in the simulator) to keep a running total of heap in use, its peak, and the
+  *          bytes held by each owner. The owner is whoever Movement says is running when a block is allocated: a
+  *          watch face index while a face is being set up or called, or WATCH_MEMORY_OWNER_SYSTEM otherwise. The
+  *          block stays charged to that owner until it's freed, whoever frees it.
+  *
+  *          At boot, the unused part of the stack is painted with a known pattern. The stack's high-water mark is
+  *          the deepest point at which the pattern has been overwritten.
+  */
+/// @{
+
+#define WATCH_MEMORY_OWNER_SYSTEM 0xFF  ///< Allocations made outside of any watch face.
+
+#ifndef WATCH_MEMORY_NUM_OWNERS
+#define WATCH_MEMORY_NUM_OWNERS 32      ///< Owners with an index at or above this are counted as the system.
+#endif
+
+#ifndef WATCH_MEMORY_MAX_BLOCKS
+#define WATCH_MEMORY_MAX_BLOCKS 64      ///< Live heap blocks whose owner is remembered; any more go uncounted.
+#endif
+
+typedef struct {
+    uint32_t heap_in_use;       ///< Bytes currently allocated, including allocator rounding.
+    uint32_t heap_peak;         ///< The most bytes ever allocated at once since boot.
+    uint32_t heap_free;         ///< Bytes on the allocator's free list plus the heap it has not claimed yet.
+    uint32_t heap_largest_free; ///< The largest single allocation that would succeed right now, or 0 if unknown.
+    uint32_t allocations;       ///< Number of successful allocations since boot.
+    uint32_t failed_allocations;///< Number of allocations that returned NULL since boot.
+    uint32_t untracked_allocations;///< Allocations made while every block slot was taken, so not counted above.
+    uint32_t stack_size;        ///< Bytes set aside for the stack, or 0 if unknown.
+    uint32_t stack_peak;        ///< The deepest the stack has been since boot, in bytes.
+} watch_memory_stats_t;
+
+/** @brief Paints the unused part of the stack so its high-water mark can be measured. Call once, early at boot.
+  */
+void watch_memory_paint_stack(void);
+
+/** @brief Sets who subsequent allocations are attributed to. Frees are always debited to the block's owner.
+  * @param owner A watch face index, or WATCH_MEMORY_OWNER_SYSTEM.
+  * @return The previous owner, so you can restore it.
+  */
+uint8_t watch_memory_set_owner(uint8_t owner);
+
+/** @brief Returns the number of bytes an owner currently holds on the heap.
+  */
+uint32_t watch_memory_get_owner_bytes(uint8_t owner);
+
+/** @brief Fills in the current heap and stack statistics.
+  */
+void watch_memory_get_stats(watch_memory_stats_t *stats);
+
+/// @}
+#endif
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_POWER_H_INCLUDED
+#define _WATCH_POWER_H_INCLUDED
+////< @file watch_power.h
+
+#include "watch.h"
+
+/** @addtogroup power Peripheral Power Manager
+  * @brief This section covers the reference counts that decide when the SERCOM, ADC, TCC and TRNG peripherals
+  *        are powered.
+  * @details Each user of a peripheral acquires it before use and releases it afterwards. The first acquire
+  *          unmasks the peripheral's bus clock (MCLK APB mask) and initializes it; the last release disables it
+  *          and gates its bus and generic clocks again. The watch_enable_* and watch_disable_* functions for
+  *          I2C, SPI, ADC, the LEDs and the buzzer are acquires and releases, so calls to them must be paired.
+  * @note While the watch is in sleep mode, every peripheral is switched off regardless of its users, and
+  *       powered back up for them on wake.
+  */
+/// @{
+
+typedef enum {
+    WATCH_PERIPHERAL_I2C = 0,   ///< The SERCOM used for I2C (sensor board accelerometer, etc.)
+    WATCH_PERIPHERAL_SPI,       ///< The SERCOM used for SPI (flash, etc.)
+    WATCH_PERIPHERAL_ADC,       ///< The analog to digital converter, also used to measure the battery
+    WATCH_PERIPHERAL_TCC,       ///< The TCC that drives the LED and the buzzer
+    WATCH_PERIPHERAL_TRNG,      ///< The true random number generator
+    WATCH_NUM_PERIPHERALS
+} watch_peripheral_t;
+
+/** @brief Adds a user to a peripheral, powering it up if it had none.
+  * @param peripheral The peripheral you want to use.
+  */
+void watch_peripheral_acquire(watch_peripheral_t peripheral);
+
+/** @brief Removes a user from a peripheral, powering it down and gating its clocks if that was the last one.
+  * @param peripheral The peripheral you are done with. Releasing a peripheral with no users does nothing.
+  */
+void watch_peripheral_release(watch_peripheral_t peripheral);
+
+/** @brief Returns the number of users currently holding a peripheral.
+  */
+uint8_t watch_peripheral_get_users(watch_peripheral_t peripheral);
+
+/** @brief Returns a short name for a peripheral, for logging.
+  */
+const char *watch_peripheral_get_name(watch_peripheral_t peripheral);
+
+/// @}
+
+/** @addtogroup supply Supply Management
+  * @brief This section covers how the voltage regulator and brown-out detector follow the battery as it drains.
+  * @details The SAM L22's switching regulator has a more efficient mode (LPEFF) that is only safe while the
+  *          supply is above 2.5 V. The brown-out detector (BOD33) guards it: when the supply dips below the guard
+  *          level, its interrupt switches LPEFF off before the regulator runs out of headroom. Each time you pass
+  *          in a new battery measurement, the supply manager smooths it into a trend and re-evaluates LPEFF, the
+  *          guard level and how often BOD33 samples the supply, touching the hardware only when something changed.
+  *          LPEFF comes back on once the trend recovers, for example after a battery swap.
+  */
+/// @{
+
+#ifndef WATCH_SUPPLY_LPEFF_ENABLE_MV
+#define WATCH_SUPPLY_LPEFF_ENABLE_MV 2700   ///< LPEFF is enabled when both the trend and the latest sample are above this.
+#endif
+
+#ifndef WATCH_SUPPLY_LPEFF_GUARD_MV
+#define WATCH_SUPPLY_LPEFF_GUARD_MV 2600    ///< LPEFF is disabled below this; BOD33 watches for it between samples.
+#endif
+
+typedef struct {
+    uint16_t trend_millivolts;  ///< The smoothed supply voltage the configuration was derived from.
+    int16_t slope_millivolts;   ///< Change of the trend since the previous sample (negative while draining).
+    bool lpeff;                 ///< True if the regulator's low power efficiency mode is enabled.
+    bool guard_armed;           ///< True if the BOD33 interrupt is armed to switch LPEFF off.
+    uint8_t guard_level;        ///< BOD33 LEVEL field; the threshold is 1445 mV + 34 mV * level.
+    uint8_t prescaler;          ///< BOD33 PSEL field, awake and asleep alike; 9 samples every second, each step doubles it.
+} watch_supply_config_t;
+
+/** @brief Feeds a battery measurement to the supply manager and applies the resulting configuration.
+  * @param millivolts The supply voltage, as returned by watch_get_vcc_voltage.
+  * @details Call this periodically; Movement does it every time its power governor samples the battery.
+  */
+void watch_update_supply(uint16_t millivolts);
+
+/** @brief Returns the supply configuration currently in effect.
+  * @details The LPEFF and guard state reflect the hardware, so they also show a brown-out that switched LPEFF
+  *          off between samples.
+  */
+watch_supply_config_t watch_get_supply_config(void);
+
+/// @}
+#endif
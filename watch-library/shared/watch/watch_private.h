@@ -35,4 +35,23 @@ void _watch_enable_usb(void);
 /// Initializes the real-time clock peripheral. Implemented in watch_rtc.c
 void _watch_rtc_init(void);
 
+/// Called by the peripheral power manager when a peripheral gets its first user or loses its last one.
+/// Implemented in watch_private.c, since the clocks involved are specific to the platform.
+void _watch_peripheral_power_on(watch_peripheral_t peripheral);
+void _watch_peripheral_power_off(watch_peripheral_t peripheral);
+
+/// Powers down every peripheral with users before sleep, and powers them back up on wake. Implemented in watch_common_power.c
+void _watch_suspend_peripherals(void);
+void _watch_resume_peripherals(void);
+
+/// Called by the supply manager to apply a new regulator and brown-out configuration. Implemented in watch_private.c
+void _watch_apply_supply_config(const watch_supply_config_t *config);
+/// Returns true if LPEFF is enabled right now; the brown-out interrupt can switch it off behind the supply manager's back.
+bool _watch_supply_lpeff_enabled(void);
+
+/// Returns a free-running microsecond count for the wake statistics, or 0 where there is none. Implemented in watch_trace.c
+uint32_t _watch_trace_get_us(void);
+/// Called by watch_storage.c for every row written or erased. Implemented in watch_common_trace.c
+void _watch_trace_count_flash_write(void);
+
 #endif
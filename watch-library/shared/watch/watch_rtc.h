@@ -149,4 +149,13 @@ void watch_rtc_enable(bool en);
   */
 void watch_rtc_freqcorr_write(int16_t value, int16_t sign);
 
+#ifdef __EMSCRIPTEN__
+/** @brief Runs the simulated RTC faster than real time, to fast-forward through a test. Simulator only.
+  * @param factor Simulated seconds per real second; 1 is real time.
+  */
+void watch_rtc_set_time_scale(uint16_t factor);
+
+uint16_t watch_rtc_get_time_scale(void);
+#endif
+
 /// @}
@@ -98,6 +98,12 @@ typedef enum {
   */
 void watch_enable_display(void);
 
+/** @brief Disables the Segment LCD display, blanking it and stopping its charge pump and frame clock.
+  * @details This saves the current the SLCD draws to keep segments visible, at the cost of showing nothing at
+  *          all. Call watch_enable_display to turn the display back on; its contents are not preserved.
+  */
+void watch_disable_display(void);
+
 /** @brief Sets a pixel. Use this to manually set a pixel with a given common and segment number.
   *        See <a href="segmap.html">segmap.html</a>.
   * @param com the common pin, numbered from 0-2.
@@ -280,4 +286,12 @@ bool watch_sleep_animation_is_running(void);
   *          On the custom LCD, it will turn off the crescent moon indicator.
   */
 void watch_stop_sleep_animation(void);
+
+#ifdef __EMSCRIPTEN__
+/** @brief Pushes the segments set since the last commit out to the page. Simulator only.
+  * @details The simulator batches segment changes and commits them once per animation frame on its
+  *          own; call this only to time display updates, or to show them before returning to the browser.
+  */
+void watch_commit_display(void);
+#endif
 /// @}
@@ -133,6 +133,13 @@ typedef enum {
   */
 bool watch_is_buzzer_or_led_enabled(void);
 
+/** @brief Returns true if the buzzer is enabled.
+  * @details The buzzer and the LEDs each hold the TCC peripheral separately, so this only reports whether the buzzer
+  *          has been enabled with watch_enable_buzzer and not yet disabled. Use it to decide whether you are the one
+  *          who needs to call watch_disable_buzzer when you are done.
+  */
+bool watch_is_buzzer_enabled(void);
+
 /** @addtogroup tcc Buzzer and LED Control (via the TCC peripheral)
   * @brief This section covers functions related to Timer Counter for Control peripheral, which drives the piezo buzzer
   *        embedded in the F-91W's back plate as well as the LED that backlights the display.
@@ -151,6 +158,13 @@ void watch_enable_buzzer(void);
   */
 void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty);
 
+/** @brief Limits the duty cycle of the buzzer, regardless of what callers request.
+  * @param max_duty The highest duty cycle (0-50) the buzzer will be driven at. 50 removes the limit.
+  * @details A piezo driven at high duty draws current spikes that can brown out a depleted coin cell. Movement
+  *          uses this to play alarms more softly as the battery drains.
+  */
+void watch_set_buzzer_max_duty_cycle(uint8_t max_duty);
+
 /** @brief Disables the TCC peripheral that drives the buzzer.
   * @note If you are using PWM to set custom LED colors, this method will also disable the LED PWM driver,
   *       since the buzzer and LED both make use of the same peripheral to drive their PWM behavior.
@@ -199,13 +213,79 @@ extern const uint16_t NotePeriods[108];
   *       Hint: It is not possible to play the lowest note BUZZER_NOTE_A1 (55.00 Hz). The note is represented by a 
   *       zero byte, which is used here as the end-of-sequence marker. But hey, a frequency that low cannot be
   *       played properly by the watch's buzzer, anyway.
+  * @deprecated Only faces still waiting in legacy/ use this. Convert their sequences with
+  *             utils/buzzer_tune_compiler/compile_tune.py --sequence and call watch_buzzer_play_tune instead;
+  *             this player goes away once the last of them is ported.
   */
-void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void));
+void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) __attribute__ ((deprecated("Use watch_buzzer_play_tune instead.")));
 
 /** @brief Aborts a playing sequence.
+  * @note This also aborts a tune started with watch_buzzer_play_tune.
   */
 void watch_buzzer_abort_sequence(void);
 
+/** @addtogroup tune Compact tune format
+  * @brief Tunes are byte strings interpreted by watch_buzzer_play_tune. Compared to the note sequences used by
+  *        watch_buzzer_play_sequence, they support a tempo, durations longer than 127 ticks, nested repeats
+  *        and per-note volume, and the player only wakes the CPU at note boundaries.
+  * @details A tune is a series of the following items, terminated by BUZZER_TUNE_END:
+  *          - A note: BUZZER_TUNE_NOTE(note) followed by a duration. Durations are encoded as variable length
+  *            integers: seven bits per byte, least significant group first, high bit set on every byte but
+  *            the last. Any duration under 128 is therefore a single byte. A duration of 0 skips the note.
+  *          - BUZZER_TUNE_TEMPO followed by a variable length integer: the length of one duration unit, in
+  *            1/1024 second ticks. The default is 16, i.e. durations are in 1/64 seconds.
+  *          - BUZZER_TUNE_VOLUME followed by a byte: the duty cycle (0-50) used for subsequent notes. The
+  *            default is 25, the same as watch_buzzer_play_note; 5 matches WATCH_BUZZER_VOLUME_SOFT.
+  *          - BUZZER_TUNE_REPEAT_START marks the start of a section to repeat. BUZZER_TUNE_REPEAT_END,
+  *            followed by a count, plays the section again that many times. Repeats can be nested up to
+  *            BUZZER_TUNE_MAX_REPEAT_DEPTH levels deep.
+  *          utils/buzzer_tune_compiler/compile_tune.py generates tunes from a text notation.
+  */
+/// @{
+#define BUZZER_TUNE_END             0x00
+#define BUZZER_TUNE_NOTE(note)      ((uint8_t)((note) + 1))
+#define BUZZER_TUNE_TEMPO           0xF0
+#define BUZZER_TUNE_VOLUME          0xF1
+#define BUZZER_TUNE_REPEAT_START    0xF2
+#define BUZZER_TUNE_REPEAT_END      0xF3
+
+#define BUZZER_TUNE_MAX_REPEAT_DEPTH 3
+#define BUZZER_TUNE_TICKS_PER_SECOND 1024
+
+/// @brief The state of the tune interpreter. You should not need to touch this; it's shared by the hardware and
+///        simulator players.
+typedef struct {
+    const uint8_t *tune;
+    uint16_t position;
+    uint16_t tempo;
+    uint8_t volume;
+    uint8_t repeat_depth;
+    uint16_t repeat_start[BUZZER_TUNE_MAX_REPEAT_DEPTH];
+    uint8_t repeat_count[BUZZER_TUNE_MAX_REPEAT_DEPTH];
+} watch_buzzer_tune_state_t;
+
+/** @brief Plays the given tune in a non-blocking way.
+  * @param tune A pointer to a tune in the compact tune format, ending with BUZZER_TUNE_END.
+  * @param callback_on_end A pointer to a callback function to be invoked when the tune has finished playing.
+  * @note Like watch_buzzer_play_sequence, this plays asynchronously and keeps playing in standby. Starting a tune
+  *       aborts any sequence or tune that is already playing.
+  */
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void));
+
+/** @brief Resets the interpreter state to the start of the given tune. Used internally by the tune players.
+  */
+void watch_buzzer_tune_begin(watch_buzzer_tune_state_t *state, const uint8_t *tune);
+
+/** @brief Advances the interpreter to the next audible event. Used internally by the tune players.
+  * @param state The interpreter state.
+  * @param note Set to the note to play, or BUZZER_NOTE_REST.
+  * @param volume Set to the duty cycle to play the note at.
+  * @param ticks Set to the duration of the note, in 1/1024 second ticks.
+  * @return false if the tune has ended, true otherwise.
+  */
+bool watch_buzzer_tune_next(watch_buzzer_tune_state_t *state, watch_buzzer_note_t *note, uint8_t *volume, uint32_t *ticks);
+/// @}
+
 #ifndef __EMSCRIPTEN__
 void irq_handler_tc0(void);
 #endif
@@ -277,7 +357,17 @@ void watch_set_led_yellow(void);
 /** @brief Turns both the red and the green LEDs off. */
 void watch_set_led_off(void);
 
-/** @brief Disables the TCC peripheral. Should only be called internally. */
+/** @brief Limits the brightness of the LEDs, regardless of what callers request.
+  * @param max_level The highest level (0-255) any LED channel will be driven at; colors are scaled down
+  *                  proportionally, so hues are preserved. 255 removes the limit.
+  * @note The limit applies to the next color you set; it does not change a color that is already showing.
+  */
+void watch_set_led_max_level(uint8_t max_level);
+
+/** @brief Enables the TCC peripheral. Should only be called internally, by the peripheral power manager. */
+void _watch_enable_tcc(void);
+
+/** @brief Disables the TCC peripheral. Should only be called internally, by the peripheral power manager. */
 void _watch_disable_tcc(void);
 
 /// @brief An array of periods for all the notes on a piano, corresponding to the names in watch_buzzer_note_t.
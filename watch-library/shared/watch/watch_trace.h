@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _WATCH_TRACE_H_INCLUDED
+#define _WATCH_TRACE_H_INCLUDED
+////< @file watch_trace.h
+
+#include "watch.h"
+
+/** @addtogroup trace Input Tracing
+  * @brief This section covers recording the watch's inputs, replaying them in the simulator, and the counters
+  *        used to compare two builds against the same session.
+  * @details While a trace is recording, every button edge, RTC tick, alarm and accelerometer interrupt is
+  *          appended to a fixed buffer as a four byte record: the time since the previous record in 1/128 s,
+  *          the event and one byte of data. Runs of ticks fold into a single record. Recording stops when the
+  *          buffer is full, so a trace always covers one unbroken stretch of time.
+  *
+  *          The trace is printed by the shell's `trace dump` command. In the simulator, `trace replay` plays a
+  *          dump back at its recorded pace, and the statistics below (wakes, time awake and flash writes) can
+  *          then be compared with the same replay on another build.
+  */
+/// @{
+
+#define WATCH_TRACE_TICKS_PER_SECOND 128
+
+#ifndef WATCH_TRACE_LENGTH
+#define WATCH_TRACE_LENGTH 256          ///< Records in the trace buffer; each takes four bytes of RAM.
+#endif
+
+typedef enum {
+    WATCH_TRACE_TICK = 0,               ///< The tick callback; data counts further ticks folded into this record.
+    WATCH_TRACE_LIGHT_BUTTON,           ///< The LIGHT button changed; data is the new pin level.
+    WATCH_TRACE_MODE_BUTTON,            ///< The MODE button changed; data is the new pin level.
+    WATCH_TRACE_ALARM_BUTTON,           ///< The ALARM button changed; data is the new pin level.
+    WATCH_TRACE_ALARM_BUTTON_WAKE,      ///< The ALARM button woke the watch from sleep.
+    WATCH_TRACE_ALARM_FIRED,            ///< The RTC alarm fired.
+    WATCH_TRACE_ACCELEROMETER_EVENT,    ///< The accelerometer raised INT1; data is its interrupt source register.
+    WATCH_TRACE_ACCELEROMETER_WAKE,     ///< The accelerometer woke the watch from sleep.
+    WATCH_TRACE_IDLE,                   ///< No input; carries time gaps too long for a single record.
+    WATCH_TRACE_NUM_EVENTS
+} watch_trace_event_t;
+
+typedef struct {
+    uint16_t delta;                     ///< Time since the previous record, in 1/128 s.
+    uint8_t event;                      ///< A watch_trace_event_t.
+    uint8_t data;                       ///< Event specific; see watch_trace_event_t.
+} watch_trace_record_t;
+
+typedef struct {
+    uint32_t wakes;                     ///< Times the main loop has run.
+    uint32_t awake_us;                  ///< Time spent in the main loop, in microseconds; to 1/1024 s on the watch.
+    uint32_t flash_writes;              ///< Rows written or erased in the storage area.
+} watch_trace_stats_t;
+
+/** @brief Clears the trace buffer and starts recording.
+  * @param start_time The current time, in seconds since the UNIX epoch. Records are timed from here.
+  */
+void watch_trace_start(uint32_t start_time);
+
+/** @brief Stops recording, leaving the trace in the buffer.
+  */
+void watch_trace_stop(void);
+
+/** @brief Returns true if a trace is being recorded.
+  */
+bool watch_trace_is_recording(void);
+
+/** @brief Appends an input event to the trace, if one is being recorded.
+  * @param timestamp When the event happened, in 1/128 s since the trace started. A timestamp earlier than the
+  *                  previous one is recorded as happening at the same time.
+  * @param event The kind of input.
+  * @param data Event specific; see watch_trace_event_t.
+  */
+void watch_trace_record(uint32_t timestamp, watch_trace_event_t event, uint8_t data);
+
+/** @brief Returns the recorded trace.
+  * @param records Set to point at the first record.
+  * @return The number of records.
+  */
+uint16_t watch_trace_get_records(const watch_trace_record_t **records);
+
+/** @brief Returns the time the trace started, in seconds since the UNIX epoch.
+  */
+uint32_t watch_trace_get_start_time(void);
+
+/** @brief Returns true if the last trace ran out of room before it was stopped.
+  */
+bool watch_trace_is_truncated(void);
+
+/** @brief Marks the start and end of one pass through the main loop, for the wake statistics.
+  * @return watch_trace_wake_end returns how long the pass took, in microseconds.
+  */
+void watch_trace_wake_begin(void);
+uint32_t watch_trace_wake_end(void);
+
+/** @brief Fills in the wake and flash statistics collected since boot or the last reset.
+  */
+void watch_trace_get_stats(watch_trace_stats_t *stats);
+
+/** @brief Zeroes the wake and flash statistics.
+  */
+void watch_trace_reset_stats(void);
+
+/** @brief Plays back the trace loaded into the simulator page, setting the clock to its start time.
+  * @return true if a replay started; false on hardware, or if there is nothing to replay.
+  */
+bool watch_trace_replay(void);
+
+/** @brief Returns true while a replay is in progress.
+  */
+bool watch_trace_is_replaying(void);
+
+/// @}
+#endif
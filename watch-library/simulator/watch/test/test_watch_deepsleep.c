@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks that the simulator's sleep() waits on a wake promise rather than polling a flag: each time it goes back to
+// the browser must be one that an interrupt, or at least something, ended. The promise is played by
+// _watch_wait_for_wake below, which stands in for the browser running interrupts while C is suspended.
+// Built and run by `make -C test`.
+
+#include <stdio.h>
+#include "unity.h"
+
+#include "../watch_deepsleep.c"
+
+unsigned int js_calls;
+static double now_ms;
+static unsigned int waits;
+static unsigned int interrupts_per_wait;
+static unsigned int empty_waits;            // waits that end with no interrupt, like a stray resolve
+
+double emscripten_get_now(void) {
+    return now_ms;
+}
+
+void _watch_wait_for_wake(void) {
+    waits++;
+    // a polling loop would come back here over and over with nothing to show for it.
+    if (waits > 100) TEST_FAIL_MESSAGE("sleep() went back to the browser 100 times without waking");
+    now_ms += 1000;
+    if (empty_waits) {
+        empty_waits--;
+        return;
+    }
+    for (unsigned int i = 0; i < interrupts_per_wait; i++) _wake_up_simulator();
+    // the browser takes a moment to resume us after the interrupt resolves the promise.
+    now_ms += 0.25;
+}
+
+void setUp(void) {
+    js_calls = 0;
+    waits = 0;
+    interrupts_per_wait = 1;
+    empty_waits = 0;
+}
+
+void tearDown(void) {
+}
+
+long emscripten_set_interval(void (*callback)(void *user_data), double interval_ms, void *user_data) {
+    (void) callback;
+    (void) interval_ms;
+    (void) user_data;
+    return 0;
+}
+
+void emscripten_clear_timeout(long id) {
+    (void) id;
+}
+
+void app_setup(void) {}
+uint8_t HAL_GPIO_BTN_ALARM_pin(void) { return 2; }
+uint8_t HAL_GPIO_BTN_MODE_pin(void) { return 3; }
+uint8_t HAL_GPIO_BTN_LIGHT_pin(void) { return 4; }
+void watch_enable_external_interrupts(void) {}
+void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
+    (void) pin;
+    (void) callback;
+    (void) trigger;
+}
+void watch_rtc_disable_all_periodic_callbacks(void) {}
+
+// one interrupt, one trip to the browser, and one call into JavaScript to resolve the promise.
+static void test_one_interrupt_one_wait(void) {
+    sleep(4);
+    TEST_ASSERT_EQUAL_UINT(1, waits);
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+    TEST_ASSERT_EQUAL_UINT32(250, watch_get_sleep_wake_latency_us(false));
+}
+
+// an interrupt taken while awake doesn't end the next sleep before it starts.
+static void test_interrupt_while_awake_does_not_end_sleep(void) {
+    _wake_up_simulator();
+    sleep(4);
+    TEST_ASSERT_EQUAL_UINT(1, waits);
+}
+
+// a resolve with no interrupt behind it sends us back to wait, rather than out of sleep.
+static void test_stray_resolve_waits_again(void) {
+    empty_waits = 2;
+    sleep(4);
+    TEST_ASSERT_EQUAL_UINT(3, waits);
+}
+
+// several interrupts in one wait wake us once, and only the first resolves the promise.
+static void test_several_interrupts_wake_once(void) {
+    interrupts_per_wait = 5;
+    sleep(4);
+    TEST_ASSERT_EQUAL_UINT(1, waits);
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+}
+
+// low energy mode sleeps the same way, and counts the wake.
+static void test_sleep_mode_counts_wake(void) {
+    uint32_t sleep_wakes = watch_get_sleep_wake_count();
+    watch_enter_sleep_mode();
+    TEST_ASSERT_EQUAL_UINT(1, waits);
+    TEST_ASSERT_EQUAL_UINT32(sleep_wakes + 1, watch_get_sleep_wake_count());
+    TEST_ASSERT_EQUAL_UINT32(250, watch_get_sleep_wake_latency_us(true));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_interrupt_one_wait);
+    RUN_TEST(test_interrupt_while_awake_does_not_end_sleep);
+    RUN_TEST(test_stray_resolve_waits_again);
+    RUN_TEST(test_several_interrupts_wake_once);
+    RUN_TEST(test_sleep_mode_counts_wake);
+    return UNITY_END();
+}
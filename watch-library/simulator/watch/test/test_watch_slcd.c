@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Benchmarks the simulator's display batching: a face that redraws its whole screen writes every segment, and the
+// page should only hear about it once per animation frame, and only when something changed. Before batching, every
+// pixel write was its own trip into JavaScript, so that is the figure each workload is compared against.
+// Built (with -O2, for the timings) and run by `make -C test`.
+
+#include <stdio.h>
+#include <time.h>
+#include "unity.h"
+
+#include "../watch_slcd.c"
+
+unsigned int js_calls;
+static EM_BOOL (*frame_callback)(double time, void *user_data);
+static unsigned int frame_requests;
+
+long emscripten_request_animation_frame(EM_BOOL (*callback)(double time, void *user_data), void *user_data) {
+    (void) user_data;
+    frame_callback = callback;
+    frame_requests++;
+    return 1;
+}
+
+double emscripten_get_now(void) {
+    return 0;
+}
+
+long emscripten_set_interval(void (*callback)(void *user_data), double interval_ms, void *user_data) {
+    (void) callback;
+    (void) interval_ms;
+    (void) user_data;
+    return 1;
+}
+
+void emscripten_clear_timeout(long id) {
+    (void) id;
+}
+
+void watch_display_character(uint8_t character, uint8_t position) {
+    (void) character;
+    (void) position;
+}
+
+static void run_frame(void) {
+    EM_BOOL (*callback)(double time, void *user_data) = frame_callback;
+    frame_callback = NULL;
+    if (callback) callback(0, NULL);
+}
+
+// ten positions of eight segments each, spread over three COM lines the way the classic LCD's are.
+#define NUM_POSITIONS 10
+#define SEGMENTS_PER_POSITION 8
+
+static const uint8_t digit_segments[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+/// Redraws every segment for a ten digit number, the way watch_display_text does; returns the pixel writes.
+static unsigned int redraw(uint32_t number) {
+    unsigned int writes = 0;
+    for (uint8_t position = 0; position < NUM_POSITIONS; position++) {
+        uint8_t segments = digit_segments[number % 10];
+        number /= 10;
+        for (uint8_t segment = 0; segment < SEGMENTS_PER_POSITION; segment++) {
+            uint8_t com = segment % 3;
+            uint8_t seg = position * 3 + segment / 3;
+            if (segments & (1 << segment)) watch_set_pixel(com, seg);
+            else watch_clear_pixel(com, seg);
+            writes++;
+        }
+    }
+    return writes;
+}
+
+typedef struct {
+    const char *name;
+    unsigned int frames;            // animation frames the browser shows
+    unsigned int redraws_per_frame; // times the face redraws between two of them
+    unsigned int step;              // how much the number changes from one redraw to the next
+} workload_t;
+
+// the first commit pushes every segment, since the page's state is unknown; get it out of the way.
+void setUp(void) {
+    redraw(0);
+    run_frame();
+    js_calls = 0;
+    frame_requests = 0;
+}
+
+void tearDown(void) {
+}
+
+static void test_workloads(void) {
+    const workload_t workloads[] = {
+        {"1 Hz clock, seconds changing", 600, 1, 1},
+        {"1 Hz clock, nothing changing", 600, 1, 0},
+        {"128 Hz stopwatch, 2 redraws a frame", 600, 2, 1},
+        {"burst of 100 redraws in one frame", 1, 100, 7},
+    };
+
+    printf("%-38s %10s %10s %10s\n", "workload", "unbatched", "batched", "ns/redraw");
+    for (uint8_t i = 0; i < sizeof(workloads) / sizeof(workloads[0]); i++) {
+        const workload_t *w = &workloads[i];
+        unsigned int unbatched = 0;
+        unsigned int changed_frames = 0;
+        uint32_t number = 0;
+        struct timespec start, end;
+
+        js_calls = 0;
+        frame_requests = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (unsigned int frame = 0; frame < w->frames; frame++) {
+            uint32_t before = number;
+            for (unsigned int r = 0; r < w->redraws_per_frame; r++) {
+                number += w->step;
+                unbatched += redraw(number);
+            }
+            if (number != before) changed_frames++;
+            run_frame();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        double ns = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / (w->frames * w->redraws_per_frame);
+        printf("%-38s %10u %10u %10.0f\n", w->name, unbatched, js_calls, ns);
+
+        // one trip per frame that changed something, and one animation frame requested per frame redrawn in.
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(changed_frames, js_calls, w->name);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(w->frames, frame_requests, w->name);
+        // reset the display for the next workload.
+        redraw(0);
+        run_frame();
+    }
+}
+
+// nothing is pushed until the frame, and a committed display with nothing new costs nothing.
+static void test_commit_pushes_once(void) {
+    redraw(12345);
+    TEST_ASSERT_EQUAL_UINT(0, js_calls);
+    watch_commit_display();
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+    watch_commit_display();
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+    // the frame that was already requested finds nothing left to do.
+    run_frame();
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+}
+
+// a segment turned on and back off within one frame never reaches the page.
+static void test_undone_change_is_not_pushed(void) {
+    watch_set_pixel(2, 31);
+    watch_clear_pixel(2, 31);
+    run_frame();
+    TEST_ASSERT_EQUAL_UINT(0, js_calls);
+}
+
+// clearing the display is one trip too, however much was on it.
+static void test_clear_is_one_trip(void) {
+    redraw(88888888);
+    run_frame();
+    js_calls = 0;
+    watch_clear_display();
+    run_frame();
+    TEST_ASSERT_EQUAL_UINT(1, js_calls);
+    TEST_ASSERT_EQUAL_HEX32(0, lcd_segments[0]);
+    TEST_ASSERT_EQUAL_HEX32(0, lcd_segments[1]);
+    TEST_ASSERT_EQUAL_HEX32(0, lcd_segments[2]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_workloads);
+    RUN_TEST(test_commit_pushes_once);
+    RUN_TEST(test_undone_change_is_not_pushed);
+    RUN_TEST(test_clear_is_one_trip);
+    return UNITY_END();
+}
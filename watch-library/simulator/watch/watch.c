@@ -1,7 +1,7 @@
 #include "watch.h"
 
 bool watch_is_buzzer_or_led_enabled(void) {
-    return false;
+    return watch_peripheral_get_users(WATCH_PERIPHERAL_TCC) > 0;
 }
 
 bool watch_is_usb_enabled(void) {
@@ -11,3 +11,12 @@ bool watch_is_usb_enabled(void) {
 void watch_reset_to_bootloader(void) {
     // No bootloader in the simulator; nothing to do here
 }
+
+// JavaScript runs one callback at a time, so nothing can interrupt us.
+uint32_t watch_critical_enter(void) {
+    return 0;
+}
+
+void watch_critical_exit(uint32_t state) {
+    (void) state;
+}
@@ -24,7 +24,11 @@
 
 #include "watch_adc.h"
 
-void watch_enable_adc(void) {}
+#include <emscripten.h>
+
+void watch_enable_adc(void) {
+    watch_peripheral_acquire(WATCH_PERIPHERAL_ADC);
+}
 
 void watch_enable_analog_input(const uint16_t pin) {}
 
@@ -39,10 +43,23 @@ void watch_set_analog_sampling_length(uint8_t cycles) {}
 void watch_set_analog_reference_voltage(uint8_t reference) {}
 
 uint16_t watch_get_vcc_voltage(void) {
-    // TODO: (a2) hook to UI
-    return 3000;
+    // the battery voltage comes from the simulator page, which can also play back a falling voltage curve.
+    return EM_ASM_INT({
+        return vcc_mv;
+    });
+}
+
+void watch_set_vcc_voltage(uint16_t millivolts) {
+    EM_ASM({
+        if (vcc_curve) clearInterval(vcc_curve);
+        vcc_curve = null;
+        vcc_mv = $0;
+        document.getElementById("vcc-mv").value = $0;
+    }, millivolts);
 }
 
 inline void watch_disable_analog_input(const uint16_t pin) {}
 
-inline void watch_disable_adc(void) {}
+void watch_disable_adc(void) {
+    watch_peripheral_release(WATCH_PERIPHERAL_ADC);
+}
@@ -30,32 +30,39 @@
 static uint32_t watch_backup_data[8];
 
 static bool _wake_up = false;
-static watch_cb_t _callback = NULL;
-
-
+static uint32_t _sleep_wake_count = 0;
+static double _wake_signalled_ms;
+static uint32_t _last_wake_latency_us = 0;
+static uint32_t _max_wake_latency_us = 0;
+
+// sleep() parks the C stack on a promise (Asyncify unwinds it), so the browser thread sits idle until an interrupt
+// resolves it, rather than waking every few milliseconds to check a flag.
+EM_ASYNC_JS(void, _watch_wait_for_wake, (), {
+    await new Promise(resolve => Module._watchWake = resolve);
+});
+
+/// Called for every simulated interrupt: a button callback, an RTC alarm or a periodic tick. Any of them ends sleep,
+/// as any enabled interrupt brings the SAM L22 out of STANDBY.
 void _wake_up_simulator(void) {
+    if (_wake_up) return;
     _wake_up = true;
-}
-
-static void cb_extwake_wrapper(void) {
-    _wake_up_simulator();
-
-    if (_callback) {
-        _callback();
-    }
+    _wake_signalled_ms = emscripten_get_now();
+    EM_ASM({
+        const wake = Module._watchWake;
+        Module._watchWake = null;
+        if (wake) wake();
+    });
 }
 
 void watch_register_extwake_callback(uint8_t pin, watch_cb_t callback, bool level) {
     if (pin == HAL_GPIO_BTN_ALARM_pin()) {
-        _callback = callback;
         watch_enable_external_interrupts();
-        watch_register_interrupt_callback(pin, cb_extwake_wrapper, level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
+        watch_register_interrupt_callback(pin, callback, level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
     }
 }
 
 void watch_disable_extwake_interrupt(uint8_t pin) {
     if (pin == HAL_GPIO_BTN_ALARM_pin()) {
-        _callback = NULL;
         watch_register_interrupt_callback(pin, NULL, INTERRUPT_TRIGGER_NONE);
     }
 }
@@ -74,6 +81,14 @@ uint32_t watch_get_backup_data(uint8_t reg) {
     return 0;
 }
 
+uint32_t watch_get_sleep_wake_count(void) {
+    return _sleep_wake_count;
+}
+
+uint32_t watch_get_sleep_wake_latency_us(bool worst) {
+    return worst ? _max_wake_latency_us : _last_wake_latency_us;
+}
+
 void watch_enter_sleep_mode(void) {
     // TODO: (a2) hook to UI
 
@@ -85,6 +100,7 @@ void watch_enter_sleep_mode(void) {
     watch_register_interrupt_callback(HAL_GPIO_BTN_LIGHT_pin(), NULL, INTERRUPT_TRIGGER_NONE);
 
     sleep(4);
+    _sleep_wake_count++;
 
     // call app_setup so the app can re-enable everything we disabled.
     app_setup();
@@ -100,10 +116,14 @@ void watch_enter_backup_mode(void) {
 void sleep(const uint8_t mode) {
     (void) mode;
 
+    // interrupts taken while we were awake don't count; no JavaScript can run between here and the wait.
+    _wake_up = false;
+
     // we basically hang out here until an interrupt wakes us.
     while(!_wake_up) {
-        emscripten_sleep(100);
+        _watch_wait_for_wake();
     }
 
-    _wake_up = false;
+    _last_wake_latency_us = (emscripten_get_now() - _wake_signalled_ms) * 1000;
+    if (_last_wake_latency_us > _max_wake_latency_us) _max_wake_latency_us = _last_wake_latency_us;
 }
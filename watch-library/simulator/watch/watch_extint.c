@@ -30,6 +30,11 @@
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
+// implemented in watch_rtc.c
+void _watch_rtc_sync(void);
+// implemented in watch_deepsleep.c
+void _wake_up_simulator(void);
+
 static bool debug_console_focused = false;
 static bool external_interrupt_enabled = false;
 static bool button_callbacks_installed = false;
@@ -155,6 +160,9 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
     eic_interrupt_trigger_t trigger;
     const bool level = (event & INTERRUPT_TRIGGER_RISING) != 0;
 
+    // the simulated RTC only catches up with the host clock when we get control back, and this is one of those times.
+    _watch_rtc_sync();
+
     switch (button_id) {
         case BTN_ID_MODE:
             HAL_GPIO_BTN_MODE_write(level);
@@ -187,12 +195,25 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, eic_inte
 
     if (callback && (event & trigger) != 0) {
         callback();
+        _wake_up_simulator();
         resume_main_loop();
     }
 
     return EM_TRUE;
 }
 
+// presses a button on behalf of a trace replay, exactly as if it had been clicked.
+bool _watch_simulate_button(uint8_t pin, bool level) {
+    uint8_t button_id;
+
+    if (pin == HAL_GPIO_BTN_MODE_pin()) button_id = BTN_ID_MODE;
+    else if (pin == HAL_GPIO_BTN_LIGHT_pin()) button_id = BTN_ID_LIGHT;
+    else if (pin == HAL_GPIO_BTN_ALARM_pin()) button_id = BTN_ID_ALARM;
+    else return false;
+
+    return watch_invoke_interrupt_callback(button_id, level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
+}
+
 void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
     if (pin == HAL_GPIO_BTN_MODE_pin()) {
         external_interrupt_mode_callback = callback;
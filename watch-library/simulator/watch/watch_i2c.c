@@ -24,9 +24,13 @@
 
 #include "watch_i2c.h"
 
-void watch_enable_i2c(void) {}
+void watch_enable_i2c(void) {
+    watch_peripheral_acquire(WATCH_PERIPHERAL_I2C);
+}
 
-void watch_disable_i2c(void) {}
+void watch_disable_i2c(void) {
+    watch_peripheral_release(WATCH_PERIPHERAL_I2C);
+}
 
 void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {}
 
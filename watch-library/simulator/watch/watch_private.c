@@ -24,18 +24,27 @@
 
 #include "watch_private.h"
 #include "watch_utility.h"
+#include <stdio.h>
 #include <sys/time.h>
 
 void _watch_init(void) {
+    // before anything else runs, paint the stack so we can see how deep it gets.
+    watch_memory_paint_stack();
+
     // External wake depends on RTC; calendar is a required module.
     _watch_rtc_init();
+
+    // start the supply manager off with the page's battery voltage.
+    watch_update_supply(watch_get_vcc_voltage());
 }
 
 // this function is called by arc4random to get entropy for random number generation.
 // let's use the SAM L22's true random number generator to seed the PRNG!
 int getentropy(void *buf, size_t buflen);
 int getentropy(void *buf, size_t buflen) {
+    watch_peripheral_acquire(WATCH_PERIPHERAL_TRNG);
     // TODO: (a2) hook to RNG
+    watch_peripheral_release(WATCH_PERIPHERAL_TRNG);
     return 0;
 }
 
@@ -53,6 +62,31 @@ int _gettimeofday(struct timeval *tv, void *tzvp) {
 
 void _watch_disable_tcc(void) {}
 
+// the simulator has no clocks to gate; the power manager only keeps count of users.
+void _watch_peripheral_power_on(watch_peripheral_t peripheral) {
+    (void) peripheral;
+}
+
+void _watch_peripheral_power_off(watch_peripheral_t peripheral) {
+    (void) peripheral;
+}
+
+// there's no regulator either, but log what the hardware would do so voltage curves from the page can be checked.
+static watch_supply_config_t _applied_supply_config;
+
+bool _watch_supply_lpeff_enabled(void) {
+    return _applied_supply_config.lpeff;
+}
+
+void _watch_apply_supply_config(const watch_supply_config_t *config) {
+    if (config->lpeff != _applied_supply_config.lpeff || config->guard_level != _applied_supply_config.guard_level ||
+        config->prescaler != _applied_supply_config.prescaler) {
+        printf("supply: %u mV trend, LPEFF %s, BOD33 level %u, PSEL %u\n", config->trend_millivolts,
+               config->lpeff ? "on" : "off", config->guard_level, config->prescaler);
+    }
+    _applied_supply_config = *config;
+}
+
 void _watch_enable_usb(void) {}
 
 void watch_disable_TRNG() {}
@@ -22,6 +22,8 @@
  * SOFTWARE.
  */
 
+#include <stdint.h>
+
 #include "watch_rtc.h"
 #include "watch_main_loop.h"
 #include "watch_utility.h"
@@ -29,61 +31,181 @@
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
-static double time_offset = 0;
-static long tick_callbacks[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+// The simulated RTC keeps time in C, as a count of 1/128 s (the RTC prescaler's rate) since the UNIX epoch. The host
+// clock is only consulted to advance the count when JavaScript hands control back to us: when our timer fires, or a
+// button is pressed. Reading the time is then just arithmetic, and scaling how fast the count advances against the
+// host clock fast-forwards the watch.
+#define RTC_TICKS_PER_SECOND 128
+
+static uint64_t rtc_ticks;                  // the time, as of the last sync
+static uint64_t rtc_anchor_ticks;           // the time when the host clock read rtc_anchor_ms
+static double rtc_anchor_ms;
+static uint16_t rtc_time_scale = 1;
+
+// one host timer stands in for the RTC's interrupt, set for whichever periodic tick or alarm is due first.
+static long rtc_timeout_id = -1;
+static uint64_t rtc_timeout_ticks;
+
+// indexed by PERn: 7 is the 1 Hz tick, 0 is 128 Hz.
+static watch_cb_t periodic_callbacks[8];
+static uint64_t periodic_due_ticks[8];
+
+static uint64_t alarm_due_ticks;
+static watch_date_time_t alarm_match_time;
+static rtc_alarm_match_t alarm_match_mask = ALARM_MATCH_DISABLED;
+
+static uint32_t cached_seconds = UINT32_MAX;
+static watch_date_time_t cached_date_time;
 
-static long alarm_interval_id = -1;
-static long alarm_timeout_id = -1;
-static double alarm_interval;
 watch_cb_t alarm_callback;
 watch_cb_t btn_alarm_callback;
 watch_cb_t a2_callback;
 watch_cb_t a4_callback;
 
+static void _watch_rtc_schedule(void);
+
+// implemented in watch_deepsleep.c
+void _wake_up_simulator(void);
+
+/// Brings the count up to date with the host clock. Time never runs backwards, even if a timer fired a little early.
+void _watch_rtc_sync(void) {
+    double elapsed_ms = emscripten_get_now() - rtc_anchor_ms;
+    uint64_t ticks = rtc_anchor_ticks + (uint64_t)(elapsed_ms * rtc_time_scale * RTC_TICKS_PER_SECOND / 1000.0);
+    if (ticks > rtc_ticks) rtc_ticks = ticks;
+}
+
+static void _watch_rtc_anchor(uint64_t ticks) {
+    rtc_anchor_ms = emscripten_get_now();
+    rtc_anchor_ticks = ticks;
+    rtc_ticks = ticks;
+}
+
+/// Periodic ticks land on multiples of their period, as the prescaler's bits turn over.
+static uint64_t _watch_rtc_next_period(uint8_t per_n) {
+    return ((rtc_ticks >> per_n) + 1) << per_n;
+}
+
+/// Works out when the alarm next matches, strictly after the current second.
+static void _watch_rtc_compute_alarm(void) {
+    uint32_t period;
+    uint32_t target = alarm_match_time.unit.second;
+
+    switch (alarm_match_mask) {
+        case ALARM_MATCH_SS:
+            period = 60;
+            break;
+        case ALARM_MATCH_MMSS:
+            period = 60 * 60;
+            target += alarm_match_time.unit.minute * 60;
+            break;
+        case ALARM_MATCH_HHMMSS:
+            period = 24 * 60 * 60;
+            target += alarm_match_time.unit.minute * 60 + alarm_match_time.unit.hour * 60 * 60;
+            break;
+        default:
+            alarm_due_ticks = UINT64_MAX;
+            return;
+    }
+
+    uint64_t now = rtc_ticks / RTC_TICKS_PER_SECOND;
+    uint32_t wait = (target + period - now % period) % period;
+    if (wait == 0) wait = period;
+    alarm_due_ticks = (now + wait) * RTC_TICKS_PER_SECOND;
+}
+
+static void _watch_rtc_fire(void *userData) {
+    (void) userData;
+    rtc_timeout_id = -1;
+    _watch_rtc_sync();
+    // the host clock may read a hair short of the tick we asked for, after converting to ms and back.
+    if (rtc_ticks < rtc_timeout_ticks) rtc_ticks = rtc_timeout_ticks;
+
+    // each source fires once however many of its periods went by, as the interrupt flags would on the watch.
+    bool fired = false;
+    for (int8_t i = 7; i >= 0; i--) {
+        if (periodic_callbacks[i] && rtc_ticks >= periodic_due_ticks[i]) {
+            periodic_due_ticks[i] = _watch_rtc_next_period(i);
+            periodic_callbacks[i]();
+            fired = true;
+        }
+    }
+    if (alarm_callback && rtc_ticks >= alarm_due_ticks) {
+        _watch_rtc_compute_alarm();
+        alarm_callback();
+        fired = true;
+    }
+
+    _watch_rtc_schedule();
+    if (fired) {
+        _wake_up_simulator();
+        resume_main_loop();
+    }
+}
+
+static void _watch_rtc_schedule(void) {
+    if (rtc_timeout_id != -1) emscripten_clear_timeout(rtc_timeout_id);
+    rtc_timeout_id = -1;
+
+    uint64_t next = alarm_callback ? alarm_due_ticks : UINT64_MAX;
+    for (uint8_t i = 0; i < 8; i++) {
+        if (periodic_callbacks[i] && periodic_due_ticks[i] < next) next = periodic_due_ticks[i];
+    }
+    if (next == UINT64_MAX) return;
+
+    rtc_timeout_ticks = next;
+    double due_ms = rtc_anchor_ms + (double)(next - rtc_anchor_ticks) * 1000.0 / RTC_TICKS_PER_SECOND / rtc_time_scale;
+    double delay = due_ms - emscripten_get_now();
+    rtc_timeout_id = emscripten_set_timeout(_watch_rtc_fire, delay > 0 ? delay : 0, NULL);
+}
+
 bool _watch_rtc_is_enabled(void) {
     return true;
 }
 
 void _watch_rtc_init(void) {
-#if EMSCRIPTEN
+#ifdef BUILD_YEAR
     // Shifts the timezone so our local time is converted to UTC and set
     int32_t time_zone_offset = EM_ASM_INT({
         return -new Date().getTimezoneOffset() * 60;
     });
-#endif
-#ifdef BUILD_YEAR
-    watch_date_time_t date_time = watch_get_init_date_time();
+    watch_rtc_set_date_time(watch_utility_date_time_convert_zone(watch_get_init_date_time(), time_zone_offset, 0));
 #else
-    watch_date_time_t date_time = watch_rtc_get_date_time();
+    // the one time we read the host's calendar; keep its fraction of a second, so our seconds turn over with its.
+    double now_ms = EM_ASM_DOUBLE({
+        return Date.now();
+    });
+    _watch_rtc_anchor((uint64_t)(now_ms * RTC_TICKS_PER_SECOND / 1000.0));
 #endif
-    watch_rtc_set_date_time(watch_utility_date_time_convert_zone(date_time, time_zone_offset, 0));
 }
 
 void watch_rtc_set_date_time(watch_date_time_t date_time) {
-    time_offset = EM_ASM_DOUBLE({
-        const year = 2020 + (($0 >> 26) & 0x3f);
-        const month = ($0 >> 22) & 0xf;
-        const day = ($0 >> 17) & 0x1f;
-        const hour = ($0 >> 12) & 0x1f;
-        const minute = ($0 >> 6) & 0x3f;
-        const second = $0 & 0x3f;
-        const date = new Date(year, month - 1, day, hour, minute, second);
-        return date - Date.now();
-    }, date_time.reg);
+    uint32_t seconds = watch_utility_date_time_to_unix_time(date_time, 0);
+    _watch_rtc_anchor((uint64_t)seconds * RTC_TICKS_PER_SECOND);
+    for (uint8_t i = 0; i < 8; i++) periodic_due_ticks[i] = _watch_rtc_next_period(i);
+    _watch_rtc_compute_alarm();
+    _watch_rtc_schedule();
 }
 
 watch_date_time_t watch_rtc_get_date_time(void) {
-    watch_date_time_t retval;
-    retval.reg = EM_ASM_INT({
-        const date = new Date(Date.now() + $0);
-        return date.getSeconds() |
-            (date.getMinutes() << 6) |
-            (date.getHours() << 12) |
-            (date.getDate() << 17) |
-            ((date.getMonth() + 1) << 22) |
-            ((date.getFullYear() - 2020) << 26);
-    }, time_offset);
-    return retval;
+    uint32_t seconds = rtc_ticks / RTC_TICKS_PER_SECOND;
+    if (seconds != cached_seconds) {
+        cached_date_time = watch_utility_date_time_from_unix_time(seconds, 0);
+        cached_seconds = seconds;
+    }
+    return cached_date_time;
+}
+
+void watch_rtc_set_time_scale(uint16_t factor) {
+    if (factor == 0) factor = 1;
+    _watch_rtc_sync();
+    // re-anchor, so that only time from here on runs at the new rate.
+    _watch_rtc_anchor(rtc_ticks);
+    rtc_time_scale = factor;
+    _watch_rtc_schedule();
+}
+
+uint16_t watch_rtc_get_time_scale(void) {
+    return rtc_time_scale;
 }
 
 rtc_date_time_t watch_get_init_date_time(void) {
@@ -122,12 +244,6 @@ void watch_rtc_disable_tick_callback(void) {
     watch_rtc_disable_periodic_callback(1);
 }
 
-static void watch_invoke_periodic_callback(void *userData) {
-    watch_cb_t callback = userData;
-    callback();
-    resume_main_loop();
-}
-
 void watch_rtc_register_periodic_callback(watch_cb_t callback, uint8_t frequency) {
     // we told them, it has to be a power of 2.
     if (__builtin_popcount(frequency) != 1) return;
@@ -138,104 +254,47 @@ void watch_rtc_register_periodic_callback(watch_cb_t callback, uint8_t frequency
     // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
     uint8_t per_n = __builtin_clz(tmp);
 
-    double interval = 1000.0 / frequency; // in msec
-
-    if (tick_callbacks[per_n] != -1) emscripten_clear_interval(tick_callbacks[per_n]);
-    tick_callbacks[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)callback);
+    _watch_rtc_sync();
+    periodic_callbacks[per_n] = callback;
+    periodic_due_ticks[per_n] = _watch_rtc_next_period(per_n);
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
-    uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
-    if (tick_callbacks[per_n] != -1) {
-        emscripten_clear_interval(tick_callbacks[per_n]);
-        tick_callbacks[per_n] = -1;
-    }
+    watch_rtc_disable_matching_periodic_callbacks(1 << __builtin_clz((frequency & 0xFF) << 24));
 }
 
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
     for (int i = 0; i < 8; i++) {
-        if (tick_callbacks[i] != -1 && (mask & (1 << i)) != 0) {
-            emscripten_clear_interval(tick_callbacks[i]);
-            tick_callbacks[i] = -1;
-        }
+        if (mask & (1 << i)) periodic_callbacks[i] = NULL;
     }
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
-static void watch_invoke_alarm_interval_callback(void *userData) {
-    if (alarm_callback) alarm_callback();
-}
-
-static void watch_invoke_alarm_callback(void *userData) {
-    if (alarm_callback) alarm_callback();
-    alarm_interval_id = emscripten_set_interval(watch_invoke_alarm_interval_callback, alarm_interval, NULL);
-}
-
 void watch_rtc_register_alarm_callback(watch_cb_t callback, watch_date_time_t alarm_time, rtc_alarm_match_t mask) {
-    watch_rtc_disable_alarm_callback();
-
-    switch (mask) {
-        case ALARM_MATCH_DISABLED:
-            return;
-        case ALARM_MATCH_SS:
-            alarm_interval = 60 * 1000;
-            break;
-        case ALARM_MATCH_MMSS:
-            alarm_interval = 60 * 60 * 1000;
-            break;
-        case ALARM_MATCH_HHMMSS:
-            alarm_interval = 60 * 60 * 60 * 1000;
-            break;
+    if (mask != ALARM_MATCH_SS && mask != ALARM_MATCH_MMSS && mask != ALARM_MATCH_HHMMSS) {
+        watch_rtc_disable_alarm_callback();
+        return;
     }
 
-    double timeout = EM_ASM_DOUBLE({
-        const now = Date.now();
-        const date = new Date(now);
-
-        const hour = ($0 >> 12) & 0x1f;
-        const minute = ($0 >> 6) & 0x3f;
-        const second = $0 & 0x3f;
-
-        if ($1 == 1) { // SS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            date.setSeconds(second);
-        } else if ($1 == 2) { // MMSS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            if (minute < date.getMinutes()) date.setHours(date.getHours() + 1);
-            date.setMinutes(minute, second);
-        } else if ($1 == 3) { // HHMMSS
-            if (second < date.getSeconds()) date.setMinutes(date.getMinutes() + 1);
-            if (minute < date.getMinutes()) date.setHours(date.getHours() + 1);
-            if (hour < date.getHours()) date.setDate(date.getDate() + 1);
-            date.setHours(hour, minute, second);
-        } else {
-            throw 'Invalid alarm match mask';
-        }
-
-        return date - now;
-    }, alarm_time.reg, mask);
-
+    _watch_rtc_sync();
     alarm_callback = callback;
-    alarm_timeout_id = emscripten_set_timeout(watch_invoke_alarm_callback, timeout, NULL);
+    alarm_match_time = alarm_time;
+    alarm_match_mask = mask;
+    _watch_rtc_compute_alarm();
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_disable_alarm_callback(void) {
     alarm_callback = NULL;
-    alarm_interval = 0;
-
-    if (alarm_timeout_id != -1) {
-        emscripten_clear_timeout(alarm_timeout_id);
-        alarm_timeout_id = -1;
-    }
-
-    if (alarm_interval_id != -1) {
-        emscripten_clear_interval(alarm_interval_id);
-        alarm_interval_id = -1;
-    }
+    alarm_match_mask = ALARM_MATCH_DISABLED;
+    _watch_rtc_compute_alarm();
+    _watch_rtc_schedule();
 }
 
 void watch_rtc_enable(bool en)
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_slcd.h"
 #include "watch_common_display.h"
 
@@ -37,6 +38,61 @@ static long blink_interval_id = - 1;
 static bool tick_state;
 static long tick_interval_id = -1;
 
+// The segments as C last set them, one bit per SEG line for each COM line, and as the page last showed them. Setting
+// a pixel only touches these bits; the page catches up once per animation frame, touching only the segments that
+// changed, so a face redrawing its whole screen every tick costs one trip into JavaScript rather than dozens of
+// selector queries.
+#define SLCD_NUM_COMS 8
+static uint32_t lcd_segments[SLCD_NUM_COMS];
+static uint32_t lcd_shown[SLCD_NUM_COMS];
+static bool lcd_shown_unknown = true;
+static bool lcd_commit_pending = false;
+
+static EM_BOOL watch_invoke_commit_callback(double time, void *userData) {
+    lcd_commit_pending = false;
+    watch_commit_display();
+    return EM_FALSE;
+}
+
+static void watch_schedule_commit(void) {
+    if (lcd_commit_pending) return;
+    lcd_commit_pending = true;
+    emscripten_request_animation_frame(watch_invoke_commit_callback, NULL);
+}
+
+void watch_commit_display(void) {
+    uint32_t changed[SLCD_NUM_COMS];
+    bool any = false;
+
+    for (uint8_t com = 0; com < SLCD_NUM_COMS; com++) {
+        changed[com] = lcd_shown_unknown ? UINT32_MAX : lcd_segments[com] ^ lcd_shown[com];
+        lcd_shown[com] = lcd_segments[com];
+        if (changed[com]) any = true;
+    }
+    lcd_shown_unknown = false;
+    if (!any) return;
+
+    EM_ASM({
+        // the com/seg to element table is built once; the page's segments never change.
+        if (!Module._lcdSegments) {
+            Module._lcdSegments = [];
+            document.querySelectorAll("[data-com][data-seg]").forEach((e) => {
+                const index = e.dataset.com * 32 + +e.dataset.seg;
+                (Module._lcdSegments[index] = Module._lcdSegments[index] || []).push(e);
+            });
+        }
+        for (let com = 0; com < $2; com++) {
+            const changed = HEAPU32[($0 >> 2) + com];
+            const on = HEAPU32[($1 >> 2) + com];
+            for (let seg = 0; seg < 32; seg++) {
+                if (!((changed >>> seg) & 1)) continue;
+                const elements = Module._lcdSegments[com * 32 + seg];
+                if (elements) elements.forEach((e) => e.style.opacity = (on >>> seg) & 1);
+            }
+        }
+    }, changed, lcd_segments, SLCD_NUM_COMS);
+}
+
 watch_lcd_type_t watch_get_lcd_type(void) {
 #if defined(FORCE_CUSTOM_LCD_TYPE)
     return WATCH_LCD_TYPE_CUSTOM;
@@ -61,25 +117,27 @@ void watch_enable_display(void) {
     watch_clear_display();
 }
 
+void watch_disable_display(void) {
+    watch_stop_blink();
+    watch_stop_sleep_animation();
+    watch_clear_display();
+}
+
 void watch_set_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+    if (com >= SLCD_NUM_COMS || seg >= 32) return;
+    lcd_segments[com] |= 1ul << seg;
+    watch_schedule_commit();
 }
 
 void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+    if (com >= SLCD_NUM_COMS || seg >= 32) return;
+    lcd_segments[com] &= ~(1ul << seg);
+    watch_schedule_commit();
 }
 
 void watch_clear_display(void) {
-    EM_ASM({
-        document.querySelectorAll("[data-com][data-seg]")
-            .forEach((e) => e.style.opacity = 0);
-    });
+    memset(lcd_segments, 0, sizeof(lcd_segments));
+    watch_schedule_commit();
 }
 
 static void watch_invoke_blink_callback(void *userData) {
@@ -24,9 +24,13 @@
 
 #include "watch_spi.h"
 
-void watch_enable_spi(void) {}
+void watch_enable_spi(void) {
+    watch_peripheral_acquire(WATCH_PERIPHERAL_SPI);
+}
 
-void watch_disable_spi(void) {}
+void watch_disable_spi(void) {
+    watch_peripheral_release(WATCH_PERIPHERAL_SPI);
+}
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) { return false; }
 
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "watch_storage.h"
+#include "watch_private.h"
 
 uint8_t storage[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES];
 
@@ -15,6 +16,7 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
 bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
     // printf("write row %ld offset %ld size %ld\n", row, offset, size);
     memcpy(storage + row * NVMCTRL_ROW_SIZE + offset, buffer, size);
+    _watch_trace_count_flash_write();
 
     return true;
 }
@@ -22,6 +24,7 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
 bool watch_storage_erase(uint32_t row) {
     // printf("erase row %ld\n", row);
     memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+    _watch_trace_count_flash_write();
 
     return true;
 }
@@ -30,6 +30,8 @@
 
 static bool buzzer_enabled = false;
 static uint32_t buzzer_period;
+static uint8_t buzzer_max_duty = 50;
+static uint8_t led_max_level = 255;
 
 void cb_watch_buzzer_seq(void *userData);
 
@@ -38,6 +40,8 @@ static int8_t _tone_ticks, _repeat_counter;
 static long _em_interval_id = 0;
 static int8_t *_sequence;
 static void (*_cb_finished)(void);
+static long _em_timeout_id = 0;
+static watch_buzzer_tune_state_t _tune_state;
 
 void _watch_enable_tcc(void) {}
 
@@ -46,9 +50,40 @@ static inline void _em_interval_stop() {
     _em_interval_id = 0;
 }
 
+static void cb_watch_buzzer_tune(void *userData) {
+    (void) userData;
+    watch_buzzer_note_t note;
+    uint8_t volume;
+    uint32_t ticks;
+
+    _em_timeout_id = 0;
+    if (!watch_buzzer_tune_next(&_tune_state, &note, &volume, &ticks)) {
+        // end the tune
+        watch_buzzer_abort_sequence();
+        if (_cb_finished) _cb_finished();
+        return;
+    }
+    if (note != BUZZER_NOTE_REST && volume) {
+        watch_set_buzzer_period_and_duty_cycle(NotePeriods[note], volume);
+        watch_set_buzzer_on();
+    } else {
+        watch_set_buzzer_off();
+    }
+    // only call back into C at the next note boundary.
+    _em_timeout_id = emscripten_set_timeout(cb_watch_buzzer_tune, (double)ticks * 1000 / BUZZER_TUNE_TICKS_PER_SECOND, NULL);
+}
+
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void)) {
+    watch_buzzer_abort_sequence();
+    watch_buzzer_tune_begin(&_tune_state, tune);
+    _cb_finished = callback_on_end;
+    // prepare buzzer
+    watch_enable_buzzer();
+    cb_watch_buzzer_tune(NULL);
+}
+
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
-    if (_em_interval_id) _em_interval_stop();
-    watch_set_buzzer_off();
+    watch_buzzer_abort_sequence();
     _sequence = note_sequence;
     _cb_finished = callback_on_end;
     _seq_position = 0;
@@ -105,10 +140,19 @@ void cb_watch_buzzer_seq(void *userData) {
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
     if (_em_interval_id) _em_interval_stop();
+    if (_em_timeout_id) {
+        emscripten_clear_timeout(_em_timeout_id);
+        _em_timeout_id = 0;
+    }
     watch_set_buzzer_off();
 }
 
+bool watch_is_buzzer_enabled(void) {
+    return buzzer_enabled;
+}
+
 void watch_enable_buzzer(void) {
+    if (!buzzer_enabled) watch_peripheral_acquire(WATCH_PERIPHERAL_TCC);
     buzzer_enabled = true;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
 
@@ -123,7 +167,12 @@ void watch_set_buzzer_period_and_duty_cycle(uint32_t period, uint8_t duty_cycle)
     buzzer_period = period;
 }
 
+void watch_set_buzzer_max_duty_cycle(uint8_t max_duty) {
+    buzzer_max_duty = max_duty > 50 ? 50 : max_duty;
+}
+
 void watch_disable_buzzer(void) {
+    if (buzzer_enabled) watch_peripheral_release(WATCH_PERIPHERAL_TCC);
     buzzer_enabled = false;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
 
@@ -186,11 +235,26 @@ void watch_buzzer_play_note_with_volume(watch_buzzer_note_t note, uint16_t durat
     watch_set_buzzer_off();
 }
 
-void watch_enable_leds(void) {}
+static bool _leds_enabled = false;
 
-void watch_disable_leds(void) {}
+void watch_enable_leds(void) {
+    if (!_leds_enabled) {
+        _leds_enabled = true;
+        watch_peripheral_acquire(WATCH_PERIPHERAL_TCC);
+    }
+}
+
+void watch_disable_leds(void) {
+    if (_leds_enabled) {
+        watch_set_led_off();
+        _leds_enabled = false;
+        watch_peripheral_release(WATCH_PERIPHERAL_TCC);
+    }
+}
 
 void watch_set_led_color(uint8_t red, uint8_t green) {
+    red = ((uint16_t)red * led_max_level) / 255;
+    green = ((uint16_t)green * led_max_level) / 255;
     EM_ASM({
         // the watch svg contains an feColorMatrix filter with id ledcolor
         // and a green svg gradient that mimics the led being on
@@ -224,3 +288,7 @@ void watch_set_led_yellow(void) {
 void watch_set_led_off(void) {
     watch_set_led_color(0, 0);
 }
+
+void watch_set_led_max_level(uint8_t max_level) {
+    led_max_level = max_level;
+}
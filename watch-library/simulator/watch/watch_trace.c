@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "watch_trace.h"
+#include "watch_private.h"
+#include "watch_utility.h"
+
+#include <emscripten.h>
+#include <emscripten/html5.h>
+
+// implemented in watch_extint.c
+bool _watch_simulate_button(uint8_t pin, bool level);
+
+static watch_trace_record_t _replay_records[WATCH_TRACE_LENGTH];
+static uint16_t _replay_count = 0;
+static uint16_t _replay_index = 0;
+static uint16_t _replay_skipped = 0;
+static long _replay_timeout_id = -1;
+
+uint32_t _watch_trace_get_us(void) {
+    return (uint32_t)(emscripten_get_now() * 1000.0);
+}
+
+static void _watch_trace_replay_next(void *userData);
+
+static void _watch_trace_replay_schedule(void) {
+    if (_replay_index >= _replay_count) {
+        _replay_timeout_id = -1;
+        watch_trace_stats_t stats;
+        watch_trace_get_stats(&stats);
+        printf("trace replay: %u records, %u skipped\n", _replay_count, _replay_skipped);
+        printf("trace stats: wakes=%lu awake_us=%lu flash_writes=%lu\n", (unsigned long)stats.wakes,
+               (unsigned long)stats.awake_us, (unsigned long)stats.flash_writes);
+        return;
+    }
+
+    // the records are in watch time, so they speed up with the simulated RTC.
+    double ms = _replay_records[_replay_index].delta * 1000.0 / WATCH_TRACE_TICKS_PER_SECOND / watch_rtc_get_time_scale();
+    _replay_timeout_id = emscripten_set_timeout(_watch_trace_replay_next, ms, NULL);
+}
+
+static void _watch_trace_replay_next(void *userData) {
+    (void) userData;
+    watch_trace_record_t record = _replay_records[_replay_index++];
+
+    switch (record.event) {
+        case WATCH_TRACE_LIGHT_BUTTON:
+            _watch_simulate_button(HAL_GPIO_BTN_LIGHT_pin(), record.data);
+            break;
+        case WATCH_TRACE_MODE_BUTTON:
+            _watch_simulate_button(HAL_GPIO_BTN_MODE_pin(), record.data);
+            break;
+        case WATCH_TRACE_ALARM_BUTTON:
+            _watch_simulate_button(HAL_GPIO_BTN_ALARM_pin(), record.data);
+            break;
+        case WATCH_TRACE_ALARM_BUTTON_WAKE:
+            // the release that follows a wake happens while the watch is still asleep, so it was never recorded.
+            _watch_simulate_button(HAL_GPIO_BTN_ALARM_pin(), true);
+            _watch_simulate_button(HAL_GPIO_BTN_ALARM_pin(), false);
+            break;
+        case WATCH_TRACE_TICK:
+        case WATCH_TRACE_ALARM_FIRED:
+        case WATCH_TRACE_IDLE:
+            // the simulated RTC keeps ticking and firing its alarm on its own; these records only pace the replay.
+            break;
+        default:
+            // there is no accelerometer in the simulator.
+            _replay_skipped++;
+            break;
+    }
+
+    _watch_trace_replay_schedule();
+}
+
+bool watch_trace_replay(void) {
+    if (_replay_timeout_id != -1) emscripten_clear_timeout(_replay_timeout_id);
+    _replay_timeout_id = -1;
+
+    // loadTrace() in the simulator page parses a `trace dump` into these two globals.
+    int count = EM_ASM_INT({
+        return (typeof trace_records === 'undefined') ? 0 : trace_records.length;
+    });
+    if (count <= 0) return false;
+    if (count > WATCH_TRACE_LENGTH) count = WATCH_TRACE_LENGTH;
+
+    for (int i = 0; i < count; i++) {
+        uint32_t packed = EM_ASM_INT({ return trace_records[$0]; }, i);
+        _replay_records[i].delta = packed >> 16;
+        _replay_records[i].event = (packed >> 8) & 0xFF;
+        _replay_records[i].data = packed & 0xFF;
+    }
+    _replay_count = count;
+    _replay_index = 0;
+    _replay_skipped = 0;
+
+    uint32_t start_time = (uint32_t)EM_ASM_DOUBLE({ return trace_start; });
+    watch_rtc_set_date_time(watch_utility_date_time_from_unix_time(start_time, 0));
+    watch_trace_reset_stats();
+    _watch_trace_replay_schedule();
+
+    return true;
+}
+
+bool watch_trace_is_replaying(void) {
+    return _replay_timeout_id != -1;
+}